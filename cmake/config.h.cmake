@@ -56,6 +56,8 @@
 #cmakedefine EL_HAVE_CXX11RANDOM
 #cmakedefine EL_HAVE_STEADYCLOCK
 #cmakedefine EL_HAVE_NOEXCEPT
+#cmakedefine EL_HAVE_POSIX_MEMALIGN
+#cmakedefine EL_HAVE_MADV_HUGEPAGE
 #cmakedefine EL_HAVE_MPI_REDUCE_SCATTER_BLOCK
 #cmakedefine EL_HAVE_MPI_IN_PLACE
 #cmakedefine EL_HAVE_MPI_LONG_LONG
@@ -80,6 +82,8 @@
 #cmakedefine EL_UNALIGNED_WARNINGS
 #cmakedefine EL_VECTOR_WARNINGS
 #cmakedefine EL_POOL_MEMORY
+#define EL_MEMORY_ALIGNMENT @EL_MEMORY_ALIGNMENT@
+#cmakedefine EL_HUGE_PAGES
 #cmakedefine EL_AVOID_OMP_FMA
 
 #cmakedefine EL_DECLSPEC
@@ -32,8 +32,26 @@ set(NOEXCEPT_CODE
      void Foo( const std::vector<int>& x ) noexcept { }
      int main()
      { return 0; }")
+set(POSIX_MEMALIGN_CODE
+    "#include <stdlib.h>
+     int main()
+     {
+         void* ptr;
+         posix_memalign( &ptr, 64, 1024 );
+         free( ptr );
+         return 0;
+     }")
+set(MADV_HUGEPAGE_CODE
+    "#include <sys/mman.h>
+     int main()
+     {
+         madvise( 0, 0, MADV_HUGEPAGE );
+         return 0;
+     }")
 check_cxx_source_compiles("${STEADYCLOCK_CODE}" EL_HAVE_STEADYCLOCK)
 check_cxx_source_compiles("${NOEXCEPT_CODE}" EL_HAVE_NOEXCEPT)
+check_cxx_source_compiles("${POSIX_MEMALIGN_CODE}" EL_HAVE_POSIX_MEMALIGN)
+check_cxx_source_compiles("${MADV_HUGEPAGE_CODE}" EL_HAVE_MADV_HUGEPAGE)
 
 # C++11 random number generation
 # ==============================
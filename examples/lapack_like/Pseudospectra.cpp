@@ -97,6 +97,10 @@ main( int argc, char* argv[] )
         // Input/Output options
         const bool progress = Input("--progress","print progress?",true);
         const bool deflate = Input("--deflate","deflate?",true);
+        const bool adaptive = Input("--adaptive","adaptive refinement?",false);
+        const Int coarseLevels =
+            Input("--coarseLevels","levels of adaptive refinement",3);
+        const bool warmStart = Input("--warmStart","warm start?",true);
         const bool display = Input("--display","display matrices?",false);
         const bool write = Input("--write","write matrices?",false);
         const Int numSaveFreq = 
@@ -247,6 +251,9 @@ main( int argc, char* argv[] )
         psCtrl.arnoldi = arnoldi;
         psCtrl.basisSize = basisSize;
         psCtrl.progress = progress;
+        psCtrl.adaptive = adaptive;
+        psCtrl.coarseLevels = coarseLevels;
+        psCtrl.warmStart = warmStart;
 #ifdef EL_HAVE_SCALAPACK
         psCtrl.schurCtrl.qrCtrl.blockHeight = nbDist;
         psCtrl.schurCtrl.qrCtrl.blockWidth = nbDist;
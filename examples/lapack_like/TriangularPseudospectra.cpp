@@ -58,6 +58,10 @@ main( int argc, char* argv[] )
         const Real omega = Input("--omega","frequency for Fox-Li",16*M_PI);
         const bool progress = Input("--progress","print progress?",true);
         const bool deflate = Input("--deflate","deflate?",true);
+        const bool adaptive = Input("--adaptive","adaptive refinement?",false);
+        const Int coarseLevels =
+            Input("--coarseLevels","levels of adaptive refinement",3);
+        const bool warmStart = Input("--warmStart","warm start?",true);
         const bool display = Input("--display","display matrices?",false);
         const bool write = Input("--write","write matrices?",false);
         const Int numSaveFreq = 
@@ -184,6 +188,9 @@ main( int argc, char* argv[] )
         psCtrl.arnoldi = arnoldi;
         psCtrl.basisSize = basisSize;
         psCtrl.progress = progress;
+        psCtrl.adaptive = adaptive;
+        psCtrl.coarseLevels = coarseLevels;
+        psCtrl.warmStart = warmStart;
         psCtrl.snapCtrl.imgSaveFreq = imgSaveFreq;
         psCtrl.snapCtrl.numSaveFreq = numSaveFreq;
         psCtrl.snapCtrl.imgDispFreq = imgDispFreq;
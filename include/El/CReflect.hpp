@@ -974,11 +974,37 @@ inline HermitianEigSubset<double> CReflect
     return subset;
 }
 
+/* HermitianTridiagEigCtrl */
+inline ElHermitianTridiagEigAlg CReflect( HermitianTridiagEigAlg alg )
+{ return static_cast<ElHermitianTridiagEigAlg>( alg ); }
+
+inline HermitianTridiagEigAlg CReflect( ElHermitianTridiagEigAlg alg )
+{ return static_cast<HermitianTridiagEigAlg>( alg ); }
+
+inline ElHermitianTridiagEigCtrl
+CReflect( const HermitianTridiagEigCtrl& ctrl )
+{
+    ElHermitianTridiagEigCtrl ctrlC;
+    ctrlC.alg = CReflect(ctrl.alg);
+    ctrlC.dcCutoff = ctrl.dcCutoff;
+    return ctrlC;
+}
+
+inline HermitianTridiagEigCtrl
+CReflect( const ElHermitianTridiagEigCtrl& ctrlC )
+{
+    HermitianTridiagEigCtrl ctrl;
+    ctrl.alg = CReflect(ctrlC.alg);
+    ctrl.dcCutoff = ctrlC.dcCutoff;
+    return ctrl;
+}
+
 /* HermitianEigCtrl */
 inline ElHermitianEigCtrl_s CReflect( const HermitianEigCtrl<float>& ctrl )
 {
     ElHermitianEigCtrl_s ctrlC;
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
+    ctrlC.tridiagEigCtrl = CReflect( ctrl.tridiagEigCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
     ctrlC.useSDC = ctrl.useSDC;
     return ctrlC;
@@ -987,6 +1013,7 @@ inline ElHermitianEigCtrl_d CReflect( const HermitianEigCtrl<double>& ctrl )
 {
     ElHermitianEigCtrl_d ctrlC;
     ctrlC.tridiagCtrl = CReflect( ctrl.tridiagCtrl );
+    ctrlC.tridiagEigCtrl = CReflect( ctrl.tridiagEigCtrl );
     ctrlC.sdcCtrl = CReflect( ctrl.sdcCtrl );
     ctrlC.useSDC = ctrl.useSDC;
     return ctrlC;
@@ -996,6 +1023,7 @@ inline HermitianEigCtrl<float> CReflect( const ElHermitianEigCtrl_s& ctrlC )
 {
     HermitianEigCtrl<float> ctrl;
     ctrl.tridiagCtrl = CReflect( ctrlC.tridiagCtrl );
+    ctrl.tridiagEigCtrl = CReflect( ctrlC.tridiagEigCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
     ctrl.useSDC = ctrlC.useSDC;
     return ctrl;
@@ -1004,6 +1032,7 @@ inline HermitianEigCtrl<double> CReflect( const ElHermitianEigCtrl_d& ctrlC )
 {
     HermitianEigCtrl<double> ctrl;
     ctrl.tridiagCtrl = CReflect( ctrlC.tridiagCtrl );
+    ctrl.tridiagEigCtrl = CReflect( ctrlC.tridiagEigCtrl );
     ctrl.sdcCtrl = CReflect( ctrlC.sdcCtrl );
     ctrl.useSDC = ctrlC.useSDC;
     return ctrl;
@@ -1086,6 +1115,10 @@ inline ElHessQRCtrl CReflect( const HessQRCtrl& ctrl )
     ctrlC.distAED = ctrl.distAED;
     ctrlC.blockHeight = ctrl.blockHeight;
     ctrlC.blockWidth = ctrl.blockWidth;
+    ctrlC.scalapack = ctrl.scalapack;
+    ctrlC.numShifts = ctrl.numShifts;
+    ctrlC.deflationWindow = ctrl.deflationWindow;
+    ctrlC.sequentialCutoff = ctrl.sequentialCutoff;
     return ctrlC;
 }
 
@@ -1095,6 +1128,10 @@ inline HessQRCtrl CReflect( const ElHessQRCtrl& ctrlC )
     ctrl.distAED = ctrlC.distAED;
     ctrl.blockHeight = ctrlC.blockHeight;
     ctrl.blockWidth = ctrlC.blockWidth;
+    ctrl.scalapack = ctrlC.scalapack;
+    ctrl.numShifts = ctrlC.numShifts;
+    ctrl.deflationWindow = ctrlC.deflationWindow;
+    ctrl.sequentialCutoff = ctrlC.sequentialCutoff;
     return ctrl;
 }
 
@@ -1368,6 +1405,9 @@ inline ElPseudospecCtrl_s CReflect( const PseudospecCtrl<float>& ctrl )
     ctrlC.arnoldi = ctrl.arnoldi;
     ctrlC.basisSize = ctrl.basisSize;
     ctrlC.reorthog = ctrl.reorthog;
+    ctrlC.adaptive = ctrl.adaptive;
+    ctrlC.coarseLevels = ctrl.coarseLevels;
+    ctrlC.warmStart = ctrl.warmStart;
     ctrlC.progress = ctrl.progress;
     ctrlC.snapCtrl = CReflect(ctrl.snapCtrl);
     return ctrlC;
@@ -1387,6 +1427,9 @@ inline ElPseudospecCtrl_d CReflect( const PseudospecCtrl<double>& ctrl )
     ctrlC.arnoldi = ctrl.arnoldi;
     ctrlC.basisSize = ctrl.basisSize;
     ctrlC.reorthog = ctrl.reorthog;
+    ctrlC.adaptive = ctrl.adaptive;
+    ctrlC.coarseLevels = ctrl.coarseLevels;
+    ctrlC.warmStart = ctrl.warmStart;
     ctrlC.progress = ctrl.progress;
     ctrlC.snapCtrl = CReflect(ctrl.snapCtrl);
     return ctrlC;
@@ -1407,6 +1450,9 @@ inline PseudospecCtrl<float> CReflect( const ElPseudospecCtrl_s& ctrlC )
     ctrl.arnoldi = ctrlC.arnoldi;
     ctrl.basisSize = ctrlC.basisSize;
     ctrl.reorthog = ctrlC.reorthog;
+    ctrl.adaptive = ctrlC.adaptive;
+    ctrl.coarseLevels = ctrlC.coarseLevels;
+    ctrl.warmStart = ctrlC.warmStart;
     ctrl.progress = ctrlC.progress;
     ctrl.snapCtrl = CReflect(ctrlC.snapCtrl);
     return ctrl;
@@ -1426,6 +1472,9 @@ inline PseudospecCtrl<double> CReflect( const ElPseudospecCtrl_d& ctrlC )
     ctrl.arnoldi = ctrlC.arnoldi;
     ctrl.basisSize = ctrlC.basisSize;
     ctrl.reorthog = ctrlC.reorthog;
+    ctrl.adaptive = ctrlC.adaptive;
+    ctrl.coarseLevels = ctrlC.coarseLevels;
+    ctrl.warmStart = ctrlC.warmStart;
     ctrl.progress = ctrlC.progress;
     ctrl.snapCtrl = CReflect(ctrlC.snapCtrl);
     return ctrl;
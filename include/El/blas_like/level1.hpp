@@ -231,6 +231,14 @@ template<typename T>
 void EntrywiseFill
 ( AbstractBlockDistMatrix<T>& A, std::function<T(void)> func );
 
+// Inlined versions for arbitrary callables (see level1/impl.hpp)
+template<typename T,class Function>
+void EntrywiseFill( Matrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseFill( AbstractDistMatrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseFill( AbstractBlockDistMatrix<T>& A, Function func );
+
 // EntrywiseMap
 // ============
 template<typename T>
@@ -263,6 +271,28 @@ void EntrywiseMap
 ( const DistSparseMatrix<S>& A, DistSparseMatrix<T>& B, 
   std::function<T(S)> func );
 
+// Inlined versions for arbitrary callables (see level1/impl.hpp)
+template<typename T,class Function>
+void EntrywiseMap( Matrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseMap( SparseMatrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseMap( AbstractDistMatrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseMap( AbstractBlockDistMatrix<T>& A, Function func );
+template<typename T,class Function>
+void EntrywiseMap( DistSparseMatrix<T>& A, Function func );
+
+template<typename S,typename T,class Function>
+void EntrywiseMap( const Matrix<S>& A, Matrix<T>& B, Function func );
+template<typename S,typename T,class Function>
+void EntrywiseMap
+( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B, Function func );
+template<typename S,typename T,class Function>
+void EntrywiseMap
+( const AbstractBlockDistMatrix<S>& A, AbstractBlockDistMatrix<T>& B,
+  Function func );
+
 // Fill
 // ====
 template<typename T>
@@ -310,6 +340,14 @@ template<typename T>
 void IndexDependentFill
 ( AbstractBlockDistMatrix<T>& A, std::function<T(Int,Int)> func );
 
+// Inlined versions for arbitrary callables (see level1/impl.hpp)
+template<typename T,class Function>
+void IndexDependentFill( Matrix<T>& A, Function func );
+template<typename T,class Function>
+void IndexDependentFill( AbstractDistMatrix<T>& A, Function func );
+template<typename T,class Function>
+void IndexDependentFill( AbstractBlockDistMatrix<T>& A, Function func );
+
 // IndexDependentMap
 // =================
 template<typename T>
@@ -321,6 +359,14 @@ template<typename T>
 void IndexDependentMap
 ( AbstractBlockDistMatrix<T>& A, std::function<T(Int,Int,T)> func );
 
+// Inlined versions for arbitrary callables (see level1/impl.hpp)
+template<typename T,class Function>
+void IndexDependentMap( Matrix<T>& A, Function func );
+template<typename T,class Function>
+void IndexDependentMap( AbstractDistMatrix<T>& A, Function func );
+template<typename T,class Function>
+void IndexDependentMap( AbstractBlockDistMatrix<T>& A, Function func );
+
 template<typename S,typename T>
 void IndexDependentMap
 ( const Matrix<S>& A, Matrix<T>& B, std::function<T(Int,Int,S)> func );
@@ -745,4 +791,6 @@ void Zero( DistMultiVec<T>& A );
 
 } // namespace El
 
+#include "./level1/impl.hpp"
+
 #endif // ifndef EL_BLAS1_HPP
@@ -0,0 +1,268 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_BLAS1_IMPL_HPP
+#define EL_BLAS1_IMPL_HPP
+
+namespace El {
+
+// Inlined entrywise kernels for arbitrary callables
+// =================================================
+// Unlike their std::function counterparts, these are instantiated for the
+// specific callable, so that it may be inlined into a (vectorizable) sweep
+// over each contiguous local column. All but EntrywiseFill process different
+// columns in parallel, and so the callable must be safe to call concurrently;
+// EntrywiseFill runs sequentially in column-major order so that stateful
+// generators (e.g., random samplers) behave as before.
+
+// EntrywiseFill
+// =============
+
+template<typename T,class Function>
+inline void EntrywiseFill( Matrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseFill"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    for( Int j=0; j<n; ++j )
+    {
+        T* ACol = &ABuf[j*ALDim];
+        for( Int i=0; i<m; ++i )
+            ACol[i] = func();
+    }
+}
+
+template<typename T,class Function>
+inline void EntrywiseFill( AbstractDistMatrix<T>& A, Function func )
+{ EntrywiseFill( A.Matrix(), func ); }
+
+template<typename T,class Function>
+inline void EntrywiseFill( AbstractBlockDistMatrix<T>& A, Function func )
+{ EntrywiseFill( A.Matrix(), func ); }
+
+// EntrywiseMap
+// ============
+
+template<typename T,class Function>
+inline void EntrywiseMap( Matrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseMap"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        T* ACol = &ABuf[j*ALDim];
+        for( Int i=0; i<m; ++i )
+            ACol[i] = func(ACol[i]);
+    }
+}
+
+template<typename T,class Function>
+inline void EntrywiseMap( SparseMatrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseMap"))
+    T* vBuf = A.ValueBuffer();
+    const Int numEntries = A.NumEntries();
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numEntries; ++k )
+        vBuf[k] = func(vBuf[k]);
+}
+
+template<typename T,class Function>
+inline void EntrywiseMap( AbstractDistMatrix<T>& A, Function func )
+{ EntrywiseMap( A.Matrix(), func ); }
+
+template<typename T,class Function>
+inline void EntrywiseMap( AbstractBlockDistMatrix<T>& A, Function func )
+{ EntrywiseMap( A.Matrix(), func ); }
+
+template<typename T,class Function>
+inline void EntrywiseMap( DistSparseMatrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseMap"))
+    T* vBuf = A.ValueBuffer();
+    const Int numLocalEntries = A.NumLocalEntries();
+    EL_PARALLEL_FOR
+    for( Int k=0; k<numLocalEntries; ++k )
+        vBuf[k] = func(vBuf[k]);
+}
+
+template<typename S,typename T,class Function>
+inline void EntrywiseMap( const Matrix<S>& A, Matrix<T>& B, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseMap"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    B.Resize( m, n );
+    const S* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    T* BBuf = B.Buffer();
+    const Int BLDim = B.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        const S* ACol = &ABuf[j*ALDim];
+        T* BCol = &BBuf[j*BLDim];
+        for( Int i=0; i<m; ++i )
+            BCol[i] = func(ACol[i]);
+    }
+}
+
+// Only the case of matching distributions is inlined; otherwise the
+// redistribution dominates and we defer to the std::function implementation
+
+template<typename S,typename T,class Function>
+inline void EntrywiseMap
+( const AbstractDistMatrix<S>& A, AbstractDistMatrix<T>& B, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseMap"))
+    if( A.DistData().colDist == B.DistData().colDist &&
+        A.DistData().rowDist == B.DistData().rowDist )
+    {
+        B.AlignWith( A.DistData() );
+        B.Resize( A.Height(), A.Width() );
+        EntrywiseMap( A.LockedMatrix(), B.Matrix(), func );
+    }
+    else
+        EntrywiseMap( A, B, std::function<T(S)>(func) );
+}
+
+template<typename S,typename T,class Function>
+inline void EntrywiseMap
+( const AbstractBlockDistMatrix<S>& A, AbstractBlockDistMatrix<T>& B,
+  Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("EntrywiseMap"))
+    if( A.DistData().colDist == B.DistData().colDist &&
+        A.DistData().rowDist == B.DistData().rowDist )
+    {
+        B.AlignWith( A.DistData() );
+        B.Resize( A.Height(), A.Width() );
+        EntrywiseMap( A.LockedMatrix(), B.Matrix(), func );
+    }
+    else
+        EntrywiseMap( A, B, std::function<T(S)>(func) );
+}
+
+// IndexDependentFill
+// ==================
+
+template<typename T,class Function>
+inline void IndexDependentFill( Matrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("IndexDependentFill"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        T* ACol = &ABuf[j*ALDim];
+        for( Int i=0; i<m; ++i )
+            ACol[i] = func(i,j);
+    }
+}
+
+template<typename T,class DistMatType,class Function>
+inline void IndexDependentFillLocal( DistMatType& A, Function func )
+{
+    const Int mLoc = A.LocalHeight();
+    const Int nLoc = A.LocalWidth();
+    std::vector<Int> globalRows( mLoc );
+    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        T* ACol = &ABuf[jLoc*ALDim];
+        for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+            ACol[iLoc] = func(globalRows[iLoc],j);
+    }
+}
+
+template<typename T,class Function>
+inline void IndexDependentFill( AbstractDistMatrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("IndexDependentFill"))
+    IndexDependentFillLocal<T>( A, func );
+}
+
+template<typename T,class Function>
+inline void IndexDependentFill( AbstractBlockDistMatrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("IndexDependentFill"))
+    IndexDependentFillLocal<T>( A, func );
+}
+
+// IndexDependentMap
+// =================
+
+template<typename T,class Function>
+inline void IndexDependentMap( Matrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("IndexDependentMap"))
+    const Int m = A.Height();
+    const Int n = A.Width();
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int j=0; j<n; ++j )
+    {
+        T* ACol = &ABuf[j*ALDim];
+        for( Int i=0; i<m; ++i )
+            ACol[i] = func(i,j,ACol[i]);
+    }
+}
+
+template<typename T,class DistMatType,class Function>
+inline void IndexDependentMapLocal( DistMatType& A, Function func )
+{
+    const Int mLoc = A.LocalHeight();
+    const Int nLoc = A.LocalWidth();
+    std::vector<Int> globalRows( mLoc );
+    for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    T* ABuf = A.Buffer();
+    const Int ALDim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<nLoc; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        T* ACol = &ABuf[jLoc*ALDim];
+        for( Int iLoc=0; iLoc<mLoc; ++iLoc )
+            ACol[iLoc] = func(globalRows[iLoc],j,ACol[iLoc]);
+    }
+}
+
+template<typename T,class Function>
+inline void IndexDependentMap( AbstractDistMatrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("IndexDependentMap"))
+    IndexDependentMapLocal<T>( A, func );
+}
+
+template<typename T,class Function>
+inline void IndexDependentMap( AbstractBlockDistMatrix<T>& A, Function func )
+{
+    DEBUG_ONLY(CallStackEntry cse("IndexDependentMap"))
+    IndexDependentMapLocal<T>( A, func );
+}
+
+} // namespace El
+
+#endif // ifndef EL_BLAS1_IMPL_HPP
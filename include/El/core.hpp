@@ -16,12 +16,14 @@
 #include <cmath>
 #include <complex>
 #include <cstddef>
+#include <cstdint>
 #include <cstdlib>
 #include <cstring>
 #include <ctime>
 #include <fstream>
 #include <functional>
 #include <iostream>
+#include <map>
 #include <memory>
 #include <set>
 #include <sstream>
@@ -110,6 +112,8 @@
 #include "El/core/imports/choice.hpp"
 #include "El/core/imports/mpi_choice.hpp"
 #include "El/core/environment/decl.hpp"
+#include "El/core/CommProfile.hpp"
+#include "El/core/TimerTree.hpp"
 #include "El/core/indexing/decl.hpp"
 #include "El/core/imports/blas.hpp"
 #include "El/core/imports/lapack.hpp"
@@ -389,6 +389,10 @@ protected:
     // =====================================
     virtual void ShallowSwap( type& A );
 
+    // Redistribute from an arbitrary block distribution
+    // =================================================
+    void RedistributeFrom( const type& A );
+
     // Modify the distribution metadata
     // ================================
     void SetShifts();
@@ -0,0 +1,79 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_COMMPROFILE_HPP
+#define EL_COMMPROFILE_HPP
+
+namespace El {
+
+// An opt-in profile of the communication performed by the redistributions
+// between DistMatrix distributions and by each of the mpi wrappers. While
+// enabled, each redistribution type (e.g., "[MC,MR] -> [STAR,VR]") and each
+// wrapper (e.g., "AllToAll") accumulates the number of calls, the number of
+// bytes handed to MPI, and the time spent within MPI ("wait" time). For
+// redistributions, the remaining time is split into the local work before
+// the last MPI call ("pack" time) and after it ("unpack" time).
+//
+// Redistributions which are composed of others (or of the GeneralDistMatrix
+// routines) are only recorded at the outermost level. The bytes of a call
+// are those of the local send buffer(s), or of the receive buffer for
+// receives, broadcasts, and scatters.
+struct CommProfileEntry
+{
+    Int numCalls=0;
+    double numBytes=0;
+    double packTime=0, waitTime=0, unpackTime=0;
+
+    double Time() const { return packTime + waitTime + unpackTime; }
+};
+
+// The profile is printed by Finalize if it is enabled at that point, and
+// includes the profile of each process if 'perRank' is true
+void EnableCommProfiling( bool enable=true, bool perRank=false );
+bool CommProfilingEnabled();
+void ResetCommProfile();
+
+// The profiles of the redistributions and of the mpi wrappers for this process
+const std::map<std::string,CommProfileEntry>& RedistProfile();
+const std::map<std::string,CommProfileEntry>& CollectiveProfile();
+
+// Collectively print the aggregates over 'comm' (the total calls and bytes
+// and the average and maximum times) from its root
+void PrintCommProfile
+( mpi::Comm comm=mpi::COMM_WORLD, std::ostream& os=std::cout );
+
+// Marks the extent of a redistribution from [UA,VA] to [UB,VB]. The 'kind'
+// distinguishes the non-copies, such as transposes and sum-scatters.
+class CommProfileRegion
+{
+public:
+    CommProfileRegion( const char* name );
+    CommProfileRegion
+    ( Dist UA, Dist VA, Dist UB, Dist VB, const char* kind=nullptr );
+    ~CommProfileRegion();
+private:
+    bool active_;
+};
+
+// Marks a call into MPI from one of the wrappers in El::mpi
+class CommProfileCall
+{
+public:
+    CommProfileCall( const char* name, double numBytes );
+    ~CommProfileCall();
+private:
+    const char* name_;
+    double numBytes_;
+    bool active_;
+    Clock::time_point start_;
+};
+
+} // namespace El
+
+#endif // ifndef EL_COMMPROFILE_HPP
@@ -96,6 +96,7 @@ public:
     Int* TargetBuffer();
     const Int* LockedSourceBuffer() const;
     const Int* LockedTargetBuffer() const;
+    const Int* LockedOffsetBuffer() const;
 
 private:
     Int numSources_, numTargets_;
@@ -105,16 +106,13 @@ private:
     Int firstLocalSource_, numLocalSources_;
 
     std::vector<Int> sources_, targets_;
-    std::set<std::pair<Int,Int>> markedForRemoval_;
+    std::vector<std::pair<Int,Int>> markedForRemoval_;
 
     // Helpers for local indexing
     bool consistent_;
     std::vector<Int> localEdgeOffsets_;
     void ComputeEdgeOffsets();
 
-    static bool ComparePairs
-    ( const std::pair<Int,Int>& a, const std::pair<Int,Int>& b );
-
     void AssertConsistent() const;
 
     friend class Graph;
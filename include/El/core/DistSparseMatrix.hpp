@@ -23,8 +23,19 @@ struct SparseMultMeta
     std::vector<Int> sendSizes, sendOffs,
                      recvSizes, recvOffs;
     std::vector<Int> sendInds, colOffs;
-
-    SparseMultMeta() : ready(false), numRecvInds(0) { }
+    // For each local row, the nonzeros in [localBegs[i],localEnds[i]) have
+    // columns owned by this process and require no communication
+    std::vector<Int> localBegs, localEnds;
+    // The transpose of the local matrix, with columns given by 'colOffs'
+    SparseTransposeMeta transposeMeta;
+    // Seconds spent discovering the required indices, exchanging them, and
+    // mapping the nonzeros to them during the last initialization
+    double discoveryTime, exchangeTime, mapTime;
+
+    SparseMultMeta() 
+    : ready(false), numRecvInds(0), 
+      discoveryTime(0), exchangeTime(0), mapTime(0)
+    { }
 
     void Clear()
     {
@@ -36,6 +47,10 @@ struct SparseMultMeta
         SwapClear( recvOffs );
         SwapClear( sendInds );
         SwapClear( colOffs );
+        SwapClear( localBegs );
+        SwapClear( localEnds );
+        transposeMeta.Clear();
+        discoveryTime = exchangeTime = mapTime = 0;
     }
 };
 
@@ -90,6 +105,13 @@ public:
     void QueueLocalZero( Int localRow, Int col );
     void MakeConsistent();
 
+    // For refilling the values of a fixed sparsity pattern: while the
+    // pattern is locked, QueueUpdate adds directly into the existing local 
+    // entries (which must be present) and 'multMeta' remains valid
+    void LockPattern();
+    void UnlockPattern();
+    void ZeroValues();
+
     // Queries
     // =======
 
@@ -104,6 +126,7 @@ public:
     Int NumLocalEntries() const;
     Int Capacity() const;
     bool Consistent() const;
+    bool PatternLocked() const;
 
     // Distribution information
     // ------------------------
@@ -117,20 +140,26 @@ public:
     T Value( Int localInd ) const;
     Int EntryOffset( Int localRow ) const;
     Int NumConnections( Int localRow ) const;
+    // The local index of entry (FirstLocalRow()+localRow,col), which must be 
+    // in the sparsity pattern
+    Int LocalIndex( Int localRow, Int col ) const;
     Int* SourceBuffer();
     Int* TargetBuffer();
     T* ValueBuffer();
     const Int* LockedSourceBuffer() const;
     const Int* LockedTargetBuffer() const;
     const T* LockedValueBuffer() const;
+    const Int* LockedOffsetBuffer() const;
+
+    // Build the communication metadata for Multiply (if it is not current)
+    const SparseMultMeta<T>& InitializeMultMeta() const;
 
     mutable SparseMultMeta<T> multMeta;
 
 private:
     El::DistGraph distGraph_;
     std::vector<T> vals_;
-
-    static bool CompareEntries( const Entry<T>& a, const Entry<T>& b );
+    bool patternLocked_=false;
 
     void AssertConsistent() const;
 
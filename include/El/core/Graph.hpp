@@ -81,20 +81,18 @@ public:
     Int* TargetBuffer();
     const Int* LockedSourceBuffer() const;
     const Int* LockedTargetBuffer() const;
+    const Int* LockedOffsetBuffer() const;
 
 private:
     Int numSources_, numTargets_;
     std::vector<Int> sources_, targets_;
-    std::set<std::pair<Int,Int>> markedForRemoval_;
+    std::vector<std::pair<Int,Int>> markedForRemoval_;
 
     // Helpers for local indexing
     bool consistent_;
     std::vector<Int> edgeOffsets_;
     void ComputeEdgeOffsets();
 
-    static bool ComparePairs
-    ( const std::pair<Int,Int>& a, const std::pair<Int,Int>& b );
-
     void AssertConsistent() const;
 
     friend class DistGraph;
@@ -36,6 +36,29 @@ public:
     void Empty();
 };
 
+// When EL_POOL_MEMORY is defined, the Memory class draws its buffers from a
+// (thread-safe) pool for each datatype, which caches freed buffers by size 
+// class for later reuse. The byte counts are over buffers of that datatype.
+struct MemoryPoolStats
+{
+    std::size_t numRequests, numHits;
+    std::size_t bytesInUse, bytesCached;
+    // The most bytes that were ever held from the system at once
+    std::size_t highWaterMark;
+
+    double HitRate() const 
+    { return numRequests==0 ? 0. : double(numHits)/double(numRequests); }
+};
+
+template<typename G>
+MemoryPoolStats MemoryPoolStatistics();
+
+// Free cached buffers (largest first) until at most 'maxCachedBytes' remain
+template<typename G>
+void TrimMemoryPool( std::size_t maxCachedBytes=0 );
+// Apply the above to the pool of each datatype
+void TrimMemoryPools( std::size_t maxCachedBytes=0 );
+
 } // namespace El
 
 #endif // ifndef EL_MEMORY_HPP
@@ -17,6 +17,26 @@ namespace El {
 // Forward declaration for constructor
 template<typename T> class DistSparseMatrix;
 
+// The structure of the transpose of a (local) sparse matrix: the nonzeros of
+// column j are stored in [offs[j],offs[j+1]), with row indices 'inds' and 
+// positions 'perm' within the original buffers. This is cached so that
+// threaded transposed/adjoint products can avoid scattered writes.
+struct SparseTransposeMeta
+{
+    bool ready;
+    std::vector<Int> offs, inds, perm;
+
+    SparseTransposeMeta() : ready(false) { }
+
+    void Clear()
+    {
+        ready = false;
+        SwapClear( offs );
+        SwapClear( inds );
+        SwapClear( perm );
+    }
+};
+
 template<typename T>
 class SparseMatrix
 {
@@ -61,6 +81,14 @@ public:
     void QueueZero( Int row, Int col );
     void MakeConsistent();
 
+    // For refilling the values of a fixed sparsity pattern: while the
+    // pattern is locked, QueueUpdate adds directly into the existing entries 
+    // (which must be present), so that no sorting is required and any 
+    // metadata cached for the pattern remains valid
+    void LockPattern();
+    void UnlockPattern();
+    void ZeroValues();
+
     // Queries
     // =======
 
@@ -71,6 +99,7 @@ public:
     Int NumEntries() const;
     Int Capacity() const;
     bool Consistent() const;
+    bool PatternLocked() const;
     El::Graph& Graph();
     const El::Graph& LockedGraph() const;
 
@@ -81,18 +110,23 @@ public:
     T Value( Int index ) const;
     Int EntryOffset( Int row ) const;
     Int NumConnections( Int row ) const;
+    // The index of entry (row,col), which must be in the sparsity pattern
+    Int Index( Int row, Int col ) const;
     Int* SourceBuffer();
     Int* TargetBuffer();
     T* ValueBuffer();
     const Int* LockedSourceBuffer() const;
     const Int* LockedTargetBuffer() const;
     const T* LockedValueBuffer() const;
+    const Int* LockedOffsetBuffer() const;
+
+    // Built on demand (under a lock) by threaded transposed/adjoint products
+    mutable SparseTransposeMeta transposeMeta;
 
 private:
     El::Graph graph_;
     std::vector<T> vals_;
-
-    static bool CompareEntries( const Entry<T>& a, const Entry<T>& b );
+    bool patternLocked_=false;
 
     void AssertConsistent() const;
 
@@ -0,0 +1,55 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_TIMERTREE_HPP
+#define EL_TIMERTREE_HPP
+
+namespace El {
+
+struct TimerNode;
+
+// A tree of nested timing regions, which are opened and closed by the
+// lifetime of ScopedTimer objects. Each thread records into its own tree,
+// and the trees are merged (by the path of region names) when reporting.
+// While disabled, a ScopedTimer only checks a flag.
+//
+// If 'trace' is true, every closed region is also kept as an event so that
+// the timeline can be exported for chrome://tracing. Neither ResetTimers nor
+// EnableTimers should be called while a region is open.
+void EnableTimers( bool enable=true, bool trace=false );
+bool TimersEnabled();
+void ResetTimers();
+
+// Collectively print the call tree from the root of 'comm', with the number
+// of calls and the minimum, average, and maximum (over the processes) of the
+// inclusive and exclusive time of each region. Finalize prints the tree over
+// mpi::COMM_WORLD if the timers are enabled at that point.
+void PrintTimers( mpi::Comm comm=mpi::COMM_WORLD, std::ostream& os=std::cout );
+
+// Collectively write the trace events of every process in 'comm' into a
+// single file (from its root) in the Chrome trace-event JSON format
+void WriteChromeTrace
+( const std::string& filename, mpi::Comm comm=mpi::COMM_WORLD );
+
+class ScopedTimer
+{
+public:
+    ScopedTimer( const char* name );
+    ScopedTimer( const std::string& name );
+    ~ScopedTimer();
+private:
+    TimerNode* node_;
+    Clock::time_point start_;
+
+    void Open( const char* name );
+};
+
+} // namespace El
+
+#endif // ifndef EL_TIMERTREE_HPP
@@ -61,6 +61,17 @@ void SetDefaultBlockWidth( Int blockWidth );
 
 std::mt19937& Generator();
 
+// The seed of the counter-based generator used for layout-independent random
+// matrices and the index of its next stream. Each distributed random fill
+// consumes one stream, which is agreed upon collectively over the given
+// communicator (any process which fell behind skips ahead).
+void SetRandomSeed( std::uint64_t seed );
+std::uint64_t RandomSeed();
+std::uint64_t NextRandomStream( mpi::Comm comm );
+
+// The number of threads available to each process (one if OpenMP is disabled)
+Int NumThreads();
+
 template<typename T>
 inline T Max( T m, T n )
 { return std::max(m,n); }
@@ -94,6 +105,11 @@ void StridedMemCopy
 template<typename T>
 void MemZero( T* buffer, std::size_t numEntries );
 
+// A leading dimension of at least 'height' which keeps every column of a 
+// Memory-backed matrix aligned and avoids cache-set aliasing between columns
+template<typename T>
+Int PaddedLDim( Int height );
+
 // Clear the contents of x by swapping with an empty object of the same type
 template<typename T>
 void SwapClear( T& x );
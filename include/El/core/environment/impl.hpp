@@ -132,6 +132,20 @@ MemZero( T* buffer, std::size_t numEntries )
     std::memset( buffer, 0, numEntries*sizeof(T) );
 }
 
+template<typename T>
+inline Int
+PaddedLDim( Int height )
+{
+    // Round up to a whole number of EL_MEMORY_ALIGNMENT-byte blocks, and then
+    // add one more block if the stride is a multiple of 4 KiB, which would 
+    // map every column onto the same cache sets
+    const Int blocksize = Max( Int(EL_MEMORY_ALIGNMENT/sizeof(T)), Int(1) );
+    Int ldim = ((Max(height,Int(1))+blocksize-1)/blocksize)*blocksize;
+    if( (ldim*sizeof(T)) % 4096 == 0 )
+        ldim += blocksize;
+    return ldim;
+}
+
 template<typename T>
 inline void
 SwapClear( T& x )
@@ -47,6 +47,26 @@ T SampleNormal( T mean=0, Base<T> stddev=1 );
 template<typename T> 
 T SampleBall( T center=0, Base<T> radius=1 );
 
+// Counter-based generation
+// ========================
+// Philox4x32-10 is a stateless bijection from a 128-bit counter to 128 random
+// bits for each 64-bit key. Keying it on a seed and stream and counting on the
+// global (i,j) index of a matrix entry yields samples which are independent of
+// how (and by how many processes) the matrix is distributed.
+typedef std::array<std::uint32_t,2> PhiloxKey;
+typedef std::array<std::uint32_t,4> PhiloxCounter;
+
+PhiloxCounter Philox4x32( PhiloxCounter counter, PhiloxKey key );
+PhiloxKey CounterKey( std::uint64_t seed, std::uint64_t stream );
+
+// The counter-based analogues of SampleBall and SampleNormal for entry (i,j)
+template<typename T>
+T CounterSampleBall
+( PhiloxKey key, Int i, Int j, T center=0, Base<T> radius=1 );
+template<typename T>
+T CounterSampleNormal
+( PhiloxKey key, Int i, Int j, T mean=0, Base<T> stddev=1 );
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_DECL_HPP
@@ -185,6 +185,110 @@ SampleBall<Int>( Int center, Int radius )
     return round(u);
 }
 
+// Counter-based generation
+// ========================
+
+inline PhiloxCounter Philox4x32( PhiloxCounter counter, PhiloxKey key )
+{
+    const std::uint64_t M0=0xD2511F53, M1=0xCD9E8D57;
+    const std::uint32_t W0=0x9E3779B9, W1=0xBB67AE85;
+    for( Int round=0; round<10; ++round )
+    {
+        if( round > 0 )
+        {
+            key[0] += W0;
+            key[1] += W1;
+        }
+        const std::uint64_t prod0 = M0*counter[0];
+        const std::uint64_t prod1 = M1*counter[2];
+        const std::uint32_t hi0 = prod0>>32, hi1 = prod1>>32;
+        counter = PhiloxCounter
+        { hi1 ^ counter[1] ^ key[0], std::uint32_t(prod1),
+          hi0 ^ counter[3] ^ key[1], std::uint32_t(prod0) };
+    }
+    return counter;
+}
+
+// Decorrelate nearby (seed,stream) pairs with the SplitMix64 finalizer
+inline PhiloxKey CounterKey( std::uint64_t seed, std::uint64_t stream )
+{
+    std::uint64_t z = seed + (stream+1)*0x9E3779B97F4A7C15ULL;
+    z = (z ^ (z>>30))*0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z>>27))*0x94D049BB133111EBULL;
+    z = z ^ (z>>31);
+    return PhiloxKey{ std::uint32_t(z), std::uint32_t(z>>32) };
+}
+
+inline PhiloxCounter PhiloxEntry( PhiloxKey key, Int i, Int j )
+{
+    const std::uint64_t iu = i, ju = j;
+    return Philox4x32
+    ( PhiloxCounter{ std::uint32_t(iu), std::uint32_t(iu>>32),
+                     std::uint32_t(ju), std::uint32_t(ju>>32) }, key );
+}
+
+// Map a pair of random words to [0,1)
+template<typename Real>
+inline Real PhiloxUnit( std::uint32_t lo, std::uint32_t hi )
+{
+    const std::uint64_t bits = ((std::uint64_t(hi)<<32) | lo) >> 11;
+    return Real(bits)/Real(9007199254740992.);
+}
+
+template<>
+inline float PhiloxUnit<float>( std::uint32_t lo, std::uint32_t hi )
+{ return float(hi>>8)/16777216.f; }
+
+template<typename T>
+inline T CounterSampleBall
+( PhiloxKey key, Int i, Int j, T center, Base<T> radius )
+{
+    typedef Base<T> Real;
+    const PhiloxCounter bits = PhiloxEntry( key, i, j );
+    const Real u0 = PhiloxUnit<Real>( bits[0], bits[1] );
+    const Real u1 = PhiloxUnit<Real>( bits[2], bits[3] );
+    T sample;
+    if( IsComplex<T>::val )
+    {
+        // Match SampleBall: a uniform radius and angle about the center
+        const Real r = u0*radius;
+        const Real angle = u1*Real(2*Pi);
+        SetRealPart( sample, RealPart(center)+r*Cos(angle) );
+        SetImagPart( sample, ImagPart(center)+r*Sin(angle) );
+    }
+    else
+        SetRealPart( sample, RealPart(center)+(u0-Real(1)/Real(2))*radius );
+    return sample;
+}
+
+template<>
+inline Int CounterSampleBall<Int>
+( PhiloxKey key, Int i, Int j, Int center, Int radius )
+{ return round(CounterSampleBall<double>(key,i,j,center,radius)); }
+
+template<typename T>
+inline T CounterSampleNormal
+( PhiloxKey key, Int i, Int j, T mean, Base<T> stddev )
+{
+    typedef Base<T> Real;
+    const PhiloxCounter bits = PhiloxEntry( key, i, j );
+    // Box-Muller, with the first uniform shifted into (0,1]
+    const Real u0 = Real(1) - PhiloxUnit<Real>( bits[0], bits[1] );
+    const Real u1 = PhiloxUnit<Real>( bits[2], bits[3] );
+    const Real rho = Sqrt(-2*Log(u0));
+    const Real angle = u1*Real(2*Pi);
+    T sample;
+    if( IsComplex<T>::val )
+    {
+        stddev = stddev / Sqrt(Real(2));
+        SetRealPart( sample, RealPart(mean)+stddev*rho*Cos(angle) );
+        SetImagPart( sample, ImagPart(mean)+stddev*rho*Sin(angle) );
+    }
+    else
+        SetRealPart( sample, RealPart(mean)+stddev*rho*Cos(angle) );
+    return sample;
+}
+
 } // namespace El
 
 #endif // ifndef EL_RANDOM_IMPL_HPP
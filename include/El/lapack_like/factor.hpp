@@ -14,10 +14,21 @@ namespace El {
 
 // Cholesky
 // ========
+struct CholeskyCtrl
+{
+    // Factor and redistribute each panel as soon as its columns (rows) have
+    // been updated, before the rest of the previous trailing update
+    bool lookahead;
+
+    CholeskyCtrl() : lookahead(false) { }
+};
+
 template<typename F>
 void Cholesky( UpperOrLower uplo, Matrix<F>& A );
 template<typename F>
-void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A );
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<F>& A,
+  const CholeskyCtrl& ctrl=CholeskyCtrl() );
 
 template<typename F>
 void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A );
@@ -210,10 +221,21 @@ void LU( AbstractDistMatrix<F>& A );
 
 // LU with partial pivoting
 // ------------------------
+struct LUCtrl
+{
+    // Choose the pivots of each panel with a tournament over a binary tree
+    // of the process column (as in CALU) rather than one column at a time
+    bool tournament;
+
+    LUCtrl() : tournament(false) { }
+};
+
 template<typename F>
 void LU( Matrix<F>& A, Matrix<Int>& p );
 template<typename F>
-void LU( AbstractDistMatrix<F>& A, AbstractDistMatrix<Int>& p );
+void LU
+( AbstractDistMatrix<F>& A, AbstractDistMatrix<Int>& p,
+  const LUCtrl& ctrl=LUCtrl() );
 
 // LU with full pivoting
 // ---------------------
@@ -251,6 +273,14 @@ void Panel
   DistMatrix<F,  MC,  STAR>& A21, 
   DistMatrix<Int,STAR,STAR>& p1 );
 
+// Perform a panel factorization using tournament pivoting
+// -------------------------------------------------------
+template<typename F>
+void TournamentPanel
+( DistMatrix<F,  STAR,STAR>& A11,
+  DistMatrix<F,  MC,  STAR>& A21,
+  DistMatrix<Int,STAR,STAR>& p1 );
+
 // Solve linear systems using an implicit unpivoted LU factorization
 // -----------------------------------------------------------------
 template<typename F>
@@ -174,9 +174,23 @@ typedef struct {
 } ElHermitianSDCCtrl_d;
 EL_EXPORT ElError ElHermitianSDCCtrlDefault_d( ElHermitianSDCCtrl_d* ctrl );
 
+/* HermitianTridiagEigCtrl */
+typedef enum {
+  EL_HERMITIAN_TRIDIAG_EIG_MRRR,
+  EL_HERMITIAN_TRIDIAG_EIG_DC
+} ElHermitianTridiagEigAlg;
+
+typedef struct {
+  ElHermitianTridiagEigAlg alg;
+  ElInt dcCutoff;
+} ElHermitianTridiagEigCtrl;
+EL_EXPORT ElError ElHermitianTridiagEigCtrlDefault
+( ElHermitianTridiagEigCtrl* ctrl );
+
 /* HermitianEigCtrl */
 typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
+  ElHermitianTridiagEigCtrl tridiagEigCtrl;
   ElHermitianSDCCtrl_s sdcCtrl;
   bool useSDC;
 } ElHermitianEigCtrl_s;
@@ -184,6 +198,7 @@ EL_EXPORT ElError ElHermitianEigCtrlDefault_s( ElHermitianEigCtrl_s* ctrl );
 
 typedef struct {
   ElHermitianTridiagCtrl tridiagCtrl;
+  ElHermitianTridiagEigCtrl tridiagEigCtrl;
   ElHermitianSDCCtrl_d sdcCtrl;
   bool useSDC;
 } ElHermitianEigCtrl_d;
@@ -705,6 +720,8 @@ EL_EXPORT ElError ElHermitianPolarDecompDist_z
 typedef struct {
   bool distAED;
   ElInt blockHeight, blockWidth;
+  bool scalapack;
+  ElInt numShifts, deflationWindow, sequentialCutoff;
 } ElHessQRCtrl;
 EL_EXPORT ElError ElHessQRCtrlDefault( ElHessQRCtrl* ctrl );
 
@@ -875,6 +892,10 @@ typedef struct {
   ElInt basisSize;
   bool reorthog;
 
+  bool adaptive;
+  ElInt coarseLevels;
+  bool warmStart;
+
   bool progress;
 
   ElSnapshotCtrl snapCtrl;
@@ -900,6 +921,10 @@ typedef struct {
   ElInt basisSize;
   bool reorthog;
 
+  bool adaptive;
+  ElInt coarseLevels;
+  bool warmStart;
+
   bool progress;
 
   ElSnapshotCtrl snapCtrl;
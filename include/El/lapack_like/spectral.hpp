@@ -44,15 +44,39 @@ struct HermitianSDCCtrl {
     { }
 };
 
+namespace HermitianTridiagEigAlgNS {
+enum HermitianTridiagEigAlg
+{
+    HERMITIAN_TRIDIAG_EIG_MRRR,
+    HERMITIAN_TRIDIAG_EIG_DC
+};
+}
+using namespace HermitianTridiagEigAlgNS;
+
+// The divide and conquer algorithm is only used when computing (distributed)
+// eigenvectors, and it always computes the entire spectrum before extracting
+// any requested subset. Problems of size at most 'dcCutoff' are solved
+// redundantly with sequential MRRR.
+struct HermitianTridiagEigCtrl
+{
+    HermitianTridiagEigAlg alg;
+    Int dcCutoff;
+
+    HermitianTridiagEigCtrl()
+    : alg(HERMITIAN_TRIDIAG_EIG_MRRR), dcCutoff(64)
+    { }
+};
+
 template<typename Real>
 struct HermitianEigCtrl
 {
     HermitianTridiagCtrl tridiagCtrl;
+    HermitianTridiagEigCtrl tridiagEigCtrl;
     HermitianSDCCtrl<Real> sdcCtrl;
     bool useSDC;
 
     HermitianEigCtrl()
-    : tridiagCtrl(), sdcCtrl(), useSDC(false)
+    : tridiagCtrl(), tridiagEigCtrl(), sdcCtrl(), useSDC(false)
     { }
 };
 
@@ -168,7 +192,8 @@ void HermitianTridiagEig
 ( const AbstractDistMatrix<Base<F>>& d, const AbstractDistMatrix<F>& dSub,
         AbstractDistMatrix<Base<F>>& w,       AbstractDistMatrix<F>& Z, 
   SortType sort=ASCENDING,
-  const HermitianEigSubset<Base<F>>& subset=HermitianEigSubset<Base<F>>() );
+  const HermitianEigSubset<Base<F>>& subset=HermitianEigSubset<Base<F>>(),
+  const HermitianTridiagEigCtrl& ctrl=HermitianTridiagEigCtrl() );
 
 template<typename Real>
 Int HermitianTridiagEigEstimate
@@ -258,9 +283,18 @@ struct HessQRCtrl {
     bool distAED;
     Int blockHeight, blockWidth;
 
+    // The native distributed implementation is used unless Elemental was
+    // configured with ScaLAPACK and 'scalapack' is true. A 'numShifts' or
+    // 'deflationWindow' of zero is chosen based upon the size of the active
+    // block, and active blocks of at most 'sequentialCutoff' rows are
+    // redundantly reduced with LAPACK.
+    bool scalapack;
+    Int numShifts, deflationWindow, sequentialCutoff;
+
     HessQRCtrl() 
     : distAED(false), 
-      blockHeight(DefaultBlockHeight()), blockWidth(DefaultBlockWidth()) 
+      blockHeight(DefaultBlockHeight()), blockWidth(DefaultBlockWidth()),
+      scalapack(true), numShifts(0), deflationWindow(0), sequentialCutoff(256)
     { }
 };
 
@@ -528,6 +562,20 @@ struct PseudospecCtrl
     Int basisSize;
     bool reorthog; // only matters for IRL, which isn't currently used
 
+    // Adaptive refinement of spectral windows. The shifts are first sampled
+    // with a stride of 2^coarseLevels in each direction, and a cell is only
+    // refined if one of the contourLevels (values of epsilon) crosses it or,
+    // for (quasi-)triangular matrices, if it contains an eigenvalue; if no
+    // levels are given, every integer power of ten is used. Shifts which are
+    // never evaluated are interpolated and given an iteration count of zero.
+    // If warmStart is true, each newly evaluated shift begins from the final
+    // vector of its nearest evaluated neighbor (only the two-norm estimators
+    // for complex Schur and Hessenberg forms support this).
+    bool adaptive;
+    Int coarseLevels;
+    std::vector<Real> contourLevels;
+    bool warmStart;
+
     // Whether or not to print progress information at each iteration
     bool progress;
 
@@ -538,6 +586,7 @@ struct PseudospecCtrl
       schur(true), forceComplexSchur(false), forceComplexPs(false), schurCtrl(),
       maxIts(200), tol(1e-6), deflate(true),
       arnoldi(true), basisSize(10), reorthog(true),
+      adaptive(false), coarseLevels(3), contourLevels(), warmStart(true),
       progress(false), snapCtrl()
     { }
 };
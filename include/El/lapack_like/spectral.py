@@ -934,7 +934,10 @@ lib.ElHessQRCtrlDefault.argtypes = [c_void_p]
 lib.ElHessQRCtrlDefault.restype = c_uint
 class HessQRCtrl(ctypes.Structure):
   _fields_ = [("distAED",bType),
-              ("blockHeight",iType),("blockWidth",iType)]
+              ("blockHeight",iType),("blockWidth",iType),
+              ("scalapack",bType),
+              ("numShifts",iType),("deflationWindow",iType),
+              ("sequentialCutoff",iType)]
   def __init__(self):
     lib.ElHessQRCtrlDefault(pointer(self))
 
@@ -1170,6 +1173,9 @@ class PseudospecCtrl_s(ctypes.Structure):
               ("arnoldi",bType),
               ("basisSize",iType),
               ("reorthog",bType),
+              ("adaptive",bType),
+              ("coarseLevels",iType),
+              ("warmStart",bType),
               ("progress",bType),
               ("snapCtrl",SnapshotCtrl)]
   def __init__(self):
@@ -1194,6 +1200,9 @@ class PseudospecCtrl_d(ctypes.Structure):
               ("arnoldi",bType),
               ("basisSize",iType),
               ("reorthog",bType),
+              ("adaptive",bType),
+              ("coarseLevels",iType),
+              ("warmStart",bType),
               ("progress",bType),
               ("snapCtrl",SnapshotCtrl)]
   def __init__(self):
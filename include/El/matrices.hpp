@@ -626,6 +626,9 @@ void Bernoulli( AbstractBlockDistMatrix<T>& A, Int m, Int n );
 
 // Gaussian
 // ========
+// The distributed fills draw from the counter-based generator and are
+// collective over the viewing communicator of the matrix's grid (or the
+// communicator of a DistMultiVec), even when filling a view
 template<typename F>
 void MakeGaussian( Matrix<F>& A, F mean=0, Base<F> stddev=1 );
 template<typename F>
@@ -688,7 +691,9 @@ void ThreeValued( AbstractBlockDistMatrix<T>& A, Int m, Int n, double p=2./3. );
 
 // Uniform
 // =======
-// Draw each entry from a uniform PDF over a closed ball.
+// Draw each entry from a uniform PDF over a closed ball. As with Gaussian, the
+// distributed fills are collective over the viewing communicator of the
+// matrix's grid (or the communicator of a DistMultiVec).
 template<typename T>
 void MakeUniform( Matrix<T>& A, T center=0, Base<T> radius=1 );
 template<typename T>
@@ -265,6 +265,38 @@ struct DistSymmFront
     mutable DistMatrix<T> work2d;
 };
 
+// Out-of-core storage of the factored local fronts. As soon as a local front
+// has been factored, it is written to a file in 'directory' (which should be
+// on node-local disk) and freed if keeping it would exceed 'memoryBudget'
+// bytes. The lower solves read such fronts back in, with a background thread
+// reading up to 'prefetchDepth' of them ahead of the solve. The files are named
+// by each process's rank within the tree's communicator, so trees over
+// disjoint communicators should be given separate directories.
+struct OutOfCoreCtrl
+{
+    std::string directory;
+    double memoryBudget;
+    int prefetchDepth;
+
+    OutOfCoreCtrl() : directory("."), memoryBudget(1e9), prefetchDepth(4) { }
+};
+
+struct FrontIOStats
+{
+    double bytes;
+    int numWrites, numReads, numPrefetches;
+    // The seconds spent writing, reading, and waiting on the prefetches
+    double writeTime, readTime, waitTime;
+
+    FrontIOStats()
+    : bytes(0), numWrites(0), numReads(0), numPrefetches(0),
+      writeTime(0), readTime(0), waitTime(0)
+    { }
+};
+
+// Forward declaration
+template<typename T> class FrontStore;
+
 template<typename T>
 struct DistSymmFrontTree
 {
@@ -273,6 +305,9 @@ struct DistSymmFrontTree
     std::vector<SymmFront<T>> localFronts;
     std::vector<DistSymmFront<T>> distFronts;
 
+    // Only set when the local fronts are stored out of core
+    std::shared_ptr<FrontStore<T>> outOfCore;
+
     DistSymmFrontTree();
 
     DistSymmFrontTree
@@ -308,6 +343,15 @@ struct DistSymmFrontTree
     void SolveWork
     ( double& numLocalFlops, double& minLocalFlops, double& maxLocalFlops,
       double& numGlobalFlops, int numRhs=1 ) const;
+
+    // Both must be called before the factorization, as disabling out-of-core
+    // storage discards any fronts which were written out
+    void EnableOutOfCore( const OutOfCoreCtrl& ctrl=OutOfCoreCtrl() );
+    void DisableOutOfCore();
+
+    // The I/O statistics of each local front, and a summary over 'comm'
+    void IOStats( std::vector<FrontIOStats>& stats ) const;
+    void PrintIOStats( mpi::Comm comm, std::ostream& os=std::cout ) const;
 };
 
 template<typename F>
@@ -339,10 +383,27 @@ void LowerMultiply
   const DistSymmInfo& info, const DistSymmFrontTree<T>& L,
   DistNodalMultiVec<T>& X );
 
+// The distributed portion of the 1D solves pushes the right-hand sides through
+// each level of the tree in blocks of 'pipelineWidth' columns, so that the
+// exchange of one block's updates overlaps the solve against the previous
+// block (a nonpositive width disables the pipelining). The overlap is only
+// within a level: every block finishes a level before any block starts on the
+// parent level, so the pipeline drains once per level. The solves which start
+// from a DistMultiVec use the 2D fronts once there are at least 'min2dWidth'
+// right-hand sides, and the 1D fronts otherwise.
+struct SolveCtrl
+{
+    int pipelineWidth;
+    int min2dWidth;
+
+    SolveCtrl() : pipelineWidth(4), min2dWidth(32) { }
+};
+
 template<typename F>
 void LowerSolve
 ( Orientation orientation, const DistSymmInfo& info,
-  const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X );
+  const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X,
+  const SolveCtrl& ctrl=SolveCtrl() );
 template<typename F>
 void LowerSolve
 ( Orientation orientation, const DistSymmInfo& info,
@@ -351,11 +412,18 @@ void LowerSolve
 template<typename F>
 void Solve
 ( const DistSymmInfo& info,
-  const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X );
+  const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X,
+  const SolveCtrl& ctrl=SolveCtrl() );
 template<typename F>
 void Solve
 ( const DistSymmInfo& info,
   const DistSymmFrontTree<F>& L, DistNodalMatrix<F>& X );
+// Converts the fronts of L to 1D or 2D depending upon the width of X
+template<typename F>
+void Solve
+( const DistSymmInfo& info, DistSymmFrontTree<F>& L,
+  const DistMap& inverseMap, DistMultiVec<F>& X,
+  const SolveCtrl& ctrl=SolveCtrl() );
 
 template<typename F>
 void SymmetricSolve
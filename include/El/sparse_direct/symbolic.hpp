@@ -17,8 +17,10 @@
 #include "./symbolic/DistSymmInfo.hpp"
 
 #include "./symbolic/SymmetricAnalysis.hpp"
+#include "./symbolic/Amalgamate.hpp"
 
 #include "./symbolic/NestedDissection.hpp"
 #include "./symbolic/NaturalNestedDissection.hpp"
+#include "./symbolic/DistSymmAnalysis.hpp"
 
 #endif // ifndef EL_SPARSEDIRECT_SYMBOLIC_HPP
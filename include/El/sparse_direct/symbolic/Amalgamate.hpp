@@ -0,0 +1,66 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SYMBOLIC_AMALGAMATE_HPP
+#define EL_SYMBOLIC_AMALGAMATE_HPP
+
+namespace El {
+
+// Relaxed supernode amalgamation: a separator whose two children are (or have
+// become) leaves is merged with them into a single leaf when the merged front
+// is small enough, or when few enough of its entries are explicit zeros. Since
+// the elimination tree is built from bisections, a node is only ever merged
+// with both of its children, which preserves the binary structure.
+struct AmalgamationCtrl
+{
+    bool amalgamate;
+
+    // Merge whenever the merged front would have at most this many columns
+    int relaxSize;
+
+    // Otherwise, merge when at most this fraction of the entries of the
+    // (lower-trapezoidal) merged front would be explicit zeros
+    double maxZeroFraction;
+
+    // Print the number of fronts and the estimated memory and flops of the
+    // factorization before and after amalgamation
+    bool progress;
+
+    AmalgamationCtrl()
+    : amalgamate(false), relaxSize(16), maxZeroFraction(0.1), progress(false)
+    { }
+};
+
+struct AmalgamationInfo
+{
+    // The number of local fronts and estimates of the number of entries and
+    // the (real) flops of factoring them, before and after amalgamation
+    int numNodesBefore, numNodesAfter;
+    double entriesBefore, entriesAfter;
+    double flopsBefore, flopsAfter;
+};
+
+// Amalgamate the local portions of the (already reversed) separator and
+// elimination trees, which must then be passed to BuildMap and the symbolic
+// analysis. The local root is left untouched since it is shared with the
+// distributed tree.
+void Amalgamate
+( DistSeparatorTree& sepTree, DistSymmElimTree& eTree,
+  const AmalgamationCtrl& ctrl, AmalgamationInfo& info );
+
+// Sum the estimates over 'comm' and print them from its root process
+void PrintAmalgamationInfo
+( const AmalgamationInfo& info, mpi::Comm comm,
+  std::ostream& os=std::cout );
+
+} // namespace El
+
+#endif // ifndef EL_SYMBOLIC_AMALGAMATE_HPP
@@ -0,0 +1,86 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SYMBOLIC_DISTSYMMANALYSIS_HPP
+#define EL_SYMBOLIC_DISTSYMMANALYSIS_HPP
+
+namespace El {
+
+// Everything which the numeric phase needs from the symbolic phase: the
+// reordering (and its inverse), the separator tree, and the symbolic
+// factorization along with its communication metadata. Since these only
+// depend upon the sparsity pattern, a single analysis can be used to build the
+// DistSymmFrontTree of any number of matrices with the same pattern, and it
+// can be written to disk and loaded back in by a later run over the same
+// number of processes.
+struct DistSymmAnalysis
+{
+    DistMap map, inverseMap;
+    DistSeparatorTree sepTree;
+    DistSymmInfo info;
+
+    DistSymmAnalysis() { }
+
+    // Free the communicators and grids held by the separator tree and info
+    void Empty();
+
+    // Each process writes its portion to '<basename>-<rank>.bin'
+    void Write( const std::string& basename ) const;
+    // Must be called over a communicator with the same size as the one which
+    // the analysis was written from, with each process at the same rank
+    void Load( const std::string& basename, mpi::Comm comm );
+
+private:
+    // The trees free their nodes upon destruction
+    DistSymmAnalysis( const DistSymmAnalysis& );
+    const DistSymmAnalysis& operator=( const DistSymmAnalysis& );
+};
+
+inline void NestedDissection
+( const DistGraph& graph,
+        DistSymmAnalysis& analysis,
+        bool sequential=true,
+        int numDistSeps=1,
+        int numSeqSeps=1,
+        int cutoff=128,
+        bool storeFactRecvInds=false,
+  const AmalgamationCtrl& amalgCtrl=AmalgamationCtrl() )
+{
+    DEBUG_ONLY(CallStackEntry cse("NestedDissection"))
+    analysis.Empty();
+    NestedDissection
+    ( graph, analysis.map, analysis.sepTree, analysis.info,
+      sequential, numDistSeps, numSeqSeps, cutoff, storeFactRecvInds,
+      amalgCtrl );
+    analysis.map.FormInverse( analysis.inverseMap );
+}
+
+inline void NaturalNestedDissection
+(       int nx,
+        int ny,
+        int nz,
+  const DistGraph& graph,
+        DistSymmAnalysis& analysis,
+        int cutoff=128,
+        bool storeFactRecvInds=false,
+  const AmalgamationCtrl& amalgCtrl=AmalgamationCtrl() )
+{
+    DEBUG_ONLY(CallStackEntry cse("NaturalNestedDissection"))
+    analysis.Empty();
+    NaturalNestedDissection
+    ( nx, ny, nz, graph, analysis.map, analysis.sepTree, analysis.info,
+      cutoff, storeFactRecvInds, amalgCtrl );
+    analysis.map.FormInverse( analysis.inverseMap );
+}
+
+} // namespace El
+
+#endif // ifndef EL_SYMBOLIC_DISTSYMMANALYSIS_HPP
@@ -23,7 +23,8 @@ void NaturalNestedDissection
         DistSeparatorTree& sepTree, 
         DistSymmInfo& info,
         int cutoff=128, 
-        bool storeFactRecvInds=false );
+        bool storeFactRecvInds=false,
+  const AmalgamationCtrl& amalgCtrl=AmalgamationCtrl() );
 
 int NaturalBisect
 (       int nx, 
@@ -454,7 +455,8 @@ NaturalNestedDissection
         DistSeparatorTree& sepTree, 
         DistSymmInfo& info,
         int cutoff, 
-        bool storeFactRecvInds )
+        bool storeFactRecvInds,
+  const AmalgamationCtrl& amalgCtrl )
 {
     DEBUG_ONLY(CallStackEntry cse("NaturalNestedDissection"))
     // NOTE: There is a potential memory leak here if these data structures 
@@ -478,6 +480,13 @@ NaturalNestedDissection
     ( nx, ny, nz, graph, perm, sepTree, eTree, 0, 0, false, cutoff );
 
     ReverseOrder( sepTree, eTree );
+    if( amalgCtrl.amalgamate )
+    {
+        AmalgamationInfo amalgInfo;
+        Amalgamate( sepTree, eTree, amalgCtrl, amalgInfo );
+        if( amalgCtrl.progress )
+            PrintAmalgamationInfo( amalgInfo, comm );
+    }
 
     // Construct the distributed reordering    
     BuildMap( graph, sepTree, map );
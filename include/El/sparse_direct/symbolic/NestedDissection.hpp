@@ -47,7 +47,8 @@ void NestedDissection
         int numDistSeps=1, 
         int numSeqSeps=1, 
         int cutoff=128, 
-        bool storeFactRecvInds=false );
+        bool storeFactRecvInds=false,
+  const AmalgamationCtrl& amalgCtrl=AmalgamationCtrl() );
 
 int Bisect
 ( const Graph& graph, 
@@ -502,7 +503,8 @@ NestedDissection
         int numDistSeps, 
         int numSeqSeps, 
         int cutoff,
-        bool storeFactRecvInds )
+        bool storeFactRecvInds,
+  const AmalgamationCtrl& amalgCtrl )
 {
     DEBUG_ONLY(CallStackEntry cse("NestedDissection"))
     // NOTE: There is a potential memory leak here if these data structures 
@@ -527,6 +529,13 @@ NestedDissection
       numDistSeps, numSeqSeps, cutoff );
 
     ReverseOrder( sepTree, eTree );
+    if( amalgCtrl.amalgamate )
+    {
+        AmalgamationInfo amalgInfo;
+        Amalgamate( sepTree, eTree, amalgCtrl, amalgInfo );
+        if( amalgCtrl.progress )
+            PrintAmalgamationInfo( amalgInfo, comm );
+    }
 
     // Construct the distributed reordering    
     BuildMap( graph, sepTree, map );
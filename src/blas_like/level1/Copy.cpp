@@ -22,7 +22,7 @@ void Copy( const Matrix<S>& A, Matrix<T>& B )
 {
     DEBUG_ONLY(CallStackEntry cse("Copy"))
     auto convert = []( const S alpha ) { return T(alpha); };
-    EntrywiseMap( A, B, std::function<T(S)>(convert) );
+    EntrywiseMap( A, B, convert );
 }
 
 template<typename T,Dist U,Dist V>
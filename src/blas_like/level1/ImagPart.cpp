@@ -27,8 +27,7 @@ void ImagPart
 ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<Base<T>>& AImag )
 { 
     auto imagPart = []( T alpha ) { return ImagPart(alpha); };
-    std::function<Base<T>(T)> realLambda( imagPart );
-    EntrywiseMap( A, AImag, realLambda );
+    EntrywiseMap( A, AImag, imagPart );
 }
 
 template<typename T>
@@ -36,8 +35,7 @@ void ImagPart
 ( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<Base<T>>& AImag )
 { 
     auto imagPart = []( T alpha ) { return ImagPart(alpha); };
-    std::function<Base<T>(T)> realLambda( imagPart );
-    EntrywiseMap( A, AImag, realLambda );
+    EntrywiseMap( A, AImag, imagPart );
 }
 
 #define PROTO(T) \
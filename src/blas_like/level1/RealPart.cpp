@@ -27,8 +27,7 @@ void RealPart
 ( const AbstractDistMatrix<T>& A, AbstractDistMatrix<Base<T>>& AReal )
 { 
     auto realPart = []( T alpha ) { return RealPart(alpha); };
-    std::function<Base<T>(T)> realLambda( realPart );
-    EntrywiseMap( A, AReal, realLambda );
+    EntrywiseMap( A, AReal, realPart );
 }
 
 template<typename T>
@@ -36,8 +35,7 @@ void RealPart
 ( const AbstractBlockDistMatrix<T>& A, AbstractBlockDistMatrix<Base<T>>& AReal )
 { 
     auto realPart = []( T alpha ) { return RealPart(alpha); };
-    std::function<Base<T>(T)> realLambda( realPart );
-    EntrywiseMap( A, AReal, realLambda );
+    EntrywiseMap( A, AReal, realPart );
 }
 
 #define PROTO(T) \
@@ -88,6 +88,7 @@ void Gemm
   T beta,        AbstractDistMatrix<T>& C, GemmAlgorithm alg )
 {
     DEBUG_ONLY(CallStackEntry cse("Gemm"))
+    ScopedTimer timer("Gemm");
     if( orientationOfA == NORMAL && orientationOfB == NORMAL )
     {
         if( alg == GEMM_CANNON )
@@ -27,6 +27,7 @@ Cannon_NN
              DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
              DimsString(CPre,"C"));
     )
+    ScopedTimer timer("gemm::Cannon_NN");
     const Grid& g = APre.Grid();
     if( g.Height() != g.Width() )
         LogicError("Process grid must be square for Cannon's");
@@ -111,6 +112,7 @@ SUMMA_NNA
              DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
              DimsString(CPre,"C"));
     )
+    ScopedTimer timer("gemm::SUMMA_NNA");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Int sumDim = APre.Width();
@@ -164,6 +166,7 @@ SUMMA_NNB
              DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
              DimsString(CPre,"C"));
     )
+    ScopedTimer timer("gemm::SUMMA_NNB");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Int sumDim = APre.Width();
@@ -214,6 +217,7 @@ SUMMA_NNC
              DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
              DimsString(CPre,"C"));
     )
+    ScopedTimer timer("gemm::SUMMA_NNC");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Int sumDim = APre.Width();
@@ -264,6 +268,7 @@ SUMMA_NNDot
              DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
              DimsString(CPre,"C"));
     )
+    ScopedTimer timer("gemm::SUMMA_NNDot");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Int sumDim = APre.Width();
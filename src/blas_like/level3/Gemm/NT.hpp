@@ -30,6 +30,7 @@ SUMMA_NTA
              DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
               DimsString(CPre,"C"));
     )
+    ScopedTimer timer("gemm::SUMMA_NTA");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Int sumDim = APre.Width();
@@ -85,6 +86,7 @@ SUMMA_NTB
              DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
              DimsString(CPre,"C"));
     )
+    ScopedTimer timer("gemm::SUMMA_NTB");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Int sumDim = APre.Width();
@@ -143,6 +145,7 @@ SUMMA_NTC
              DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
              DimsString(CPre,"C"));
     )
+    ScopedTimer timer("gemm::SUMMA_NTC");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Int sumDim = APre.Width();
@@ -30,6 +30,7 @@ SUMMA_TNA
              DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
              DimsString(CPre,"C"));
     )
+    ScopedTimer timer("gemm::SUMMA_TNA");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Int sumDim = BPre.Height();
@@ -86,6 +87,7 @@ SUMMA_TNB
              DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
              DimsString(CPre,"C"));
     )
+    ScopedTimer timer("gemm::SUMMA_TNB");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Int sumDim = BPre.Height();
@@ -141,6 +143,7 @@ SUMMA_TNC
              DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
              DimsString(CPre,"C"));
     )
+    ScopedTimer timer("gemm::SUMMA_TNC");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Int sumDim = BPre.Height();
@@ -30,6 +30,7 @@ SUMMA_TTA
              DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
              DimsString(CPre,"C"));
     )
+    ScopedTimer timer("gemm::SUMMA_TTA");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Int sumDim = APre.Height();
@@ -88,6 +89,7 @@ SUMMA_TTB
              DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
              DimsString(CPre,"C"));
     )
+    ScopedTimer timer("gemm::SUMMA_TTB");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Int sumDim = APre.Height();
@@ -149,6 +151,7 @@ SUMMA_TTC
              DimsString(APre,"A"),"\n",DimsString(BPre,"B"),"\n",
              DimsString(CPre,"C"));
     )
+    ScopedTimer timer("gemm::SUMMA_TTC");
     const Int m = CPre.Height();
     const Int n = CPre.Width();
     const Int sumDim = APre.Height();
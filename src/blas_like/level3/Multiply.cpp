@@ -10,6 +10,8 @@
 */
 #include "El.hpp"
 
+#include "./Multiply/CSR.hpp"
+
 namespace El {
 
 template<typename T>
@@ -24,60 +26,71 @@ void Multiply
             LogicError("X and Y must have the same width");
     )
     const Int m = A.Height();
+    const Int n = A.Width();
     const Int b = X.Width();
 
-    // Y := beta Y
-    Scale( beta, Y );
-
-    // Accumulate
     if( orientation == NORMAL )
     {
-        // Y := alpha A X + Y
         if( A.Height() != Y.Height() )
             LogicError("A and Y must have the same height");
         if( A.Width() != X.Height() )
             LogicError("The width of A must match the height of X");
-        for( Int i=0; i<m; ++i )
-        {
-            const Int off = A.EntryOffset( i );
-            const Int rowSize = A.NumConnections( i );
-            for( Int k=0; k<rowSize; ++k )
-            {
-                const Int j = A.Col(k+off);
-                const T AVal = A.Value(k+off);
-                for( Int t=0; t<b; ++t )
-                {
-                    const T XVal = X.Get(j,t);
-                    Y.Update( i, t, alpha*AVal*XVal );
-                }
-            }
-        }
     }
     else
     {
-        // Y := alpha A' X + Y
         if( A.Width() != Y.Height() )
             LogicError("The width of A must match the height of Y");
         if( A.Height() != X.Height() )
             LogicError("The height of A must match the height of X");
+    }
+
+    // Y := beta Y
+    Scale( beta, Y );
+    if( A.NumEntries() == 0 || b == 0 )
+        return;
+
+    const Int* offs = A.LockedOffsetBuffer();
+    const Int* colInds = A.LockedTargetBuffer();
+    const T* vals = A.LockedValueBuffer();
+
+    // Accumulate
+    if( orientation == NORMAL )
+    {
+        // Y := alpha A X + Y
+        if( b == 1 )
+        {
+            multiply::ThreadedCSRMultiply
+            ( 0, m, 1, alpha, offs, offs, offs+1, colInds,
+              multiply::DirectValues<T>(vals),
+              X.LockedBuffer(), 1, Y.Buffer(), 1, Y.LDim() );
+        }
+        else
+        {
+            std::vector<T> XPanel( n*b );
+            multiply::PackRowPanel( 0, n, X, XPanel.data(), b );
+            multiply::ThreadedCSRMultiply
+            ( 0, m, b, alpha, offs, offs, offs+1, colInds,
+              multiply::DirectValues<T>(vals),
+              XPanel.data(), b, Y.Buffer(), 1, Y.LDim() );
+        }
+    }
+    else
+    {
+        // Y := alpha A' X + Y
         const bool conjugate = ( orientation == ADJOINT );
-        for( Int i=0; i<m; ++i ) 
+        if( b == 1 )
         {
-            const Int off = A.EntryOffset( i );
-            const Int rowSize = A.NumConnections( i );
-            for( Int k=0; k<rowSize; ++k )
-            {
-                const Int j = A.Col(k+off); 
-                const T AVal = A.Value(k+off);
-                for( Int t=0; t<b; ++t )
-                {
-                    const T XVal = X.Get(i,t);
-                    if( conjugate )
-                        Y.Update( j, t, alpha*Conj(AVal)*XVal );
-                    else
-                        Y.Update( j, t, alpha*AVal*XVal );
-                }
-            }
+            multiply::AdjointMultiply
+            ( conjugate, m, n, 1, alpha, offs, colInds, vals, A.transposeMeta,
+              X.LockedBuffer(), X.LDim(), Y.Buffer(), 1 );
+        }
+        else
+        {
+            std::vector<T> YPanel( n*b, 0 );
+            multiply::AdjointMultiply
+            ( conjugate, m, n, b, alpha, offs, colInds, vals, A.transposeMeta,
+              X.LockedBuffer(), X.LDim(), YPanel.data(), b );
+            multiply::UpdateFromRowPanel( 0, n, YPanel.data(), b, Y );
         }
     }
 }
@@ -98,89 +111,44 @@ void Multiply
     )
     mpi::Comm comm = A.Comm();
     const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
 
     // Y := beta Y
     Scale( beta, Y );
 
-    SparseMultMeta<T>& meta = A.multMeta;
-    if( !meta.ready )
-    {
-        // Compute the set of row indices that we need from X in a normal
-        // multiply or update of Y in the adjoint case
-        const Int numLocalEntries = A.NumLocalEntries();
-        std::set<Int> indexSet;
-        for( Int e=0; e<numLocalEntries; ++e )
-            indexSet.insert( A.Col(e) );
-        const Int numRecvInds = indexSet.size();
-        std::vector<Int> recvInds( numRecvInds );
-        meta.recvSizes.clear();
-        meta.recvSizes.resize( commSize, 0 );
-        meta.recvOffs.resize( commSize );
+    DEBUG_ONLY(
         const Int blocksize = 
-          ( orientation == NORMAL ? X.Blocksize() : Y.Blocksize() );;
-        {
-            Int off=0, lastOff=0, qPrev=0;
-            std::set<Int>::const_iterator setIt;
-            for( setIt=indexSet.begin(); setIt!=indexSet.end(); ++setIt )
-            {
-                const Int j = *setIt;
-                const Int q = RowToProcess( j, blocksize, commSize );
-                while( qPrev != q )
-                {
-                    meta.recvSizes[qPrev] = off - lastOff;
-                    meta.recvOffs[qPrev+1] = off;
-
-                    lastOff = off;
-                    ++qPrev;
-                }
-                recvInds[off++] = j;
-            }
-            while( qPrev != commSize-1 )
-            {
-                meta.recvSizes[qPrev] = off - lastOff;
-                meta.recvOffs[qPrev+1] = off;
-                lastOff = off;
-                ++qPrev;
-            }
-            meta.recvSizes[commSize-1] = off - lastOff;
-        }
-
-        // Coordinate
-        meta.sendSizes.resize( commSize );
-        mpi::AllToAll
-        ( meta.recvSizes.data(), 1, meta.sendSizes.data(), 1, comm );
-        Int numSendInds=0;
-        meta.sendOffs.resize( commSize );
-        for( int q=0; q<commSize; ++q )
-        {
-            meta.sendOffs[q] = numSendInds;
-            numSendInds += meta.sendSizes[q];
-        }
-        meta.sendInds.resize( numSendInds );
-        mpi::AllToAll
-        ( recvInds.data(), meta.recvSizes.data(), meta.recvOffs.data(),
-          meta.sendInds.data(), meta.sendSizes.data(), meta.sendOffs.data(), 
-          comm );
-
-        meta.colOffs.resize( numLocalEntries );
-        for( Int s=0; s<numLocalEntries; ++s )
-            meta.colOffs[s] = Find( recvInds, A.Col(s) );
-        meta.numRecvInds = numRecvInds;
-        meta.ready = true;
-    }
+          ( orientation == NORMAL ? X.Blocksize() : Y.Blocksize() );
+        if( blocksize != A.Width()/commSize )
+            LogicError("Multivector was not distributed like A's columns");
+    )
+    SparseMultMeta<T>& meta = A.multMeta;
+    A.InitializeMultMeta();
 
-    // Convert the sizes and offsets to be compatible with the current width
     const Int b = X.Width();
-    std::vector<int> recvSizes=meta.recvSizes,
-                     recvOffs=meta.recvOffs,
-                     sendSizes=meta.sendSizes,
-                     sendOffs=meta.sendOffs;
+    const Int ALocalHeight = A.LocalHeight();
+    const bool haveEntries = ( A.NumLocalEntries() != 0 );
+    const Int* offs = A.LockedOffsetBuffer();
+    const Int* localBegs = meta.localBegs.data();
+    const Int* localEnds = meta.localEnds.data();
+    const Int* colOffs = meta.colOffs.data();
+    const T* vals = A.LockedValueBuffer();
+
+    // The indices owned by this process are exchanged with local copies, and 
+    // the rest with non-blocking point-to-point messages to just the
+    // processes which we share indices with
+    const Int selfRecvOff = meta.recvOffs[commRank];
+    const Int selfSendOff = meta.sendOffs[commRank];
+    const Int selfSize = meta.recvSizes[commRank];
+    int numSendNeighbors=0, numRecvNeighbors=0;
     for( int q=0; q<commSize; ++q )
     {
-        recvSizes[q] *= b;    
-        recvOffs[q] *= b;
-        sendSizes[q] *= b;
-        sendOffs[q] *= b;
+        if( q == commRank )
+            continue;
+        if( meta.sendSizes[q] != 0 )
+            ++numSendNeighbors;
+        if( meta.recvSizes[q] != 0 )
+            ++numRecvNeighbors;
     }
 
     if( orientation == NORMAL )
@@ -190,46 +158,60 @@ void Multiply
         if( A.Width() != X.Height() )
             LogicError("The width of A must match the height of X");
 
-        // Pack the send values
+        // Post the receives for the remote entries of X
+        std::vector<T> recvVals( meta.numRecvInds*b );
+        std::vector<mpi::Request> recvRequests( numRecvNeighbors );
+        for( int q=0, k=0; q<commSize; ++q )
+            if( q != commRank && meta.recvSizes[q] != 0 )
+                mpi::IRecv
+                ( &recvVals[meta.recvOffs[q]*b], meta.recvSizes[q]*b, q, comm,
+                  recvRequests[k++] );
+
+        // Pack and send the entries of X requested by other processes
         const Int numSendInds = meta.sendInds.size();
         const Int firstLocalRow = X.FirstLocalRow();
+        const T* XBuf = X.LockedMatrix().LockedBuffer();
+        const Int XLDim = X.LockedMatrix().LDim();
         std::vector<T> sendVals( numSendInds*b );
+        EL_PARALLEL_FOR
         for( Int s=0; s<numSendInds; ++s )
         {
-            const Int i = meta.sendInds[s];
-            const Int iLocal = i - firstLocalRow;
-            DEBUG_ONLY(
-                if( iLocal < 0 || iLocal >= X.LocalHeight() )
-                    LogicError("iLocal was out of bounds: ",iLocal,
-                                " not in [0,",X.LocalHeight(),")");
-            )
+            const Int iLocal = meta.sendInds[s] - firstLocalRow;
             for( Int t=0; t<b; ++t )
-                sendVals[s*b+t] = X.GetLocal( iLocal, t );
+                sendVals[s*b+t] = XBuf[iLocal+t*XLDim];
         }
+        std::vector<mpi::Request> sendRequests( numSendNeighbors );
+        for( int q=0, k=0; q<commSize; ++q )
+            if( q != commRank && meta.sendSizes[q] != 0 )
+                mpi::ISend
+                ( &sendVals[meta.sendOffs[q]*b], meta.sendSizes[q]*b, q, comm,
+                  sendRequests[k++] );
+        MemCopy( &recvVals[selfRecvOff*b], &sendVals[selfSendOff*b], selfSize*b );
 
-        // Now send them
-        std::vector<T> recvVals( meta.numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), sendSizes.data(), sendOffs.data(),
-          recvVals.data(), recvSizes.data(), recvOffs.data(), comm );
-     
-        // Perform the local multiply-accumulate, y := alpha A x + y
-        const Int ALocalHeight = A.LocalHeight();
-        for( Int iLocal=0; iLocal<ALocalHeight; ++iLocal )
+        // Multiply with the nonzeros whose columns we own while the remote
+        // entries of X are in flight
+        T* YBuf = Y.Matrix().Buffer();
+        const Int YLDim = Y.Matrix().LDim();
+        if( haveEntries )
+            multiply::ThreadedCSRMultiply
+            ( 0, ALocalHeight, b, alpha, offs, localBegs, localEnds, colOffs,
+              multiply::DirectValues<T>(vals),
+              recvVals.data(), b, YBuf, 1, YLDim );
+
+        // Finish with the nonzeros to the left and right of the local block
+        mpi::WaitAll( numRecvNeighbors, recvRequests.data() );
+        if( haveEntries )
         {
-            const Int off = A.EntryOffset( iLocal );
-            const Int rowSize = A.NumConnections( iLocal );
-            for( Int k=0; k<rowSize; ++k )
-            {
-                const Int colOff = meta.colOffs[k+off];
-                const T AVal = A.Value(k+off);
-                for( Int t=0; t<b; ++t )
-                {
-                    const T XVal = recvVals[colOff*b+t];
-                    Y.UpdateLocal( iLocal, t, alpha*AVal*XVal );
-                }
-            }
+            multiply::ThreadedCSRMultiply
+            ( 0, ALocalHeight, b, alpha, offs, offs, localBegs, colOffs,
+              multiply::DirectValues<T>(vals),
+              recvVals.data(), b, YBuf, 1, YLDim );
+            multiply::ThreadedCSRMultiply
+            ( 0, ALocalHeight, b, alpha, offs, localEnds, offs+1, colOffs,
+              multiply::DirectValues<T>(vals),
+              recvVals.data(), b, YBuf, 1, YLDim );
         }
+        mpi::WaitAll( numSendNeighbors, sendRequests.data() );
     }
     else
     {
@@ -237,51 +219,94 @@ void Multiply
             LogicError("The width of A must match the height of Y");
         if( A.Height() != X.Height() )
             LogicError("The height of A must match the height of X");
-
-        // Form and pack the updates to Y
         const bool conjugate = ( orientation == ADJOINT );
+
+        // Post the receives for the updates to our portion of Y
+        const Int numRecvInds = meta.sendInds.size();
+        std::vector<T> recvVals( numRecvInds*b );
+        std::vector<mpi::Request> recvRequests( numSendNeighbors );
+        for( int q=0, k=0; q<commSize; ++q )
+            if( q != commRank && meta.sendSizes[q] != 0 )
+                mpi::IRecv
+                ( &recvVals[meta.sendOffs[q]*b], meta.sendSizes[q]*b, q, comm,
+                  recvRequests[k++] );
+
+        // Form the updates destined for other processes first so that they
+        // may be sent while the updates to our portion of Y are formed
         std::vector<T> sendVals( meta.numRecvInds*b, 0 );
-        const Int ALocalHeight = A.LocalHeight();
-        for( Int iLocal=0; iLocal<ALocalHeight; ++iLocal )
+        const T* XBuf = X.LockedMatrix().LockedBuffer();
+        const Int XLDim = X.LockedMatrix().LDim();
+        const bool threaded = 
+          multiply::ThreadAdjoint( A.NumLocalEntries(), b );
+        const T* XPanel = XBuf;
+        Int ldXPanel = 1;
+        std::vector<T> XPanelVec;
+        if( haveEntries && threaded )
         {
-            const Int off = A.EntryOffset( iLocal );
-            const Int rowSize = A.NumConnections( iLocal );
-            for( Int k=0; k<rowSize; ++k )
+            multiply::EnsureTransposeStructure
+            ( ALocalHeight, meta.numRecvInds, offs, colOffs,
+              meta.transposeMeta );
+            if( b > 1 )
             {
-                const Int colOff = meta.colOffs[k+off];
-                const T AVal = A.Value(k+off);
-                for( Int t=0; t<b; ++t )
-                {
-                    const T XVal = X.GetLocal(iLocal,t);
-                    if( conjugate )
-                        sendVals[colOff*b+t] += alpha*Conj(AVal)*XVal;
-                    else
-                        sendVals[colOff*b+t] += alpha*AVal*XVal;
-                }
+                XPanelVec.resize( ALocalHeight*b );
+                multiply::PackRowPanel
+                ( 0, ALocalHeight, X.LockedMatrix(), XPanelVec.data(), b );
+                XPanel = XPanelVec.data();
+                ldXPanel = b;
             }
+            multiply::TransposedMultiply
+            ( conjugate, 0, selfRecvOff, b, alpha, meta.transposeMeta, vals,
+              XPanel, ldXPanel, sendVals.data(), b );
+            multiply::TransposedMultiply
+            ( conjugate, selfRecvOff+selfSize, meta.numRecvInds, b, alpha,
+              meta.transposeMeta, vals,
+              XPanel, ldXPanel, sendVals.data(), b );
         }
+        else if( haveEntries )
+        {
+            multiply::AdjointScatter
+            ( conjugate, ALocalHeight, b, alpha, offs, localBegs, colOffs, vals,
+              XBuf, XLDim, sendVals.data(), b );
+            multiply::AdjointScatter
+            ( conjugate, ALocalHeight, b, alpha, localEnds, offs+1, colOffs, 
+              vals, XBuf, XLDim, sendVals.data(), b );
+        }
+        std::vector<mpi::Request> sendRequests( numRecvNeighbors );
+        for( int q=0, k=0; q<commSize; ++q )
+            if( q != commRank && meta.recvSizes[q] != 0 )
+                mpi::ISend
+                ( &sendVals[meta.recvOffs[q]*b], meta.recvSizes[q]*b, q, comm,
+                  sendRequests[k++] );
 
-        // Inject the updates to Y into the network
-        const Int numRecvInds = meta.sendInds.size();
-        std::vector<T> recvVals( numRecvInds*b );
-        mpi::AllToAll
-        ( sendVals.data(), recvSizes.data(), recvOffs.data(),
-          recvVals.data(), sendSizes.data(), sendOffs.data(), comm );
+        // Form the updates to our own portion of Y
+        if( haveEntries && threaded )
+            multiply::TransposedMultiply
+            ( conjugate, selfRecvOff, selfRecvOff+selfSize, b, alpha,
+              meta.transposeMeta, vals, 
+              XPanel, ldXPanel, sendVals.data(), b );
+        else if( haveEntries )
+            multiply::AdjointScatter
+            ( conjugate, ALocalHeight, b, alpha, localBegs, localEnds, colOffs,
+              vals, XBuf, XLDim, sendVals.data(), b );
+        MemCopy( &recvVals[selfSendOff*b], &sendVals[selfRecvOff*b], selfSize*b );
      
-        // Accumulate the received indices onto Y
+        // Accumulate the received updates onto Y
+        mpi::WaitAll( numSendNeighbors, recvRequests.data() );
         const Int firstLocalRow = Y.FirstLocalRow();
+        T* YBuf = Y.Matrix().Buffer();
+        const Int YLDim = Y.Matrix().LDim();
         for( Int s=0; s<numRecvInds; ++s )
         {
-            const Int i = meta.sendInds[s];
-            const Int iLocal = i - firstLocalRow;
+            const Int iLocal = meta.sendInds[s] - firstLocalRow;
             DEBUG_ONLY(
                 if( iLocal < 0 || iLocal >= Y.LocalHeight() )
                     LogicError("iLocal was out of bounds: ",iLocal,
                                 " not in [0,",Y.LocalHeight(),")");
             )
             for( Int t=0; t<b; ++t )
-                Y.UpdateLocal( iLocal, t, recvVals[s*b+t] );
+                YBuf[iLocal+t*YLDim] += recvVals[s*b+t];
         }
+        mpi::WaitAll( numRecvNeighbors, sendRequests.data() );
     }
 }
 
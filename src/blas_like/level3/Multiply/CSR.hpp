@@ -0,0 +1,419 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_MULTIPLY_CSR_HPP
+#define EL_MULTIPLY_CSR_HPP
+
+#include <mutex>
+
+namespace El {
+namespace multiply {
+
+// Kernels which act directly upon compressed sparse row (CSR) buffers, i.e.,
+// the nonzeros of row i of A are stored in [offs[i],offs[i+1]), with column
+// indices 'colInds' and values accessed through a 'Values' object. The
+// product kernels instead accept the nonzeros of row i as [begs[i],ends[i])
+// so that they may be applied to a subset of each row; passing offs and
+// offs+1 traverses the entire matrix.
+//
+// Multi-vectors which are accessed indirectly (X in the normal case and Y in
+// the transposed case) are stored as row-major panels, so that each nonzero
+// of A touches a contiguous strip of length b which the compiler can
+// vectorize. Rows of a panel are separated by 'ldPanel' entries. Entry (i,t)
+// of the (directly accessed) output Y is stored at Y[i*yRowStride+t*yColStride]
+// so that both column-major matrices and row-major panels may be updated.
+
+// Direct access to the values of A
+template<typename T>
+struct DirectValues
+{
+    const T* EL_RESTRICT vals;
+    DirectValues( const T* vals_ ) : vals(vals_) { }
+    T operator[]( Int e ) const { return vals[e]; }
+};
+
+// Access to the values of A^T or A^H through the permutation stored by a
+// cached transposed structure
+template<typename T,bool conjugate>
+struct PermutedValues
+{
+    const T* EL_RESTRICT vals;
+    const Int* EL_RESTRICT perm;
+    PermutedValues( const T* vals_, const Int* perm_ )
+    : vals(vals_), perm(perm_) { }
+    T operator[]( Int e ) const
+    { return ( conjugate ? Conj(vals[perm[e]]) : vals[perm[e]] ); }
+};
+
+// Form a row-major copy of rows [iBeg,iEnd) of X
+template<typename T>
+inline void
+PackRowPanel
+( Int iBeg, Int iEnd, const Matrix<T>& X, T* EL_RESTRICT XPanel, Int ldPanel )
+{
+    DEBUG_ONLY(CallStackEntry cse("multiply::PackRowPanel"))
+    const Int b = X.Width();
+    const Int ldX = X.LDim();
+    const T* EL_RESTRICT XBuf = X.LockedBuffer();
+    EL_PARALLEL_FOR
+    for( Int i=iBeg; i<iEnd; ++i )
+        for( Int t=0; t<b; ++t )
+            XPanel[i*ldPanel+t] = XBuf[i+t*ldX];
+}
+
+// Y(iBeg:iEnd-1,:) += YPanel(iBeg:iEnd-1,:)
+template<typename T>
+inline void
+UpdateFromRowPanel
+( Int iBeg, Int iEnd, const T* EL_RESTRICT YPanel, Int ldPanel, Matrix<T>& Y )
+{
+    DEBUG_ONLY(CallStackEntry cse("multiply::UpdateFromRowPanel"))
+    const Int b = Y.Width();
+    const Int ldY = Y.LDim();
+    T* EL_RESTRICT YBuf = Y.Buffer();
+    EL_PARALLEL_FOR
+    for( Int i=iBeg; i<iEnd; ++i )
+        for( Int t=0; t<b; ++t )
+            YBuf[i+t*ldY] += YPanel[i*ldPanel+t];
+}
+
+// Split the rows [iBeg,iEnd) into 'numParts' contiguous pieces with 
+// approximately equal numbers of nonzeros (rather than equal numbers of rows)
+inline void
+PartitionRows
+( Int iBeg, Int iEnd, const Int* offs, Int numParts, 
+  std::vector<Int>& rowSplits )
+{
+    DEBUG_ONLY(CallStackEntry cse("multiply::PartitionRows"))
+    rowSplits.resize( numParts+1 );
+    const double numEntries = offs[iEnd] - offs[iBeg];
+    rowSplits[0] = iBeg;
+    for( Int p=1; p<numParts; ++p )
+    {
+        const Int target = offs[iBeg] + Int((numEntries*p)/numParts);
+        const Int split = 
+          std::lower_bound( offs+iBeg, offs+iEnd+1, target ) - offs;
+        rowSplits[p] = Min( Max(split,rowSplits[p-1]), iEnd );
+    }
+    rowSplits[numParts] = iEnd;
+}
+
+// Form the structure of the transpose of an m x n CSR matrix using a
+// counting sort over the column indices
+inline void
+TransposeStructure
+( Int m, Int n, const Int* offs, const Int* colInds, SparseTransposeMeta& meta )
+{
+    DEBUG_ONLY(CallStackEntry cse("multiply::TransposeStructure"))
+    const Int numEntries = offs[m] - offs[0];
+    meta.offs.assign( n+1, 0 );
+    for( Int e=offs[0]; e<offs[m]; ++e )
+        ++meta.offs[colInds[e]+1];
+    for( Int j=0; j<n; ++j )
+        meta.offs[j+1] += meta.offs[j];
+
+    meta.inds.resize( numEntries );
+    meta.perm.resize( numEntries );
+    std::vector<Int> next( meta.offs.begin(), meta.offs.end()-1 );
+    for( Int i=0; i<m; ++i )
+    {
+        const Int eEnd = offs[i+1];
+        for( Int e=offs[i]; e<eEnd; ++e )
+        {
+            const Int s = next[colInds[e]]++;
+            meta.inds[s] = i;
+            meta.perm[s] = e;
+        }
+    }
+    meta.ready = true;
+}
+
+// The transposed structure is cached within (possibly const) matrices, and so
+// concurrent products with the same matrix must not race to build it
+inline void
+EnsureTransposeStructure
+( Int m, Int n, const Int* offs, const Int* colInds, SparseTransposeMeta& meta )
+{
+    DEBUG_ONLY(CallStackEntry cse("multiply::EnsureTransposeStructure"))
+    static std::mutex mutex;
+    std::lock_guard<std::mutex> lock( mutex );
+    if( !meta.ready )
+        TransposeStructure( m, n, offs, colInds, meta );
+}
+
+// Y(i,0:bBlock-1) += alpha A(i,:) XPanel(:,0:bBlock-1) for i in [iBeg,iEnd),
+// where the bBlock accumulators are held in registers over each row of A
+template<typename T,Int bBlock,class Values>
+inline void
+CSRBlock
+( Int iBeg, Int iEnd, T alpha,
+  const Int* EL_RESTRICT begs, const Int* EL_RESTRICT ends,
+  const Int* EL_RESTRICT colInds, const Values& vals,
+  const T* EL_RESTRICT XPanel, Int ldPanel,
+        T* EL_RESTRICT Y,      Int yRowStride, Int yColStride )
+{
+    for( Int i=iBeg; i<iEnd; ++i )
+    {
+        T acc[bBlock];
+        for( Int t=0; t<bBlock; ++t )
+            acc[t] = 0;
+        const Int eEnd = ends[i];
+        for( Int e=begs[i]; e<eEnd; ++e )
+        {
+            const T AVal = vals[e];
+            const T* EL_RESTRICT xRow = &XPanel[colInds[e]*ldPanel];
+            for( Int t=0; t<bBlock; ++t )
+                acc[t] += AVal*xRow[t];
+        }
+        for( Int t=0; t<bBlock; ++t )
+            Y[i*yRowStride+t*yColStride] += alpha*acc[t];
+    }
+}
+
+// y(i) += alpha A(i,:) x for i in [iBeg,iEnd), where independent partial sums
+// are used to break the dependency chain of the floating-point additions
+template<typename T,class Values>
+inline void
+CSRVector
+( Int iBeg, Int iEnd, T alpha,
+  const Int* EL_RESTRICT begs, const Int* EL_RESTRICT ends,
+  const Int* EL_RESTRICT colInds, const Values& vals,
+  const T* EL_RESTRICT x, T* EL_RESTRICT y, Int yStride )
+{
+    for( Int i=iBeg; i<iEnd; ++i )
+    {
+        T acc0=0, acc1=0, acc2=0, acc3=0;
+        Int e=begs[i];
+        const Int eEnd = ends[i];
+        for( ; e+4<=eEnd; e+=4 )
+        {
+            acc0 += vals[e  ]*x[colInds[e  ]];
+            acc1 += vals[e+1]*x[colInds[e+1]];
+            acc2 += vals[e+2]*x[colInds[e+2]];
+            acc3 += vals[e+3]*x[colInds[e+3]];
+        }
+        for( ; e<eEnd; ++e )
+            acc0 += vals[e]*x[colInds[e]];
+        y[i*yStride] += alpha*((acc0+acc1)+(acc2+acc3));
+    }
+}
+
+// Y(iBeg:iEnd-1,:) += alpha A(iBeg:iEnd-1,:) X, where X is given as a
+// row-major panel
+template<typename T,class Values>
+inline void
+CSRMultiply
+( Int iBeg, Int iEnd, Int b, T alpha,
+  const Int* begs, const Int* ends, const Int* colInds, const Values& vals,
+  const T* XPanel, Int ldPanel, T* Y, Int yRowStride, Int yColStride )
+{
+    DEBUG_ONLY(CallStackEntry cse("multiply::CSRMultiply"))
+    if( b == 1 )
+    {
+        CSRVector
+        ( iBeg, iEnd, alpha, begs, ends, colInds, vals, XPanel, Y, yRowStride );
+        return;
+    }
+    Int t=0;
+    for( ; t+8<=b; t+=8 )
+        CSRBlock<T,8>
+        ( iBeg, iEnd, alpha, begs, ends, colInds, vals,
+          &XPanel[t], ldPanel, &Y[t*yColStride], yRowStride, yColStride );
+    if( b-t >= 4 )
+    {
+        CSRBlock<T,4>
+        ( iBeg, iEnd, alpha, begs, ends, colInds, vals,
+          &XPanel[t], ldPanel, &Y[t*yColStride], yRowStride, yColStride );
+        t += 4;
+    }
+    if( b-t >= 2 )
+    {
+        CSRBlock<T,2>
+        ( iBeg, iEnd, alpha, begs, ends, colInds, vals,
+          &XPanel[t], ldPanel, &Y[t*yColStride], yRowStride, yColStride );
+        t += 2;
+    }
+    if( b-t == 1 )
+        CSRBlock<T,1>
+        ( iBeg, iEnd, alpha, begs, ends, colInds, vals,
+          &XPanel[t], ldPanel, &Y[t*yColStride], yRowStride, yColStride );
+}
+
+// Y(iBeg:iEnd-1,:) += alpha A(iBeg:iEnd-1,:) X, where the rows are split
+// between the available threads so that each receives roughly the same number
+// of nonzeros (as measured by the full row offsets 'offs'). Since each thread
+// owns a disjoint set of rows of Y, no synchronization is required.
+template<typename T,class Values>
+inline void
+ThreadedCSRMultiply
+( Int iBeg, Int iEnd, Int b, T alpha, const Int* offs,
+  const Int* begs, const Int* ends, const Int* colInds, const Values& vals,
+  const T* XPanel, Int ldPanel, T* Y, Int yRowStride, Int yColStride )
+{
+    DEBUG_ONLY(CallStackEntry cse("multiply::ThreadedCSRMultiply"))
+    // Avoid the overhead of a parallel region for small products
+    const double work = double(offs[iEnd]-offs[iBeg])*b;
+    const Int numThreads = ( work < 10000 ? 1 : NumThreads() );
+    if( numThreads == 1 )
+    {
+        CSRMultiply
+        ( iBeg, iEnd, b, alpha, begs, ends, colInds, vals, XPanel, ldPanel,
+          Y, yRowStride, yColStride );
+        return;
+    }
+
+    std::vector<Int> rowSplits;
+    PartitionRows( iBeg, iEnd, offs, numThreads, rowSplits );
+    EL_PARALLEL_FOR
+    for( Int p=0; p<numThreads; ++p )
+        CSRMultiply
+        ( rowSplits[p], rowSplits[p+1], b, alpha, begs, ends, colInds, vals,
+          XPanel, ldPanel, Y, yRowStride, yColStride );
+}
+
+// YPanel(j,:) += alpha A(i,j)^{T/H} X(i,:) for each nonzero in rows [iBeg,iEnd)
+// of A. Since Y is a row-major panel, each nonzero results in a single
+// contiguous update of length b rather than b strided updates.
+template<typename T,bool conjugate>
+inline void
+CSRAdjointScatter
+( Int iBeg, Int iEnd, Int b, T alpha,
+  const Int* EL_RESTRICT begs, const Int* EL_RESTRICT ends,
+  const Int* EL_RESTRICT colInds, const T* EL_RESTRICT vals,
+  const T* EL_RESTRICT X,      Int ldX,
+        T* EL_RESTRICT YPanel, Int ldPanel )
+{
+    DEBUG_ONLY(CallStackEntry cse("multiply::CSRAdjointScatter"))
+    if( b == 1 )
+    {
+        for( Int i=iBeg; i<iEnd; ++i )
+        {
+            const T xi = alpha*X[i];
+            const Int eEnd = ends[i];
+            for( Int e=begs[i]; e<eEnd; ++e )
+            {
+                const T AVal = ( conjugate ? Conj(vals[e]) : vals[e] );
+                YPanel[colInds[e]*ldPanel] += AVal*xi;
+            }
+        }
+        return;
+    }
+
+    std::vector<T> xRowVec( b );
+    T* EL_RESTRICT xRow = xRowVec.data();
+    for( Int i=iBeg; i<iEnd; ++i )
+    {
+        for( Int t=0; t<b; ++t )
+            xRow[t] = alpha*X[i+t*ldX];
+        const Int eEnd = ends[i];
+        for( Int e=begs[i]; e<eEnd; ++e )
+        {
+            const T AVal = ( conjugate ? Conj(vals[e]) : vals[e] );
+            T* EL_RESTRICT yRow = &YPanel[colInds[e]*ldPanel];
+            for( Int t=0; t<b; ++t )
+                yRow[t] += AVal*xRow[t];
+        }
+    }
+}
+
+// Scatter alpha A^{T/H} X into the row-major panel YPanel, where only the
+// nonzeros of row i of A in [begs[i],ends[i]) are used
+template<typename T>
+inline void
+AdjointScatter
+( bool conjugate, Int m, Int b, T alpha,
+  const Int* begs, const Int* ends, const Int* colInds, const T* vals,
+  const T* X, Int ldX, T* YPanel, Int ldPanel )
+{
+    if( conjugate )
+        CSRAdjointScatter<T,true>
+        ( 0, m, b, alpha, begs, ends, colInds, vals, X, ldX, YPanel, ldPanel );
+    else
+        CSRAdjointScatter<T,false>
+        ( 0, m, b, alpha, begs, ends, colInds, vals, X, ldX, YPanel, ldPanel );
+}
+
+// Whether or not a transposed/adjoint product of the given size should be
+// threaded by traversing a cached transposed structure
+inline bool
+ThreadAdjoint( Int numEntries, Int b )
+{ return double(numEntries)*b >= 10000 && NumThreads() > 1; }
+
+// YPanel(jBeg:jEnd-1,:) += alpha (A^{T/H})(jBeg:jEnd-1,:) XPanel using the
+// cached transposed structure, so that each thread owns a disjoint set of
+// rows of YPanel
+template<typename T>
+inline void
+TransposedMultiply
+( bool conjugate, Int jBeg, Int jEnd, Int b, T alpha, 
+  const SparseTransposeMeta& transMeta, const T* vals,
+  const T* XPanel, Int ldXPanel, T* YPanel, Int ldPanel )
+{
+    DEBUG_ONLY(CallStackEntry cse("multiply::TransposedMultiply"))
+    const Int* offs = transMeta.offs.data();
+    if( conjugate )
+        ThreadedCSRMultiply
+        ( jBeg, jEnd, b, alpha, offs, offs, offs+1, transMeta.inds.data(),
+          PermutedValues<T,true>(vals,transMeta.perm.data()),
+          XPanel, ldXPanel, YPanel, ldPanel, 1 );
+    else
+        ThreadedCSRMultiply
+        ( jBeg, jEnd, b, alpha, offs, offs, offs+1, transMeta.inds.data(),
+          PermutedValues<T,false>(vals,transMeta.perm.data()),
+          XPanel, ldXPanel, YPanel, ldPanel, 1 );
+}
+
+// Y += alpha A^{T/H} X for an m x n CSR matrix A. A single thread scatters
+// into the row-major panel YPanel; multiple threads instead traverse the
+// (cached) transposed structure.
+template<typename T>
+inline void
+AdjointMultiply
+( bool conjugate, Int m, Int n, Int b, T alpha,
+  const Int* offs, const Int* colInds, const T* vals,
+  SparseTransposeMeta& transMeta,
+  const T* X, Int ldX, T* YPanel, Int ldPanel )
+{
+    DEBUG_ONLY(CallStackEntry cse("multiply::AdjointMultiply"))
+    if( !ThreadAdjoint( offs[m]-offs[0], b ) )
+    {
+        AdjointScatter
+        ( conjugate, m, b, alpha, offs, offs+1, colInds, vals,
+          X, ldX, YPanel, ldPanel );
+        return;
+    }
+
+    EnsureTransposeStructure( m, n, offs, colInds, transMeta );
+
+    // Form a row-major copy of X unless it is a single column
+    const T* XPanel = X;
+    Int ldXPanel = 1;
+    std::vector<T> XPanelVec;
+    if( b > 1 )
+    {
+        XPanelVec.resize( m*b );
+        EL_PARALLEL_FOR
+        for( Int i=0; i<m; ++i )
+            for( Int t=0; t<b; ++t )
+                XPanelVec[i*b+t] = X[i+t*ldX];
+        XPanel = XPanelVec.data();
+        ldXPanel = b;
+    }
+
+    TransposedMultiply
+    ( conjugate, 0, n, b, alpha, transMeta, vals,
+      XPanel, ldXPanel, YPanel, ldPanel );
+}
+
+} // namespace multiply
+} // namespace El
+
+#endif // ifndef EL_MULTIPLY_CSR_HPP
@@ -1866,6 +1866,194 @@ void AbstractBlockDistMatrix<T>::ShallowSwap( AbstractBlockDistMatrix<T>& A )
     std::swap( grid_, A.grid_ );
 }
 
+// Redistribute from an arbitrary block distribution
+// =================================================
+// NOTE: The alignments, cuts, and size of this matrix must already be set.
+//       Each process only ever touches its own local data: the send and
+//       recv sets are formed from the owners of our local rows and columns
+//       in the other distribution, and each pair of processes exchanges at
+//       most one packed message.
+
+template<typename T>
+void AbstractBlockDistMatrix<T>::RedistributeFrom
+( const AbstractBlockDistMatrix<T>& A )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("ABDM::RedistributeFrom");
+        AssertNotLocked();
+        AssertSameSize( A.Height(), A.Width() );
+        if( !mpi::Congruent( A.Grid().ViewingComm(), Grid().ViewingComm() ) )
+            LogicError("Redistributions require congruent viewing comms");
+    )
+    mpi::Comm comm = Grid().ViewingComm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const bool inA = A.Participating();
+    const bool inB = Participating();
+
+    // Every process advertises its team in both distributions so that the
+    // owners of any portion of either matrix can be computed locally
+    const int myTeams[4] =
+        { inA ? int(A.ColRank()) : -1, inA ? int(A.RowRank()) : -1,
+          inB ? int(ColRank())   : -1, inB ? int(RowRank())   : -1 };
+    std::vector<int> teams(4*commSize);
+    mpi::AllGather( myTeams, 4, teams.data(), 4, comm );
+
+    // Form the (ascending) list of processes holding each local matrix
+    const Int colStrideA = A.ColStride();
+    const Int rowStrideA = A.RowStride();
+    const Int colStride = ColStride();
+    const Int rowStride = RowStride();
+    std::vector<std::vector<int>> holdersA(colStrideA*rowStrideA),
+                                  holders(colStride*rowStride);
+    for( int q=0; q<commSize; ++q )
+    {
+        if( teams[4*q] >= 0 )
+            holdersA[teams[4*q]+teams[4*q+1]*colStrideA].push_back( q );
+        if( teams[4*q+2] >= 0 )
+            holders[teams[4*q+2]+teams[4*q+3]*colStride].push_back( q );
+    }
+    DEBUG_ONLY(
+        for( const auto& team : holdersA )
+            if( team.empty() )
+                LogicError("A portion of the source matrix had no owner");
+        for( const auto& team : holders )
+            if( team.empty() )
+                LogicError("A portion of the target matrix had no owner");
+    )
+
+    // When a local matrix is redundantly stored, the k'th holder of each
+    // target team receives from the (k mod r)'th holder of each source team,
+    // where r is the number of redundant copies of the source
+    std::vector<int> sendCounts(commSize,0), recvCounts(commSize,0);
+    std::vector<std::vector<Int>> sendRows, sendCols, recvRows, recvCols;
+    std::vector<int> sendTargets, sendTeams, recvSources, recvTeams;
+    if( inA )
+    {
+        const Int mLocalA = A.LocalHeight();
+        const Int nLocalA = A.LocalWidth();
+        sendRows.resize( colStride );
+        sendCols.resize( rowStride );
+        for( Int iLoc=0; iLoc<mLocalA; ++iLoc )
+            sendRows[RowOwner(A.GlobalRow(iLoc))].push_back( iLoc );
+        for( Int jLoc=0; jLoc<nLocalA; ++jLoc )
+            sendCols[ColOwner(A.GlobalCol(jLoc))].push_back( jLoc );
+
+        const auto& myHolders = holdersA[A.ColRank()+A.RowRank()*colStrideA];
+        const Int numCopies = myHolders.size();
+        const Int myCopy =
+            std::find( myHolders.begin(), myHolders.end(), commRank ) -
+            myHolders.begin();
+        for( Int t=0; t<rowStride; ++t )
+        {
+            for( Int s=0; s<colStride; ++s )
+            {
+                const Int team = s + t*colStride;
+                const auto& targets = holders[team];
+                const int count = sendRows[s].size()*sendCols[t].size();
+                if( count == 0 )
+                    continue;
+                for( Int k=myCopy; k<Int(targets.size()); k+=numCopies )
+                {
+                    sendCounts[targets[k]] = count;
+                    sendTargets.push_back( targets[k] );
+                    sendTeams.push_back( team );
+                }
+            }
+        }
+    }
+    if( inB )
+    {
+        const Int mLocal = LocalHeight();
+        const Int nLocal = LocalWidth();
+        recvRows.resize( colStrideA );
+        recvCols.resize( rowStrideA );
+        for( Int iLoc=0; iLoc<mLocal; ++iLoc )
+            recvRows[A.RowOwner(GlobalRow(iLoc))].push_back( iLoc );
+        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
+            recvCols[A.ColOwner(GlobalCol(jLoc))].push_back( jLoc );
+
+        const auto& myHolders = holders[ColRank()+RowRank()*colStride];
+        const Int myCopy =
+            std::find( myHolders.begin(), myHolders.end(), commRank ) -
+            myHolders.begin();
+        for( Int t=0; t<rowStrideA; ++t )
+        {
+            for( Int s=0; s<colStrideA; ++s )
+            {
+                const Int team = s + t*colStrideA;
+                const auto& sources = holdersA[team];
+                const int count = recvRows[s].size()*recvCols[t].size();
+                if( count == 0 )
+                    continue;
+                const int source = sources[myCopy % sources.size()];
+                recvCounts[source] = count;
+                recvSources.push_back( source );
+                recvTeams.push_back( team );
+            }
+        }
+    }
+
+    // Translate the counts into displacements
+    std::vector<int> sendDispls(commSize), recvDispls(commSize);
+    int totalSend=0, totalRecv=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        sendDispls[q] = totalSend;
+        recvDispls[q] = totalRecv;
+        totalSend += sendCounts[q];
+        totalRecv += recvCounts[q];
+    }
+
+    // Pack in the column-major order of the global indices, which is the
+    // order that the recipient will traverse its own local matrix in
+    std::vector<T> sendBuf(totalSend), recvBuf(totalRecv);
+    const T* ABuf = A.LockedBuffer();
+    const Int ALDim = A.LDim();
+    const Int numSends = sendTargets.size();
+    EL_PARALLEL_FOR
+    for( Int send=0; send<numSends; ++send )
+    {
+        const Int team = sendTeams[send];
+        const auto& rows = sendRows[team % colStride];
+        const auto& cols = sendCols[team / colStride];
+        T* sendData = &sendBuf[sendDispls[sendTargets[send]]];
+        const Int numRows = rows.size();
+        for( const Int jLoc : cols )
+        {
+            const T* ACol = &ABuf[jLoc*ALDim];
+            for( Int k=0; k<numRows; ++k )
+                sendData[k] = ACol[rows[k]];
+            sendData += numRows;
+        }
+    }
+
+    mpi::SparseAllToAll
+    ( sendBuf, sendCounts, sendDispls,
+      recvBuf, recvCounts, recvDispls, comm );
+
+    // Unpack
+    T* buffer = Buffer();
+    const Int ldim = LDim();
+    const Int numRecvs = recvSources.size();
+    EL_PARALLEL_FOR
+    for( Int recv=0; recv<numRecvs; ++recv )
+    {
+        const Int team = recvTeams[recv];
+        const auto& rows = recvRows[team % colStrideA];
+        const auto& cols = recvCols[team / colStrideA];
+        const T* recvData = &recvBuf[recvDispls[recvSources[recv]]];
+        const Int numRows = rows.size();
+        for( const Int jLoc : cols )
+        {
+            T* col = &buffer[jLoc*ldim];
+            for( Int k=0; k<numRows; ++k )
+                col[rows[k]] = recvData[k];
+            recvData += numRows;
+        }
+    }
+}
+
 // Modify the distribution metadata
 // ================================
 
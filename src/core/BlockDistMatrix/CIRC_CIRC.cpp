@@ -49,7 +49,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [MD,STAR]"))
-    LogicError("This routine is not yet written");
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -57,7 +60,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,STAR,MD>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [STAR,MD]"))
-    LogicError("This routine is not yet written");
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -200,7 +206,10 @@ void BDM::CollectFrom( const BlockDistMatrix<T,U,V>& A )
     this->Align( mb, nb, 0, 0, false );
     this->Resize( m, n );
     if( A.RedundantSize() != 1 )
-        LogicError("This routine does not yet support non-trivial redundancy");
+    {
+        this->RedistributeFrom( A );
+        return;
+    }
     if( !A.Grid().InGrid() )
         return;
 
@@ -291,9 +300,11 @@ template<Dist U,Dist V>
 void BDM::Scatter( BlockDistMatrix<T,U,V>& A ) const
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC]::Scatter"))
-    if( A.CrossSize() != 1 )
-        LogicError("This routine does not yet support non-trivial cross-teams");
-    LogicError("This routine is not yet written");
+    A.AlignAndResize
+    ( this->BlockHeight(), this->BlockWidth(), 0, 0,
+      this->ColCut(), this->RowCut(), this->Height(), this->Width(),
+      false, false );
+    A.RedistributeFrom( *this );
 }
 
 // Instantiate {Int,Real,Complex<Real>} for each Real in {float,double}
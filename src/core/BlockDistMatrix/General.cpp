@@ -128,93 +128,9 @@ GeneralBlockDistMatrix<T,U,V>::Translate( BlockDistMatrix<T,U,V>& A ) const
         colAlign    == A.ColAlign()    && rowAlign   == A.RowAlign() &&
         colCut      == A.ColCut()      && rowCut     == A.RowCut();
     if( aligned && root == A.Root() )
-    {
         A.matrix_ = this->matrix_;
-    }
     else
-    {
-        // TODO: Implement this in a more efficient manner, perhaps through
-        //       many rounds of point-to-point communication
-        // TODO: Turn this into a general routine for redistributing
-        //       between any matrix distributions supported by Elemental.
-        //       The key addition is mpi::Translate.
-        const Int distSize = A.DistSize();
-        const Int mLocal = this->LocalHeight();
-        const Int nLocal = this->LocalWidth();
-        const Int mLocalA = A.LocalHeight();
-        const Int nLocalA = A.LocalWidth();
-
-        // Determine how much data our process sends and recvs from every 
-        // other process
-        std::vector<int> sendCounts(distSize,0),
-                         recvCounts(distSize,0);
-        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-        {
-            const Int j = this->GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            {
-                const Int i = this->GlobalRow(iLoc);
-                const Int owner = A.Owner(i,j);
-                ++sendCounts[owner];
-            }
-        }
-        for( Int jLoc=0; jLoc<nLocalA; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<mLocalA; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int owner = this->Owner(i,j);
-                ++recvCounts[owner];
-            }
-        }
-
-        // Translate the send/recv counts into displacements and allocate
-        // the send and recv buffers
-        std::vector<int> sendDispls(distSize), recvDispls(distSize);
-        int totalSend=0, totalRecv=0; 
-        for( int q=0; q<distSize; ++q )
-        {
-            sendDispls[q] = totalSend;
-            recvDispls[q] = totalRecv;
-            totalSend += sendCounts[q];
-            totalRecv += recvCounts[q];
-        }
-        std::vector<T> sendBuf(totalSend), recvBuf(totalRecv);
-
-        // Pack the send data
-        std::vector<int> offsets = sendDispls;
-        for( Int jLoc=0; jLoc<nLocal; ++jLoc )
-        {
-            const Int j = this->GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<mLocal; ++iLoc )
-            {
-                const Int i = this->GlobalRow(iLoc);
-                const Int owner = A.Owner(i,j);
-                sendBuf[offsets[owner]++] = this->GetLocal(iLoc,jLoc);
-            }
-        }
-
-        // Perform the all-to-all communication
-        mpi::AllToAll
-        ( sendBuf.data(), sendCounts.data(), sendDispls.data(),
-          recvBuf.data(), recvCounts.data(), recvDispls.data(), 
-          this->DistComm() );
-        SwapClear( sendBuf );
-
-        // Unpack the received data
-        offsets = recvDispls;
-        for( Int jLoc=0; jLoc<nLocalA; ++jLoc )
-        {
-            const Int j = A.GlobalCol(jLoc);
-            for( Int iLoc=0; iLoc<mLocalA; ++iLoc )
-            {
-                const Int i = A.GlobalRow(iLoc);
-                const Int owner = this->Owner(i,j);
-                A.SetLocal( iLoc, jLoc, recvBuf[offsets[owner]++] );
-            }
-        }
-    }
+        A.RedistributeFrom( *this );
 }
 
 template<typename T,Dist U,Dist V>
@@ -226,7 +142,9 @@ GeneralBlockDistMatrix<T,U,V>::AllGather
         CallStackEntry cse("GBDM::AllGather");
         AssertSameGrids( *this, A );
     )
-    LogicError("This routine is not yet written");
+    A.SetGrid( this->Grid() );
+    A.Resize( this->Height(), this->Width() );
+    A.RedistributeFrom( *this );
 }
 
 template<typename T,Dist U,Dist V>
@@ -238,7 +156,10 @@ GeneralBlockDistMatrix<T,U,V>::ColAllGather
         CallStackEntry cse("GBDM::ColAllGather");
         AssertSameGrids( *this, A );
     )
-    LogicError("This routine is not yet written");
+    A.AlignRowsAndResize
+    ( this->BlockWidth(), this->RowAlign(), this->RowCut(),
+      this->Height(), this->Width(), false, false );
+    A.RedistributeFrom( *this );
 }
 
 template<typename T,Dist U,Dist V>
@@ -250,7 +171,10 @@ GeneralBlockDistMatrix<T,U,V>::RowAllGather
         CallStackEntry cse("GBDM::RowAllGather");
         AssertSameGrids( *this, A );
     )
-    LogicError("This routine is not yet written");
+    A.AlignColsAndResize
+    ( this->BlockHeight(), this->ColAlign(), this->ColCut(),
+      this->Height(), this->Width(), false, false );
+    A.RedistributeFrom( *this );
 }
 
 template<typename T,Dist U,Dist V>
@@ -262,7 +186,10 @@ GeneralBlockDistMatrix<T,U,V>::PartialColAllGather
         CallStackEntry cse("GBDM::PartialColAllGather");
         AssertSameGrids( *this, A );
     )
-    LogicError("This routine is not yet written");
+    A.AlignColsAndResize
+    ( this->BlockHeight(), this->ColAlign()%A.ColStride(), this->ColCut(),
+      this->Height(), this->Width(), false, false );
+    A.RedistributeFrom( *this );
 }
 
 template<typename T,Dist U,Dist V>
@@ -274,7 +201,10 @@ GeneralBlockDistMatrix<T,U,V>::PartialRowAllGather
         CallStackEntry cse("GBDM::PartialRowAllGather");
         AssertSameGrids( *this, A );
     )
-    LogicError("This routine is not yet written");
+    A.AlignRowsAndResize
+    ( this->BlockWidth(), this->RowAlign()%A.RowStride(), this->RowCut(),
+      this->Height(), this->Width(), false, false );
+    A.RedistributeFrom( *this );
 }
 
 template<typename T,Dist U,Dist V>
@@ -286,7 +216,8 @@ GeneralBlockDistMatrix<T,U,V>::FilterFrom
         CallStackEntry cse("GBDM::FilterFrom");
         AssertSameGrids( *this, A );
     )
-    LogicError("This routine is not yet written");
+    this->Resize( A.Height(), A.Width() );
+    this->RedistributeFrom( A );
 }
 
 template<typename T,Dist U,Dist V>
@@ -298,7 +229,10 @@ GeneralBlockDistMatrix<T,U,V>::ColFilterFrom
         CallStackEntry cse("GBDM::ColFilterFrom");
         AssertSameGrids( *this, A );
     )
-    LogicError("This routine is not yet written");
+    this->AlignRowsAndResize
+    ( A.BlockWidth(), A.RowAlign(), A.RowCut(), A.Height(), A.Width(),
+      false, false );
+    this->RedistributeFrom( A );
 }
 
 template<typename T,Dist U,Dist V>
@@ -310,7 +244,10 @@ GeneralBlockDistMatrix<T,U,V>::RowFilterFrom
         CallStackEntry cse("GBDM::RowFilterFrom");
         AssertSameGrids( *this, A );
     )
-    LogicError("This routine is not yet written");
+    this->AlignColsAndResize
+    ( A.BlockHeight(), A.ColAlign(), A.ColCut(), A.Height(), A.Width(),
+      false, false );
+    this->RedistributeFrom( A );
 }
 
 template<typename T,Dist U,Dist V>
@@ -322,7 +259,10 @@ GeneralBlockDistMatrix<T,U,V>::PartialColFilterFrom
         CallStackEntry cse("GBDM::PartialColFilterFrom");
         AssertSameGrids( *this, A );
     )
-    LogicError("This routine is not yet written");
+    this->AlignColsAndResize
+    ( A.BlockHeight(), A.ColAlign(), A.ColCut(), A.Height(), A.Width(),
+      false, false );
+    this->RedistributeFrom( A );
 }
 
 template<typename T,Dist U,Dist V>
@@ -334,7 +274,10 @@ GeneralBlockDistMatrix<T,U,V>::PartialRowFilterFrom
         CallStackEntry cse("GBDM::PartialRowFilterFrom");
         AssertSameGrids( *this, A );
     )
-    LogicError("This routine is not yet written");
+    this->AlignRowsAndResize
+    ( A.BlockWidth(), A.RowAlign(), A.RowCut(), A.Height(), A.Width(),
+      false, false );
+    this->RedistributeFrom( A );
 }
 
 template<typename T,Dist U,Dist V>
@@ -346,7 +289,10 @@ GeneralBlockDistMatrix<T,U,V>::PartialColAllToAllFrom
         CallStackEntry cse("GBDM::PartialColAllToAllFrom");
         AssertSameGrids( *this, A );
     )
-    LogicError("This routine is not yet written");
+    this->AlignColsAndResize
+    ( A.BlockHeight(), A.ColAlign(), A.ColCut(), A.Height(), A.Width(),
+      false, false );
+    this->RedistributeFrom( A );
 }
 
 template<typename T,Dist U,Dist V>
@@ -358,7 +304,10 @@ GeneralBlockDistMatrix<T,U,V>::PartialRowAllToAllFrom
         CallStackEntry cse("GBDM::PartialRowAllToAllFrom");
         AssertSameGrids( *this, A );
     )
-    LogicError("This routine is not yet written");
+    this->AlignRowsAndResize
+    ( A.BlockWidth(), A.RowAlign(), A.RowCut(), A.Height(), A.Width(),
+      false, false );
+    this->RedistributeFrom( A );
 }
 
 template<typename T,Dist U,Dist V>
@@ -370,7 +319,10 @@ GeneralBlockDistMatrix<T,U,V>::PartialColAllToAll
         CallStackEntry cse("GBDM::PartialColAllToAll");
         AssertSameGrids( *this, A );
     )
-    LogicError("This routine is not yet written");
+    A.AlignColsAndResize
+    ( this->BlockHeight(), this->ColAlign()%A.ColStride(), this->ColCut(),
+      this->Height(), this->Width(), false, false );
+    A.RedistributeFrom( *this );
 }
 
 template<typename T,Dist U,Dist V>
@@ -382,7 +334,10 @@ GeneralBlockDistMatrix<T,U,V>::PartialRowAllToAll
         CallStackEntry cse("GBDM::PartialRowAllToAll");
         AssertSameGrids( *this, A );
     )
-    LogicError("This routine is not yet written");
+    A.AlignRowsAndResize
+    ( this->BlockWidth(), this->RowAlign()%A.RowStride(), this->RowCut(),
+      this->Height(), this->Width(), false, false );
+    A.RedistributeFrom( *this );
 }
 
 template<typename T,Dist U,Dist V>
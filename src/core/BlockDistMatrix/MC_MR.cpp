@@ -52,9 +52,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [MD,STAR]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -62,9 +63,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,STAR,MD>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [STAR,MD]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -72,7 +74,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,MR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [MR,MC]"))
-    LogicError("This routine is not yet written");
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -152,7 +157,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,CIRC,CIRC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [CIRC,CIRC]"))
-    LogicError("This routine is not yet written");
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -191,7 +199,12 @@ template<typename T>
 void BDM::CopyFromDifferentGrid( const BDM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,MR]::CopyFromDifferentGrid"))
-    LogicError("This routine is not yet written");
+    // The alignments of A are relative to its own grid, so only the block
+    // sizes and cuts are inherited
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
 }
 
 // Instantiate {Int,Real,Complex<Real>} for each Real in {float,double}
@@ -52,9 +52,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [MD,STAR]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -62,9 +63,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,STAR,MD>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [STAR,MD]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -166,7 +168,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,CIRC,CIRC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [CIRC,CIRC]"))
-    LogicError("This routine is not yet written");
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
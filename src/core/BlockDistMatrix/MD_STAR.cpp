@@ -25,9 +25,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,MC,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [MC,MR]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR(A);
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -35,9 +36,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,MC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [MC,STAR]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR(A);
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -45,9 +47,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,STAR,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [STAR,MR]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR(A);
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -63,9 +66,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,STAR,MD>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [STAR,MD]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR(A);
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -73,9 +77,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,MR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [MR,MC]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR(A);
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -83,9 +88,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [MR,STAR]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR(A);
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -93,9 +99,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [STAR,MC]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR(A);
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -103,9 +110,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,VC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [VC,STAR]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR(A);
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -113,9 +121,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,STAR,VC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [STAR,VC]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR(A);
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -123,9 +132,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,VR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [VR,STAR]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR(A);
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -133,9 +143,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,STAR,VR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [STAR,VR]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR(A);
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -151,9 +162,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,CIRC,CIRC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [CIRC,CIRC]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR(A);
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
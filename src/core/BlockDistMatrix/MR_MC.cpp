@@ -25,7 +25,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,MC,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [MC,MR]"))
-    LogicError("This routine is not yet written");
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -49,7 +52,7 @@ BDM& BDM::operator=( const BlockDistMatrix<T,STAR,MR>& A )
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [STAR,MR]"))
     auto A_STAR_VR = MakeUnique<BlockDistMatrix<T,STAR,VR>>( A );
     auto A_STAR_VC = MakeUnique<BlockDistMatrix<T,STAR,VC>>( this->Grid() );
-    A_STAR_VR->AlignRowsWith(*this);
+    A_STAR_VC->AlignRowsWith(*this);
     *A_STAR_VC = *A_STAR_VR;
     A_STAR_VR.reset(); 
 
@@ -61,9 +64,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [MD,STAR]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -71,9 +75,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,STAR,MD>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [STAR,MD]"))
-    // TODO: More efficient implementation?
-    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR( A );
-    *this = A_STAR_STAR;
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -147,7 +152,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,CIRC,CIRC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [CIRC,CIRC]"))
-    LogicError("This routine is not yet written");
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -123,13 +123,9 @@ BDM& BDM::operator=( const BDM& A )
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [STAR,STAR]"))
     this->Resize( A.Height(), A.Width() ); 
     if( this->Grid() == A.Grid() )
-    {
         this->matrix_ = A.LockedMatrix();
-    }
     else
-    {
-        LogicError("This option is not yet written");
-    }
+        this->RedistributeFrom( A );
     return *this;
 }
 
@@ -137,7 +133,10 @@ template<typename T>
 BDM& BDM::operator=( const BlockDistMatrix<T,CIRC,CIRC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [CIRC,CIRC]"))
-    LogicError("This routine is not yet written");
+    this->AlignAndResize
+    ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+      A.Height(), A.Width(), false, false );
+    this->RedistributeFrom( A );
     return *this;
 }
 
@@ -105,12 +105,12 @@ BDM::BlockDistMatrix( const AbstractBlockDistMatrix<T>& A )
     #define GUARD(CDIST,RDIST) \
       A.DistData().colDist == CDIST && A.DistData().rowDist == RDIST
     #define PAYLOAD(CDIST,RDIST) \
-      auto& ACast = dynamic_cast<const DistMatrix<T,CDIST,RDIST>&>(A); \
+      auto& ACast = dynamic_cast<const BlockDistMatrix<T,CDIST,RDIST>&>(A); \
       if( ColDist != CDIST || RowDist != RDIST || \
           reinterpret_cast<const BDM*>(&A) != this ) \
           *this = ACast; \
       else \
-          LogicError("Tried to construct DistMatrix with itself");
+          LogicError("Tried to construct BlockDistMatrix with itself");
     #include "El/macros/GuardAndPayload.h"
 }
 
@@ -163,6 +163,15 @@ template<typename T>
 BDM& BDM::operator=( const AbstractBlockDistMatrix<T>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("BDM = ABDM"))
+    if( A.Grid() != this->Grid() )
+    {
+        // The alignments of A are relative to its own grid
+        this->AlignAndResize
+        ( A.BlockHeight(), A.BlockWidth(), 0, 0, A.ColCut(), A.RowCut(),
+          A.Height(), A.Width(), false, false );
+        this->RedistributeFrom( A );
+        return *this;
+    }
     #define GUARD(CDIST,RDIST) \
       A.DistData().colDist == CDIST && A.DistData().rowDist == RDIST
     #define PAYLOAD(CDIST,RDIST) \
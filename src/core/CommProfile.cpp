@@ -0,0 +1,282 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include <iomanip>
+
+#include "./NameUnion.hpp"
+
+namespace {
+using namespace El;
+
+bool profiling = false;
+bool perRankReport = false;
+
+std::map<std::string,CommProfileEntry> redistProfile, collectiveProfile;
+
+// The state of the outermost redistribution in progress
+Int regionDepth = 0;
+struct RegionState
+{
+    std::string name;
+    Clock::time_point start;
+    double numBytes, waitTime;
+    // The local time which preceded the last MPI call
+    double localTime;
+} region;
+
+inline double Seconds( Clock::time_point start, Clock::time_point stop )
+{ return duration_cast<duration<double>>(stop-start).count(); }
+
+inline void Accumulate( CommProfileEntry& entry, const CommProfileEntry& b )
+{
+    entry.numCalls += b.numCalls;
+    entry.numBytes += b.numBytes;
+    entry.packTime += b.packTime;
+    entry.waitTime += b.waitTime;
+    entry.unpackTime += b.unpackTime;
+}
+
+std::string DistName( Dist dist )
+{
+    switch( dist )
+    {
+    case MC:   return "MC";
+    case MD:   return "MD";
+    case MR:   return "MR";
+    case VC:   return "VC";
+    case VR:   return "VR";
+    case STAR: return "STAR";
+    default:   return "CIRC";
+    }
+}
+
+void OpenRegion( const std::string& name )
+{
+    region.name = name;
+    region.numBytes = 0;
+    region.waitTime = 0;
+    region.localTime = 0;
+    region.start = Clock::now();
+}
+
+void CloseRegion()
+{
+    const double totalTime = Seconds( region.start, Clock::now() );
+    CommProfileEntry entry;
+    entry.numCalls = 1;
+    entry.numBytes = region.numBytes;
+    entry.waitTime = region.waitTime;
+    entry.packTime = region.localTime;
+    entry.unpackTime =
+      Max( totalTime-region.waitTime-region.localTime, 0. );
+    Accumulate( redistProfile[region.name], entry );
+}
+
+// The fields of an entry, in the order in which they are communicated
+const Int numFields = 5;
+
+void Pack( const CommProfileEntry& entry, double* buf )
+{
+    buf[0] = entry.numCalls;
+    buf[1] = entry.numBytes;
+    buf[2] = entry.packTime;
+    buf[3] = entry.waitTime;
+    buf[4] = entry.unpackTime;
+}
+
+void PrintHeader( const std::string& title, std::ostream& os )
+{
+    os << std::left << std::setw(44) << title << std::right
+       << std::setw(10) << "calls" << std::setw(12) << "MB"
+       << std::setw(12) << "pack" << std::setw(12) << "wait"
+       << std::setw(12) << "unpack" << "\n";
+}
+
+void PrintRow
+( const std::string& name, double numCalls, double numBytes,
+  double packTime, double waitTime, double unpackTime, std::ostream& os )
+{
+    os << std::left << std::setw(44) << name << std::right
+       << std::setw(10) << Int(numCalls)
+       << std::setw(12) << numBytes/1.e6
+       << std::setw(12) << packTime << std::setw(12) << waitTime
+       << std::setw(12) << unpackTime << "\n";
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void EnableCommProfiling( bool enable, bool perRank )
+{
+    ::profiling = enable;
+    ::perRankReport = perRank;
+}
+
+bool CommProfilingEnabled() { return ::profiling; }
+
+void ResetCommProfile()
+{
+    ::redistProfile.clear();
+    ::collectiveProfile.clear();
+}
+
+const std::map<std::string,CommProfileEntry>& RedistProfile()
+{ return ::redistProfile; }
+
+const std::map<std::string,CommProfileEntry>& CollectiveProfile()
+{ return ::collectiveProfile; }
+
+void PrintCommProfile( mpi::Comm comm, std::ostream& os )
+{
+    DEBUG_ONLY(CallStackEntry cse("PrintCommProfile"))
+    // The communication for the report itself should not be recorded
+    const bool profilingSave = ::profiling;
+    ::profiling = false;
+
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    // Form the union of the (prefixed) names of the entries over all of the
+    // processes, since any process may have skipped some of them
+    std::vector<std::string> localNames;
+    for( const auto& pair : ::redistProfile )
+        localNames.push_back( "R"+pair.first );
+    for( const auto& pair : ::collectiveProfile )
+        localNames.push_back( "C"+pair.first );
+    const std::vector<std::string> names = NameUnion( localNames, comm );
+    const Int numNames = names.size();
+
+    std::vector<double> localData( numFields*numNames, 0 );
+    for( Int k=0; k<numNames; ++k )
+    {
+        const auto& profile =
+          ( names[k][0] == 'R' ? ::redistProfile : ::collectiveProfile );
+        auto it = profile.find( names[k].substr(1) );
+        if( it != profile.end() )
+            Pack( it->second, &localData[numFields*k] );
+    }
+    std::vector<double> data;
+    if( commRank == 0 )
+        data.resize( numFields*numNames*commSize );
+    mpi::Gather
+    ( localData.data(), numFields*numNames,
+      data.data(), numFields*numNames, 0, comm );
+
+    if( commRank == 0 )
+    {
+        os << "Communication profile over " << commSize << " processes "
+           << "(calls and MB are totals, times are average/maximum seconds)\n";
+        for( Int k=0; k<numNames; ++k )
+        {
+            if( k == 0 || names[k][0] != names[k-1][0] )
+                PrintHeader
+                ( names[k][0]=='R' ? "Redistribution" : "MPI call", os );
+            double sums[numFields]={0,0,0,0,0}, maxs[numFields]={0,0,0,0,0};
+            for( int q=0; q<commSize; ++q )
+            {
+                const double* entry = &data[numFields*(q*numNames+k)];
+                for( Int f=0; f<numFields; ++f )
+                {
+                    sums[f] += entry[f];
+                    maxs[f] = Max( maxs[f], entry[f] );
+                }
+            }
+            PrintRow
+            ( names[k].substr(1), sums[0], sums[1],
+              sums[2]/commSize, sums[3]/commSize, sums[4]/commSize, os );
+            PrintRow
+            ( "  (max)", maxs[0], maxs[1], maxs[2], maxs[3], maxs[4], os );
+        }
+        if( ::perRankReport )
+        {
+            for( int q=0; q<commSize; ++q )
+            {
+                os << "Communication profile of process " << q << "\n";
+                for( Int k=0; k<numNames; ++k )
+                {
+                    const double* entry = &data[numFields*(q*numNames+k)];
+                    if( k == 0 || names[k][0] != names[k-1][0] )
+                        PrintHeader
+                        ( names[k][0]=='R' ? "Redistribution" : "MPI call",
+                          os );
+                    if( entry[0] != 0 )
+                        PrintRow
+                        ( names[k].substr(1), entry[0], entry[1], entry[2],
+                          entry[3], entry[4], os );
+                }
+            }
+        }
+        os.flush();
+    }
+    ::profiling = profilingSave;
+}
+
+CommProfileRegion::CommProfileRegion( const char* name )
+: active_(::profiling)
+{
+    if( active_ && ::regionDepth++ == 0 )
+        OpenRegion( name );
+}
+
+CommProfileRegion::CommProfileRegion
+( Dist UA, Dist VA, Dist UB, Dist VB, const char* kind )
+: active_(::profiling)
+{
+    if( active_ && ::regionDepth++ == 0 )
+    {
+        std::string name =
+          "["+DistName(UA)+","+DistName(VA)+"] -> ["+
+              DistName(UB)+","+DistName(VB)+"]";
+        if( kind != nullptr )
+            name += std::string(" (")+kind+")";
+        OpenRegion( name );
+    }
+}
+
+CommProfileRegion::~CommProfileRegion()
+{
+    if( active_ && --::regionDepth == 0 )
+        CloseRegion();
+}
+
+CommProfileCall::CommProfileCall( const char* name, double numBytes )
+: name_(name), numBytes_(numBytes), active_(::profiling)
+{
+#ifdef EL_HAVE_OPENMP
+    // The profile is not thread-safe
+    if( omp_in_parallel() )
+        active_ = false;
+#endif
+    if( active_ )
+        start_ = Clock::now();
+}
+
+CommProfileCall::~CommProfileCall()
+{
+    if( !active_ )
+        return;
+    const Clock::time_point stop = Clock::now();
+    const double waitTime = Seconds( start_, stop );
+
+    CommProfileEntry& entry = ::collectiveProfile[name_];
+    ++entry.numCalls;
+    entry.numBytes += numBytes_;
+    entry.waitTime += waitTime;
+
+    if( ::regionDepth > 0 )
+    {
+        ::region.numBytes += numBytes_;
+        ::region.waitTime += waitTime;
+        ::region.localTime =
+          Seconds( ::region.start, stop ) - ::region.waitTime;
+    }
+}
+
+} // namespace El
@@ -9,6 +9,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include "./SparseAssembly.hpp"
 
 namespace El {
 
@@ -104,6 +105,7 @@ void DistGraph::Empty()
     SwapClear( sources_ );
     SwapClear( targets_ );
     SwapClear( localEdgeOffsets_ );
+    SwapClear( markedForRemoval_ );
     consistent_ = true;
 }
 
@@ -125,6 +127,7 @@ void DistGraph::Resize( Int numSources, Int numTargets )
     SwapClear( sources_ );
     SwapClear( targets_ );
     SwapClear( localEdgeOffsets_ );
+    SwapClear( markedForRemoval_ );
     consistent_ = true;
 }
 
@@ -138,6 +141,7 @@ void DistGraph::SetComm( mpi::Comm comm )
     SwapClear( sources_ );
     SwapClear( targets_ );
     SwapClear( localEdgeOffsets_ );
+    SwapClear( markedForRemoval_ );
     consistent_ = true;
 
     if( comm == mpi::COMM_WORLD )
@@ -224,8 +228,8 @@ void DistGraph::QueueLocalConnection( Int localSource, Int target )
 void DistGraph::QueueDisconnection( Int source, Int target )
 {
     DEBUG_ONLY(CallStackEntry cse("DistGraph::QueueDisconnection"))
-    if( source < firstLocalSource_ || 
-        source >= firstLocalSource_+numLocalSources_ )
+    if( source >= firstLocalSource_ && 
+        source < firstLocalSource_+numLocalSources_ )
         QueueLocalDisconnection( source-firstLocalSource_, target );
 }
 
@@ -239,7 +243,7 @@ void DistGraph::QueueLocalDisconnection( Int localSource, Int target )
     if( target < 0 || target >= numTargets_ )
         LogicError
         ("Target was out of bounds: ",target," is not in [0,",numTargets_,")");
-    markedForRemoval_.insert
+    markedForRemoval_.push_back
     ( std::pair<Int,Int>(firstLocalSource_+localSource,target) );
     consistent_ = false;
 }
@@ -253,47 +257,12 @@ void DistGraph::MakeConsistent()
     )
     if( !consistent_ )
     {
-        const Int numLocalEdges = sources_.size();
-        Int numRemoved = 0;
-        std::vector<std::pair<Int,Int>> pairs( numLocalEdges );
-        for( Int e=0; e<numLocalEdges; ++e )
-        {
-            std::pair<Int,Int> candidate(sources_[e],targets_[e]);
-            if( markedForRemoval_.find(candidate) == markedForRemoval_.end() )
-            {
-                pairs[e-numRemoved].first = sources_[e];
-                pairs[e-numRemoved].second = targets_[e];
-            }
-            else
-            {
-                ++numRemoved;
-            }
-        }
-        markedForRemoval_.clear();
-        pairs.resize( numLocalEdges-numRemoved );
-        std::sort( pairs.begin(), pairs.end(), ComparePairs );
-
-        // Compress out duplicates
-        Int lastUnique=0;
-        for( Int e=1; e<numLocalEdges; ++e )
-        {
-            if( pairs[e] != pairs[lastUnique] )
-            {
-                ++lastUnique;
-                if( e != lastUnique )
-                    pairs[lastUnique] = pairs[e];
-            }
-        }
-        const Int numUnique = lastUnique+1;
-        pairs.resize( numUnique );
-
-        sources_.resize( numUnique );
-        targets_.resize( numUnique );
-        for( Int e=0; e<numUnique; ++e )
-        {
-            sources_[e] = pairs[e].first;
-            targets_[e] = pairs[e].second;
-        }
+        const Int numLocalEdges = assembly::Consolidate
+        ( firstLocalSource_, numLocalSources_, 
+          sources_.size(), sources_.data(), targets_.data(), 
+          markedForRemoval_ );
+        sources_.resize( numLocalEdges );
+        targets_.resize( numLocalEdges );
 
         ComputeEdgeOffsets();
 
@@ -380,35 +349,24 @@ Int* DistGraph::TargetBuffer() { return targets_.data(); }
 const Int* DistGraph::LockedSourceBuffer() const { return sources_.data(); }
 const Int* DistGraph::LockedTargetBuffer() const { return targets_.data(); }
 
+const Int* DistGraph::LockedOffsetBuffer() const
+{
+    DEBUG_ONLY(
+      CallStackEntry cse("DistGraph::LockedOffsetBuffer");
+      AssertConsistent();
+    )
+    return localEdgeOffsets_.data();
+}
+
 // Auxiliary routines
 // ==================
 
-bool DistGraph::ComparePairs
-( const std::pair<Int,Int>& a, const std::pair<Int,Int>& b )
-{ return a.first < b.first || (a.first == b.first && a.second < b.second); }
-
 void DistGraph::ComputeEdgeOffsets()
 {
     DEBUG_ONLY(CallStackEntry cse("DistGraph::ComputeEdgeOffsets"))
-    // Compute the local edge offsets
-    Int sourceOffset = 0;
-    Int prevSource = firstLocalSource_-1;
-    localEdgeOffsets_.resize( numLocalSources_+1 );
-    const Int numLocalEdges = NumLocalEdges();
-    for( Int localEdge=0; localEdge<numLocalEdges; ++localEdge )
-    {
-        const Int source = Source( localEdge );
-        DEBUG_ONLY(
-          if( source < prevSource )
-              RuntimeError("sources were not properly sorted");
-        )
-        while( source != prevSource )
-        {
-            localEdgeOffsets_[sourceOffset++] = localEdge;
-            ++prevSource;
-        }
-    }
-    localEdgeOffsets_[numLocalSources_] = numLocalEdges;
+    assembly::EdgeOffsets
+    ( firstLocalSource_, numLocalSources_, 
+      sources_.size(), sources_.data(), localEdgeOffsets_ );
 }
 
 void DistGraph::AssertConsistent() const
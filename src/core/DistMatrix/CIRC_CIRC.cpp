@@ -47,6 +47,7 @@ template<typename T>
 DM& DM::operator=( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("DM[CIRC,CIRC] = DM[CIRC,CIRC]"))
+    CommProfileRegion profile("[CIRC,CIRC] -> [CIRC,CIRC]");
     A.Translate( *this );
     return *this;
 }
@@ -55,6 +56,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [MC,MR]"))
+    CommProfileRegion profile("[MC,MR] -> [CIRC,CIRC]");
     this->CollectFrom( A );
     return *this;
 }
@@ -63,6 +65,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [MC,STAR]"))
+    CommProfileRegion profile("[MC,STAR] -> [CIRC,CIRC]");
     this->CollectFrom( A );
     return *this;
 }
@@ -71,6 +74,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [STAR,MR]"))
+    CommProfileRegion profile("[STAR,MR] -> [CIRC,CIRC]");
     this->CollectFrom( A );
     return *this;
 }
@@ -83,6 +87,7 @@ DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[MD,STAR] -> [CIRC,CIRC]");
     const Int m = A.Height();
     const Int n = A.Width();
     this->Resize( m, n );
@@ -167,6 +172,7 @@ DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[STAR,MD] -> [CIRC,CIRC]");
     const Int m = A.Height();
     const Int n = A.Width();
     this->Resize( m, n );
@@ -243,6 +249,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [MR,MC]"))
+    CommProfileRegion profile("[MR,MC] -> [CIRC,CIRC]");
     this->CollectFrom( A );
     return *this;
 }
@@ -251,6 +258,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [MR,STAR]"))
+    CommProfileRegion profile("[MR,STAR] -> [CIRC,CIRC]");
     this->CollectFrom( A );
     return *this;
 }
@@ -259,6 +267,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [STAR,MC]"))
+    CommProfileRegion profile("[STAR,MC] -> [CIRC,CIRC]");
     this->CollectFrom( A );
     return *this;
 }
@@ -267,6 +276,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [VC,STAR]"))
+    CommProfileRegion profile("[VC,STAR] -> [CIRC,CIRC]");
     this->CollectFrom( A );
     return *this;
 }
@@ -275,6 +285,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [STAR,VC]"))
+    CommProfileRegion profile("[STAR,VC] -> [CIRC,CIRC]");
     this->CollectFrom( A );
     return *this;
 }
@@ -283,6 +294,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [VR,STAR]"))
+    CommProfileRegion profile("[VR,STAR] -> [CIRC,CIRC]");
     this->CollectFrom( A );
     return *this;
 }
@@ -291,6 +303,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [STAR,VR]"))
+    CommProfileRegion profile("[STAR,VR] -> [CIRC,CIRC]");
     this->CollectFrom( A );
     return *this;
 }
@@ -299,6 +312,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[CIRC,CIRC] = [STAR,STAR]"))
+    CommProfileRegion profile("[STAR,STAR] -> [CIRC,CIRC]");
     this->Resize( A.Height(), A.Width() );
     if( A.Grid().VCRank() == this->Root() )
         this->matrix_ = A.LockedMatrix();
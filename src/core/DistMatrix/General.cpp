@@ -85,6 +85,7 @@ void
 GeneralDistMatrix<T,U,V>::Translate( DistMatrix<T,U,V>& A ) const
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::Translate"))
+    CommProfileRegion profile( U, V, A.ColDist(), A.RowDist() );
     const Grid& g = this->Grid();
     const Int height = this->Height();
     const Int width = this->Width();
@@ -178,6 +179,7 @@ void
 GeneralDistMatrix<T,U,V>::AllGather( DistMatrix<T,UGath,VGath>& A ) const
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::AllGather"))
+    CommProfileRegion profile( U, V, A.ColDist(), A.RowDist() );
     const Int height = this->Height();
     const Int width = this->Width();
     A.SetGrid( this->Grid() );
@@ -276,6 +278,7 @@ GeneralDistMatrix<T,U,V>::ColAllGather( DistMatrix<T,UGath,V>& A ) const
         CallStackEntry cse("GDM::ColAllGather");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( U, V, A.ColDist(), A.RowDist() );
     const Int height = this->Height();
     const Int width = this->Width();
 #ifdef EL_CACHE_WARNINGS
@@ -526,6 +529,7 @@ GeneralDistMatrix<T,U,V>::RowAllGather( DistMatrix<T,U,VGath>& A ) const
         CallStackEntry cse("GDM::RowAllGather");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( U, V, A.ColDist(), A.RowDist() );
     const Int height = this->Height();
     const Int width = this->Width();
     A.AlignColsAndResize( this->ColAlign(), height, width, false, false );
@@ -727,6 +731,7 @@ GeneralDistMatrix<T,U,V>::PartialColAllGather( DistMatrix<T,UPart,V>& A ) const
         CallStackEntry cse("GDM::PartialColAllGather");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( U, V, A.ColDist(), A.RowDist() );
     const Int height = this->Height();
     const Int width = this->Width();
 #ifdef EL_VECTOR_WARNINGS
@@ -869,6 +874,7 @@ GeneralDistMatrix<T,U,V>::PartialRowAllGather( DistMatrix<T,U,VPart>& A ) const
         CallStackEntry cse("GDM::PartialRowAllGather");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( U, V, A.ColDist(), A.RowDist() );
     const Int height = this->Height();
     const Int width = this->Width();
     A.AlignRowsAndResize
@@ -991,6 +997,7 @@ GeneralDistMatrix<T,U,V>::FilterFrom( const DistMatrix<T,UGath,VGath>& A )
         CallStackEntry cse("GDM::FilterFrom");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V );
     const Int height = A.Height();
     const Int width = A.Width();
     this->Resize( height, width );
@@ -1027,6 +1034,7 @@ GeneralDistMatrix<T,U,V>::ColFilterFrom( const DistMatrix<T,UGath,V>& A )
         CallStackEntry cse("GDM::ColFilterFrom");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V );
     const Int height = A.Height();
     const Int width = A.Width();
     this->AlignRowsAndResize( A.RowAlign(), height, width, false, false );
@@ -1108,6 +1116,7 @@ GeneralDistMatrix<T,U,V>::RowFilterFrom( const DistMatrix<T,U,VGath>& A )
         CallStackEntry cse("GDM::RowFilterFrom");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V );
     const Int height = A.Height();
     const Int width = A.Width();
     this->AlignColsAndResize( A.ColAlign(), height, width, false, false );
@@ -1186,6 +1195,7 @@ GeneralDistMatrix<T,U,V>::PartialColFilterFrom( const DistMatrix<T,UPart,V>& A )
         CallStackEntry cse("GDM::PartialColFilterFrom");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V );
     const Int height = A.Height();
     const Int width = A.Width();
     this->AlignColsAndResize( A.ColAlign(), height, width, false, false );
@@ -1280,6 +1290,7 @@ GeneralDistMatrix<T,U,V>::PartialRowFilterFrom( const DistMatrix<T,U,VPart>& A )
         CallStackEntry cse("GDM::PartialRowFilterFrom");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V );
     const Int height = A.Height();
     const Int width = A.Width();
     this->AlignRowsAndResize( A.RowAlign(), height, width, false, false );
@@ -1373,6 +1384,7 @@ GeneralDistMatrix<T,U,V>::PartialColAllToAllFrom
         CallStackEntry cse("GDM::PartialColAllToAllFrom");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V );
     const Int height = A.Height();
     const Int width = A.Width();
     this->AlignColsAndResize( A.ColAlign(), height, width, false, false );
@@ -1518,6 +1530,7 @@ GeneralDistMatrix<T,U,V>::PartialRowAllToAllFrom
         CallStackEntry cse("GDM::PartialRowAllToAllFrom");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V );
     const Int height = A.Height();
     const Int width = A.Width();
     this->AlignRowsAndResize( A.RowAlign(), height, width, false, false );
@@ -1663,6 +1676,7 @@ GeneralDistMatrix<T,U,V>::PartialColAllToAll
         CallStackEntry cse("GDM::PartialColAllToAll");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( U, V, A.ColDist(), A.RowDist() );
     const Int height = this->Height();
     const Int width = this->Width();
     A.AlignColsAndResize
@@ -1806,6 +1820,7 @@ GeneralDistMatrix<T,U,V>::PartialRowAllToAll
         CallStackEntry cse("GDM::PartialRowAllToAll");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( U, V, A.ColDist(), A.RowDist() );
     const Int height = this->Height();
     const Int width = this->Width();
     A.AlignRowsAndResize
@@ -1946,6 +1961,7 @@ GeneralDistMatrix<T,U,V>::RowSumScatterFrom( const DistMatrix<T,U,VGath>& A )
         CallStackEntry cse("GDM::RowSumScatterFrom");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V, "sum-scatter" );
     this->AlignColsAndResize
     ( A.ColAlign(), A.Height(), A.Width(), false, false );
     // NOTE: This will be *slightly* slower than necessary due to the result
@@ -1962,6 +1978,7 @@ GeneralDistMatrix<T,U,V>::ColSumScatterFrom( const DistMatrix<T,UGath,V>& A )
         CallStackEntry cse("GDM::ColSumScatterFrom");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V, "sum-scatter" );
     this->AlignRowsAndResize
     ( A.RowAlign(), A.Height(), A.Width(), false, false );
     // NOTE: This will be *slightly* slower than necessary due to the result
@@ -1978,6 +1995,7 @@ GeneralDistMatrix<T,U,V>::SumScatterFrom( const DistMatrix<T,UGath,VGath>& A )
         CallStackEntry cse("GDM::SumScatterFrom");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V, "sum-scatter" );
     this->Resize( A.Height(), A.Width() );
     // NOTE: This will be *slightly* slower than necessary due to the result
     //       of the MPI operations being added rather than just copied
@@ -1994,6 +2012,7 @@ GeneralDistMatrix<T,U,V>::PartialRowSumScatterFrom
         CallStackEntry cse("GDM::PartialRowSumScatterFrom");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V, "sum-scatter" );
     this->AlignAndResize
     ( A.ColAlign(), A.RowAlign(), A.Height(), A.Width(), false, false );
     // NOTE: This will be *slightly* slower than necessary due to the result
@@ -2011,6 +2030,7 @@ GeneralDistMatrix<T,U,V>::PartialColSumScatterFrom
         CallStackEntry cse("GDM::PartialColSumScatterFrom");
         AssertSameGrids( *this, A );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V, "sum-scatter" );
     this->AlignAndResize
     ( A.ColAlign(), A.RowAlign(), A.Height(), A.Width(), false, false );
     // NOTE: This will be *slightly* slower than necessary due to the result
@@ -2030,6 +2050,7 @@ GeneralDistMatrix<T,U,V>::RowSumScatterUpdate
         this->AssertNotLocked();
         this->AssertSameSize( A.Height(), A.Width() );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V, "sum-scatter" );
     if( !this->Participating() )
         return;
 
@@ -2250,6 +2271,7 @@ GeneralDistMatrix<T,U,V>::ColSumScatterUpdate
         this->AssertNotLocked();
         this->AssertSameSize( A.Height(), A.Width() );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V, "sum-scatter" );
 #ifdef EL_VECTOR_WARNINGS
     if( A.Width() == 1 && this->Grid().Rank() == 0 )
     {
@@ -2404,6 +2426,7 @@ GeneralDistMatrix<T,U,V>::SumScatterUpdate
         this->AssertNotLocked();
         this->AssertSameSize( A.Height(), A.Width() );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V, "sum-scatter" );
     if( !this->Participating() )
         return;
 
@@ -2476,6 +2499,7 @@ GeneralDistMatrix<T,U,V>::PartialRowSumScatterUpdate
         this->AssertNotLocked();
         this->AssertSameSize( A.Height(), A.Width() );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V, "sum-scatter" );
     if( !this->Participating() )
         return;
 
@@ -2552,6 +2576,7 @@ GeneralDistMatrix<T,U,V>::PartialColSumScatterUpdate
         this->AssertNotLocked();
         this->AssertSameSize( A.Height(), A.Width() );
     )
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V, "sum-scatter" );
     if( !this->Participating() )
         return;
 
@@ -2634,6 +2659,9 @@ GeneralDistMatrix<T,U,V>::TransposeColAllGather
 ( DistMatrix<T,V,UGath>& A, bool conjugate ) const
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::TransposeColAllGather"))
+    CommProfileRegion profile
+    ( U, V, A.ColDist(), A.RowDist(),
+      ( conjugate ? "adjoint" : "transpose" ) );
     DistMatrix<T,V,U> ATrans( this->Grid() );
     ATrans.AlignWith( *this );
     ATrans.Resize( this->Width(), this->Height() );
@@ -2647,6 +2675,9 @@ GeneralDistMatrix<T,U,V>::TransposePartialColAllGather
 ( DistMatrix<T,V,UPart>& A, bool conjugate ) const
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::TransposePartialColAllGather"))
+    CommProfileRegion profile
+    ( U, V, A.ColDist(), A.RowDist(),
+      ( conjugate ? "adjoint" : "transpose" ) );
     DistMatrix<T,V,U> ATrans( this->Grid() );
     ATrans.AlignWith( *this );
     ATrans.Resize( this->Width(), this->Height() );
@@ -2659,6 +2690,7 @@ void
 GeneralDistMatrix<T,U,V>::AdjointColAllGather( DistMatrix<T,V,UGath>& A ) const
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::AdjointRowAllGather"))
+    CommProfileRegion profile( U, V, A.ColDist(), A.RowDist(), "adjoint" );
     this->TransposeColAllGather( A, true );
 }
 
@@ -2668,6 +2700,7 @@ GeneralDistMatrix<T,U,V>::AdjointPartialColAllGather
 ( DistMatrix<T,V,UPart>& A ) const
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::AdjointPartialColAllGather"))
+    CommProfileRegion profile( U, V, A.ColDist(), A.RowDist(), "adjoint" );
     this->TransposePartialColAllGather( A, true );
 }
 
@@ -2677,6 +2710,9 @@ GeneralDistMatrix<T,U,V>::TransposeColFilterFrom
 ( const DistMatrix<T,V,UGath>& A, bool conjugate )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::TransposeColFilterFrom"))
+    CommProfileRegion profile
+    ( A.ColDist(), A.RowDist(), U, V,
+      ( conjugate ? "adjoint" : "transpose" ) );
     DistMatrix<T,V,U> AFilt( A.Grid() );
     if( this->ColConstrained() )
         AFilt.AlignRowsWith( *this, false );
@@ -2697,6 +2733,9 @@ GeneralDistMatrix<T,U,V>::TransposeRowFilterFrom
 ( const DistMatrix<T,VGath,U>& A, bool conjugate )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::TransposeRowFilterFrom"))
+    CommProfileRegion profile
+    ( A.ColDist(), A.RowDist(), U, V,
+      ( conjugate ? "adjoint" : "transpose" ) );
     DistMatrix<T,V,U> AFilt( A.Grid() );
     if( this->ColConstrained() )
         AFilt.AlignRowsWith( *this, false );
@@ -2717,6 +2756,9 @@ GeneralDistMatrix<T,U,V>::TransposePartialColFilterFrom
 ( const DistMatrix<T,V,UPart>& A, bool conjugate )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::TransposePartialColFilterFrom"))
+    CommProfileRegion profile
+    ( A.ColDist(), A.RowDist(), U, V,
+      ( conjugate ? "adjoint" : "transpose" ) );
     DistMatrix<T,V,U> AFilt( A.Grid() );
     if( this->ColConstrained() )
         AFilt.AlignRowsWith( *this, false );
@@ -2737,6 +2779,9 @@ GeneralDistMatrix<T,U,V>::TransposePartialRowFilterFrom
 ( const DistMatrix<T,VPart,U>& A, bool conjugate )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::TransposePartialRowFilterFrom"))
+    CommProfileRegion profile
+    ( A.ColDist(), A.RowDist(), U, V,
+      ( conjugate ? "adjoint" : "transpose" ) );
     DistMatrix<T,V,U> AFilt( A.Grid() );
     if( this->ColConstrained() )
         AFilt.AlignRowsWith( *this, false );
@@ -2756,6 +2801,7 @@ void
 GeneralDistMatrix<T,U,V>::AdjointColFilterFrom( const DistMatrix<T,V,UGath>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::AdjointColFilterFrom"))
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V, "adjoint" );
     this->TransposeColFilterFrom( A, true );
 }
 
@@ -2764,6 +2810,7 @@ void
 GeneralDistMatrix<T,U,V>::AdjointRowFilterFrom( const DistMatrix<T,VGath,U>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::AdjointRowFilterFrom"))
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V, "adjoint" );
     this->TransposeRowFilterFrom( A, true );
 }
 
@@ -2773,6 +2820,7 @@ GeneralDistMatrix<T,U,V>::AdjointPartialColFilterFrom
 ( const DistMatrix<T,V,UPart>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::AdjointPartialColFilterFrom"))
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V, "adjoint" );
     this->TransposePartialColFilterFrom( A, true );
 }
 
@@ -2782,6 +2830,7 @@ GeneralDistMatrix<T,U,V>::AdjointPartialRowFilterFrom
 ( const DistMatrix<T,VPart,U>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::AdjointPartialRowFilterFrom"))
+    CommProfileRegion profile( A.ColDist(), A.RowDist(), U, V, "adjoint" );
     this->TransposePartialRowFilterFrom( A, true );
 }
 
@@ -2791,6 +2840,10 @@ GeneralDistMatrix<T,U,V>::TransposeColSumScatterFrom
 ( const DistMatrix<T,V,UGath>& A, bool conjugate )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::TransposeColSumScatterFrom"))
+    CommProfileRegion profile
+    ( A.ColDist(), A.RowDist(), U, V,
+      ( conjugate ? "adjoint sum-scatter"
+                  : "transpose sum-scatter" ) );
     DistMatrix<T,V,U> ASumFilt( A.Grid() );
     if( this->ColConstrained() )
         ASumFilt.AlignRowsWith( *this, false );
@@ -2811,6 +2864,10 @@ GeneralDistMatrix<T,U,V>::TransposePartialColSumScatterFrom
 ( const DistMatrix<T,V,UPart>& A, bool conjugate )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::TransposePartialColSumScatterFrom"))
+    CommProfileRegion profile
+    ( A.ColDist(), A.RowDist(), U, V,
+      ( conjugate ? "adjoint sum-scatter"
+                  : "transpose sum-scatter" ) );
     DistMatrix<T,V,U> ASumFilt( A.Grid() );
     if( this->ColConstrained() )
         ASumFilt.AlignRowsWith( *this, false );
@@ -2831,6 +2888,8 @@ GeneralDistMatrix<T,U,V>::AdjointColSumScatterFrom
 ( const DistMatrix<T,V,UGath>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::AdjointColSumScatterFrom"))
+    CommProfileRegion profile
+    ( A.ColDist(), A.RowDist(), U, V, "adjoint sum-scatter" );
     this->TransposeColSumScatterFrom( A, true );
 }
 
@@ -2840,6 +2899,8 @@ GeneralDistMatrix<T,U,V>::AdjointPartialColSumScatterFrom
 ( const DistMatrix<T,V,UPart>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::AdjointPartialColSumScatterFrom"))
+    CommProfileRegion profile
+    ( A.ColDist(), A.RowDist(), U, V, "adjoint sum-scatter" );
     this->TransposePartialColSumScatterFrom( A, true );
 }
 
@@ -2849,6 +2910,10 @@ GeneralDistMatrix<T,U,V>::TransposeColSumScatterUpdate
 ( T alpha, const DistMatrix<T,V,UGath>& A, bool conjugate )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::TransposeColSumScatterUpdate"))
+    CommProfileRegion profile
+    ( A.ColDist(), A.RowDist(), U, V,
+      ( conjugate ? "adjoint sum-scatter"
+                  : "transpose sum-scatter" ) );
     DistMatrix<T,V,U> ASumFilt( A.Grid() );
     if( this->ColConstrained() )
         ASumFilt.AlignRowsWith( *this, false );
@@ -2884,6 +2949,10 @@ GeneralDistMatrix<T,U,V>::TransposePartialColSumScatterUpdate
 ( T alpha, const DistMatrix<T,V,UPart>& A, bool conjugate )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::TransposePartialColSumScatterUpdate"))
+    CommProfileRegion profile
+    ( A.ColDist(), A.RowDist(), U, V,
+      ( conjugate ? "adjoint sum-scatter"
+                  : "transpose sum-scatter" ) );
     DistMatrix<T,V,U> ASumFilt( A.Grid() );
     if( this->ColConstrained() )
         ASumFilt.AlignRowsWith( *this, false );
@@ -2918,6 +2987,8 @@ void GeneralDistMatrix<T,U,V>::AdjointColSumScatterUpdate
 ( T alpha, const DistMatrix<T,V,UGath>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::AdjointColSumScatterUpdate"))
+    CommProfileRegion profile
+    ( A.ColDist(), A.RowDist(), U, V, "adjoint sum-scatter" );
     this->TransposeColSumScatterUpdate( alpha, A, true );
 }
 
@@ -2926,6 +2997,8 @@ void GeneralDistMatrix<T,U,V>::AdjointPartialColSumScatterUpdate
 ( T alpha, const DistMatrix<T,V,UPart>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("GDM::AdjointPartialColSumScatterUpdate"))
+    CommProfileRegion profile
+    ( A.ColDist(), A.RowDist(), U, V, "adjoint sum-scatter" );
     this->TransposePartialColSumScatterUpdate( alpha, A, true );
 }
 
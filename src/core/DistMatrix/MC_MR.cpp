@@ -48,6 +48,7 @@ template<typename T>
 DM& DM::operator=( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("DM[MC,MR] = DM[MC,MR]"))
+    CommProfileRegion profile("[MC,MR] -> [MC,MR]");
     if( this->Grid() == A.Grid() )
         A.Translate( *this );
     else
@@ -59,6 +60,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [MC,STAR]"))
+    CommProfileRegion profile("[MC,STAR] -> [MC,MR]");
     this->RowFilterFrom( A );
     return *this;
 }
@@ -67,6 +69,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [STAR,MR]"))
+    CommProfileRegion profile("[STAR,MR] -> [MC,MR]");
     this->ColFilterFrom( A );
     return *this;
 }
@@ -75,6 +78,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [MD,STAR]"))
+    CommProfileRegion profile("[MD,STAR] -> [MC,MR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -85,6 +89,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [STAR,MD]"))
+    CommProfileRegion profile("[STAR,MD] -> [MC,MR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -99,6 +104,7 @@ DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[MR,MC] -> [MC,MR]");
     const El::Grid& g = A.Grid();
     this->Resize( A.Height(), A.Width() );
     if( !this->Participating() )
@@ -296,6 +302,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [MR,STAR]"))
+    CommProfileRegion profile("[MR,STAR] -> [MC,MR]");
     auto A_VR_STAR = MakeUnique<DistMatrix<T,VR,STAR>>( A );
     auto A_VC_STAR = MakeUnique<DistMatrix<T,VC,STAR>>( this->Grid() );
     A_VC_STAR->AlignColsWith(*this);
@@ -309,6 +316,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [STAR,MC]"))
+    CommProfileRegion profile("[STAR,MC] -> [MC,MR]");
     auto A_STAR_VC = MakeUnique<DistMatrix<T,STAR,VC>>( A );
     auto A_STAR_VR = MakeUnique<DistMatrix<T,STAR,VR>>( this->Grid() );
     A_STAR_VR->AlignRowsWith(*this);
@@ -322,6 +330,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [VC,STAR]"))
+    CommProfileRegion profile("[VC,STAR] -> [MC,MR]");
     A.PartialColAllToAll( *this );
     return *this;
 }
@@ -330,6 +339,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [STAR,VC]"))
+    CommProfileRegion profile("[STAR,VC] -> [MC,MR]");
     DistMatrix<T,STAR,VR> A_STAR_VR(this->Grid());
     A_STAR_VR.AlignRowsWith(*this);
     A_STAR_VR = A;
@@ -341,6 +351,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [VR,STAR]"))
+    CommProfileRegion profile("[VR,STAR] -> [MC,MR]");
     DistMatrix<T,VC,STAR> A_VC_STAR(this->Grid());
     A_VC_STAR.AlignColsWith(*this);
     A_VC_STAR = A;
@@ -352,6 +363,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [STAR,VR]"))
+    CommProfileRegion profile("[STAR,VR] -> [MC,MR]");
     A.PartialRowAllToAll( *this );
     return *this;
 }
@@ -360,6 +372,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,MR] = [STAR,STAR]"))
+    CommProfileRegion profile("[STAR,STAR] -> [MC,MR]");
     this->FilterFrom( A );
     return *this;
 }
@@ -372,6 +385,7 @@ DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[CIRC,CIRC] -> [MC,MR]");
     const Grid& g = A.Grid();
     const Int m = A.Height();
     const Int n = A.Width();
@@ -480,197 +494,14 @@ void DM::CopyFromDifferentGrid( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,MR]::CopyFromDifferentGrid"))
     this->Resize( A.Height(), A.Width() );
-    // Just need to ensure that each viewing comm contains the other team's
-    // owning comm. Congruence is too strong.
-
-    // Compute the number of process rows and columns that each process
-    // needs to send to.
-    const Int colStride = this->ColStride();
-    const Int rowStride = this->RowStride();
-    const Int colRank = this->ColRank();
-    const Int rowRank = this->RowRank();
-    const Int colStrideA = A.ColStride();
-    const Int rowStrideA = A.RowStride();
-    const Int colRankA = A.ColRank();
-    const Int rowRankA = A.RowRank();
-    const Int colGCD = GCD( colStride, colStrideA );
-    const Int rowGCD = GCD( rowStride, rowStrideA );
-    const Int colLCM = colStride*colStrideA / colGCD;
-    const Int rowLCM = rowStride*rowStrideA / rowGCD;
-    const Int numColSends = colStride / colGCD;
-    const Int numRowSends = rowStride / rowGCD;
-    const Int localColStride = colLCM / colStride;
-    const Int localRowStride = rowLCM / rowStride;
-    const Int localColStrideA = numColSends;
-    const Int localRowStrideA = numRowSends;
-
-    const Int colAlign = this->ColAlign();
-    const Int rowAlign = this->RowAlign();
-    const Int colAlignA = A.ColAlign();
-    const Int rowAlignA = A.RowAlign();
-
-    const bool inThisGrid = this->Participating();
-    const bool inAGrid = A.Participating();
-    if( !inThisGrid && !inAGrid )
-        return;
-
-    const Int maxSendSize =
-        (A.Height()/(colStrideA*localColStrideA)+1) *
-        (A.Width()/(rowStrideA*localRowStrideA)+1);
-
-    // Translate the ranks from A's VC communicator to this's viewing so that
-    // we can match send/recv communicators. Since A's VC communicator is not
-    // necessarily defined on every process, we instead work with A's owning
-    // group and account for row-major ordering if necessary.
-    const int sizeA = A.Grid().Size();
-    std::vector<int> rankMap(sizeA), ranks(sizeA);
-    if( A.Grid().Order() == COLUMN_MAJOR )
-    {
-        for( int j=0; j<sizeA; ++j )
-            ranks[j] = j;
-    }
-    else
-    {
-        // The (i,j) = i + j*colStrideA rank in the column-major ordering is
-        // equal to the j + i*rowStrideA rank in a row-major ordering.
-        // Since we desire rankMap[i+j*colStrideA] to correspond to process
-        // (i,j) in A's grid's rank in this viewing group, ranks[i+j*colStrideA]
-        // should correspond to process (i,j) in A's owning group. Since the
-        // owning group is ordered row-major in this case, its rank is
-        // j+i*rowStrideA. Note that setting
-        // ranks[j+i*rowStrideA] = i+j*colStrideA is *NOT* valid.
-        for( int i=0; i<colStrideA; ++i )
-            for( int j=0; j<rowStrideA; ++j )
-                ranks[i+j*colStrideA] = j+i*rowStrideA;
-    }
-    mpi::Translate
-    ( A.Grid().OwningGroup(), sizeA, &ranks[0],
-      this->Grid().ViewingComm(), &rankMap[0] );
-
-    // Have each member of A's grid individually send to all numRow x numCol
-    // processes in order, while the members of this grid receive from all
-    // necessary processes at each step.
-    Int requiredMemory = 0;
-    if( inAGrid )
-        requiredMemory += maxSendSize;
-    if( inThisGrid )
-        requiredMemory += maxSendSize;
-    T* auxBuf = this->auxMemory_.Require( requiredMemory );
-    Int offset = 0;
-    T* sendBuf = &auxBuf[offset];
-    if( inAGrid )
-        offset += maxSendSize;
-    T* recvBuf = &auxBuf[offset];
-
-    Int recvRow = 0; // avoid compiler warnings...
-    if( inAGrid )
-        recvRow = (((colRankA+colStrideA-colAlignA)%colStrideA)+colAlign) %
-                  colStride;
-    for( Int colSend=0; colSend<numColSends; ++colSend )
-    {
-        Int recvCol = 0; // avoid compiler warnings...
-        if( inAGrid )
-            recvCol = (((rowRankA+rowStrideA-rowAlignA)%rowStrideA)+rowAlign) %
-                      rowStride;
-        for( Int rowSend=0; rowSend<numRowSends; ++rowSend )
-        {
-            mpi::Request sendRequest;
-            // Fire off this round of non-blocking sends
-            if( inAGrid )
-            {
-                // Pack the data
-                Int sendHeight = Length(A.LocalHeight(),colSend,numColSends);
-                Int sendWidth = Length(A.LocalWidth(),rowSend,numRowSends);
-                const T* ABuffer = A.LockedBuffer();
-                const Int ALDim = A.LDim();
-                EL_PARALLEL_FOR
-                for( Int jLoc=0; jLoc<sendWidth; ++jLoc )
-                {
-                    const Int j = rowSend+jLoc*localRowStrideA;
-                    for( Int iLoc=0; iLoc<sendHeight; ++iLoc )
-                    {
-                        const Int i = colSend+iLoc*localColStrideA;
-                        sendBuf[iLoc+jLoc*sendHeight] = ABuffer[i+j*ALDim];
-                    }
-                }
-                // Send data
-                const Int recvVCRank = recvRow + recvCol*colStride;
-                const Int recvViewingRank =
-                    this->Grid().VCToViewingMap( recvVCRank );
-                mpi::ISend
-                ( sendBuf, sendHeight*sendWidth, recvViewingRank,
-                  this->Grid().ViewingComm(), sendRequest );
-            }
-            // Perform this round of recv's
-            if( inThisGrid )
-            {
-                const Int sendColOffset = (colSend*colStrideA+colAlignA) % colStrideA;
-                const Int recvColOffset = (colSend*colStrideA+colAlign) % colStride;
-                const Int sendRowOffset = (rowSend*rowStrideA+rowAlignA) % rowStrideA;
-                const Int recvRowOffset = (rowSend*rowStrideA+rowAlign) % rowStride;
-
-                const Int firstSendRow = (((colRank+colStride-recvColOffset)%colStride)+sendColOffset)%colStrideA;
-                const Int firstSendCol = (((rowRank+rowStride-recvRowOffset)%rowStride)+sendRowOffset)%rowStrideA;
-
-                const Int colShift = (colRank+colStride-recvColOffset)%colStride;
-                const Int rowShift = (rowRank+rowStride-recvRowOffset)%rowStride;
-                const Int numColRecvs = Length( colStrideA, colShift, colStride );
-                const Int numRowRecvs = Length( rowStrideA, rowShift, rowStride );
-
-                // Recv data
-                // For now, simply receive sequentially. Until we switch to
-                // nonblocking recv's, we won't be using much of the
-                // recvBuf
-                Int sendRow = firstSendRow;
-                for( Int colRecv=0; colRecv<numColRecvs; ++colRecv )
-                {
-                    const Int sendColShift = Shift( sendRow, colAlignA, colStrideA ) + colSend*colStrideA;
-                    const Int sendHeight = Length( A.Height(), sendColShift, colLCM );
-                    const Int localColOffset = (sendColShift-this->ColShift()) / colStride;
-
-                    Int sendCol = firstSendCol;
-                    for( Int rowRecv=0; rowRecv<numRowRecvs; ++rowRecv )
-                    {
-                        const Int sendRowShift = Shift( sendCol, rowAlignA, rowStrideA ) + rowSend*rowStrideA;
-                        const Int sendWidth = Length( A.Width(), sendRowShift, rowLCM );
-                        const Int localRowOffset = (sendRowShift-this->RowShift()) / rowStride;
-
-                        const Int sendVCRank = sendRow+sendCol*colStrideA;
-                        mpi::Recv
-                        ( recvBuf, sendHeight*sendWidth, rankMap[sendVCRank],
-                          this->Grid().ViewingComm() );
-                        
-                        // Unpack the data
-                        T* buffer = this->Buffer();
-                        const Int ldim = this->LDim();
-                        EL_PARALLEL_FOR
-                        for( Int jLoc=0; jLoc<sendWidth; ++jLoc )
-                        {
-                            const Int j = localRowOffset+jLoc*localRowStride;
-                            for( Int iLoc=0; iLoc<sendHeight; ++iLoc )
-                            {
-                                const Int i = localColOffset+iLoc*localColStride;
-                                buffer[i+j*ldim] = recvBuf[iLoc+jLoc*sendHeight];
-                            }
-                        }
-                        // Set up the next send col
-                        sendCol = (sendCol + rowStride) % rowStrideA;
-                    }
-                    // Set up the next send row
-                    sendRow = (sendRow + colStride) % colStrideA;
-                }
-            }
-            // Ensure that this round of non-blocking sends completes
-            if( inAGrid )
-            {
-                mpi::Wait( sendRequest );
-                recvCol = (recvCol + rowStrideA) % rowStride;
-            }
-        }
-        if( inAGrid )
-            recvRow = (recvRow + colStrideA) % colStride;
-    }
-    this->auxMemory_.Release();
+    // An elemental distribution is a block distribution with unit blocks, so
+    // view both matrices as such and let the block redistribution engine
+    // route each entry directly from its owner in A's grid to its owner in
+    // this grid (at most one message per pair of processes)
+    BlockDistMatrix<T,MC,MR> ABlock(A.Grid()), BBlock(this->Grid());
+    LockedView( ABlock, A );
+    View( BBlock, *this );
+    BBlock.RedistributeFrom( ABlock );
 }
 
 // Instantiate {Int,Real,Complex<Real>} for each Real in {float,double}
@@ -47,6 +47,7 @@ template<typename T>
 DM& DM::operator=( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("DM[MC,STAR] = DM[MC,STAR]"))
+    CommProfileRegion profile("[MC,STAR] -> [MC,STAR]");
     A.Translate( *this );
     return *this;
 }
@@ -55,6 +56,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [MC,MR]"))
+    CommProfileRegion profile("[MC,MR] -> [MC,STAR]");
     A.RowAllGather( *this );
     return *this;
 }
@@ -63,6 +65,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [STAR,MR]"))
+    CommProfileRegion profile("[STAR,MR] -> [MC,STAR]");
     DistMatrix<T,MC,MR> A_MC_MR(this->Grid());
     A_MC_MR.AlignColsWith(*this);
     A_MC_MR = A;
@@ -74,6 +77,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [MD,STAR]"))
+    CommProfileRegion profile("[MD,STAR] -> [MC,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -84,6 +88,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [STAR,MD]"))
+    CommProfileRegion profile("[STAR,MD] -> [MC,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -94,6 +99,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [MR,MC]"))
+    CommProfileRegion profile("[MR,MC] -> [MC,STAR]");
     auto A_VR_STAR = MakeUnique<DistMatrix<T,VR,STAR>>( A );
     auto A_VC_STAR = MakeUnique<DistMatrix<T,VC,STAR>>( this->Grid() );
     A_VC_STAR->AlignColsWith(*this);
@@ -107,6 +113,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [MR,STAR]"))
+    CommProfileRegion profile("[MR,STAR] -> [MC,STAR]");
     auto A_VR_STAR = MakeUnique<DistMatrix<T,VR,STAR>>( A );
     auto A_VC_STAR = MakeUnique<DistMatrix<T,VC,STAR>>( this->Grid() );
     A_VC_STAR->AlignColsWith(*this);
@@ -120,6 +127,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [STAR,MC]"))
+    CommProfileRegion profile("[STAR,MC] -> [MC,STAR]");
     auto A_MR_MC = MakeUnique<DistMatrix<T,MR,MC>>( A );
     auto A_VR_STAR = MakeUnique<DistMatrix<T,VR,STAR>>( *A_MR_MC );
     A_MR_MC.reset();
@@ -137,6 +145,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [VC,STAR]"))
+    CommProfileRegion profile("[VC,STAR] -> [MC,STAR]");
     A.PartialColAllGather( *this );
     return *this;
 }
@@ -145,6 +154,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [STAR,VC]"))
+    CommProfileRegion profile("[STAR,VC] -> [MC,STAR]");
     auto A_STAR_VR = MakeUnique<DistMatrix<T,STAR,VR>>( A );
     auto A_MC_MR = MakeUnique<DistMatrix<T,MC,MR>>( this->Grid() );
     A_MC_MR->AlignColsWith(*this);
@@ -158,6 +168,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [VR,STAR]"))
+    CommProfileRegion profile("[VR,STAR] -> [MC,STAR]");
     DistMatrix<T,VC,STAR> A_VC_STAR(this->Grid());
     A_VC_STAR.AlignColsWith(*this);
     A_VC_STAR = A;
@@ -169,6 +180,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [STAR,VR]"))
+    CommProfileRegion profile("[STAR,VR] -> [MC,STAR]");
     DistMatrix<T,MC,MR> A_MC_MR(this->Grid());
     A_MC_MR.AlignColsWith(*this);
     A_MC_MR = A;
@@ -180,6 +192,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [STAR,STAR]"))
+    CommProfileRegion profile("[STAR,STAR] -> [MC,STAR]");
     this->ColFilterFrom( A );
     return *this;
 }
@@ -188,6 +201,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MC,STAR] = [CIRC,CIRC]"))
+    CommProfileRegion profile("[CIRC,CIRC] -> [MC,STAR]");
     DistMatrix<T,MC,MR> A_MC_MR( this->Grid() );
     A_MC_MR.AlignWith( *this );
     A_MC_MR = A;
@@ -47,6 +47,7 @@ template<typename T>
 DM& DM::operator=( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("DM[MD,STAR] = DM[MD,STAR]"))
+    CommProfileRegion profile("[MD,STAR] -> [MD,STAR]");
     A.Translate( *this );
     return *this;
 }
@@ -55,6 +56,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [MC,MR]"))
+    CommProfileRegion profile("[MC,MR] -> [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -65,6 +67,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [MC,STAR]"))
+    CommProfileRegion profile("[MC,STAR] -> [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -75,6 +78,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [STAR,MR]"))
+    CommProfileRegion profile("[STAR,MR] -> [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -85,6 +89,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [STAR,MD]"))
+    CommProfileRegion profile("[STAR,MD] -> [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -95,6 +100,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [MR,MC]"))
+    CommProfileRegion profile("[MR,MC] -> [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -105,6 +111,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [MR,STAR]"))
+    CommProfileRegion profile("[MR,STAR] -> [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -115,6 +122,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [STAR,MC]"))
+    CommProfileRegion profile("[STAR,MC] -> [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -125,6 +133,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [VC,STAR]"))
+    CommProfileRegion profile("[VC,STAR] -> [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -135,6 +144,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [STAR,VC]"))
+    CommProfileRegion profile("[STAR,VC] -> [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -145,6 +155,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [VR,STAR]"))
+    CommProfileRegion profile("[VR,STAR] -> [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR(A);
     *this = A_STAR_STAR;
@@ -155,6 +166,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [STAR,VR]"))
+    CommProfileRegion profile("[STAR,VR] -> [MD,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -165,6 +177,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [STAR,STAR]"))
+    CommProfileRegion profile("[STAR,STAR] -> [MD,STAR]");
     this->ColFilterFrom( A );
     return *this;
 }
@@ -173,6 +186,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MD,STAR] = [CIRC,CIRC]"))
+    CommProfileRegion profile("[CIRC,CIRC] -> [MD,STAR]");
     DistMatrix<T,MC,MR> A_MC_MR( this->Grid() );
     A_MC_MR.AlignWith( *this );
     A_MC_MR = A;
@@ -47,6 +47,7 @@ template<typename T>
 DM& DM::operator=( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("DM[MR,MC] = DM[MR,MC]"))
+    CommProfileRegion profile("[MR,MC] -> [MR,MC]");
     A.Translate( *this );
     return *this;
 }
@@ -59,6 +60,7 @@ DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[MC,MR] -> [MR,MC]");
     const El::Grid& g = this->Grid();
     this->Resize( A.Height(), A.Width() );
     if( !this->Participating() )
@@ -259,6 +261,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [MC,STAR]"))
+    CommProfileRegion profile("[MC,STAR] -> [MR,MC]");
     auto A_VC_STAR = MakeUnique<DistMatrix<T,VC,STAR>>( A );
     auto A_VR_STAR = MakeUnique<DistMatrix<T,VR,STAR>>( this->Grid() );
     A_VR_STAR->AlignColsWith(*this);
@@ -272,6 +275,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [STAR,MR]"))
+    CommProfileRegion profile("[STAR,MR] -> [MR,MC]");
     auto A_STAR_VR = MakeUnique<DistMatrix<T,STAR,VR>>( A );
     auto A_STAR_VC = MakeUnique<DistMatrix<T,STAR,VC>>( this->Grid() );
     A_STAR_VC->AlignRowsWith(*this);
@@ -285,6 +289,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [MD,STAR]"))
+    CommProfileRegion profile("[MD,STAR] -> [MR,MC]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -295,6 +300,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [STAR,MD]"))
+    CommProfileRegion profile("[STAR,MD] -> [MR,MC]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -305,6 +311,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [MR,STAR]"))
+    CommProfileRegion profile("[MR,STAR] -> [MR,MC]");
     this->RowFilterFrom( A );
     return *this;
 }
@@ -313,6 +320,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [STAR,MC]"))
+    CommProfileRegion profile("[STAR,MC] -> [MR,MC]");
     this->ColFilterFrom( A );
     return *this;
 }
@@ -321,6 +329,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [VC,STAR]"))
+    CommProfileRegion profile("[VC,STAR] -> [MR,MC]");
     DistMatrix<T,VR,STAR> A_VR_STAR( A );
     *this = A_VR_STAR;
     return *this;
@@ -330,6 +339,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [STAR,VC]"))
+    CommProfileRegion profile("[STAR,VC] -> [MR,MC]");
     A.PartialRowAllToAll( *this );
     return *this;
 }
@@ -338,6 +348,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [VR,STAR]"))
+    CommProfileRegion profile("[VR,STAR] -> [MR,MC]");
     A.PartialColAllToAll( *this );
     return *this;
 }
@@ -346,6 +357,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [STAR,VR]"))
+    CommProfileRegion profile("[STAR,VR] -> [MR,MC]");
     DistMatrix<T,STAR,VC> A_STAR_VC( A );
     *this = A_STAR_VC;
     return *this;
@@ -355,6 +367,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,MC] = [STAR,STAR]"))
+    CommProfileRegion profile("[STAR,STAR] -> [MR,MC]");
     this->FilterFrom( A );
     return *this;
 }
@@ -368,6 +381,7 @@ DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[CIRC,CIRC] -> [MR,MC]");
     const Grid& g = A.Grid();
     const Int m = A.Height();
     const Int n = A.Width();
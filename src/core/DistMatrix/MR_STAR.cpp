@@ -46,6 +46,7 @@ template<typename T>
 DM& DM::operator=( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("DM[MR,STAR] = DM[MR,STAR]"))
+    CommProfileRegion profile("[MR,STAR] -> [MR,STAR]");
     A.Translate( *this );
     return *this;
 }
@@ -54,6 +55,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [MC,MR]"))
+    CommProfileRegion profile("[MC,MR] -> [MR,STAR]");
     auto A_VC_STAR = MakeUnique<DistMatrix<T,VC,STAR>>( A );
     auto A_VR_STAR = MakeUnique<DistMatrix<T,VR,STAR>>( this->Grid() );
     A_VR_STAR->AlignColsWith(*this);
@@ -72,6 +74,7 @@ DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[MC,STAR] -> [MR,STAR]");
     const El::Grid& g = this->Grid();
     if( !this->Participating() )
     {
@@ -159,6 +162,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [STAR,MR]"))
+    CommProfileRegion profile("[STAR,MR] -> [MR,STAR]");
     auto A_MC_MR = MakeUnique<DistMatrix<T,MC,MR>>( A );
     auto A_VC_STAR = MakeUnique<DistMatrix<T,VC,STAR>>( *A_MC_MR );
     A_MC_MR.reset(); 
@@ -176,6 +180,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [MD,STAR]"))
+    CommProfileRegion profile("[MD,STAR] -> [MR,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -186,6 +191,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [STAR,MD]"))
+    CommProfileRegion profile("[STAR,MD] -> [MR,STAR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -196,6 +202,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [MR,MC]"))
+    CommProfileRegion profile("[MR,MC] -> [MR,STAR]");
     A.RowAllGather( *this );
     return *this;
 }
@@ -204,6 +211,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [STAR,MC]"))
+    CommProfileRegion profile("[STAR,MC] -> [MR,STAR]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -213,6 +221,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [VC,STAR]"))
+    CommProfileRegion profile("[VC,STAR] -> [MR,STAR]");
     DistMatrix<T,VR,STAR> A_VR_STAR(this->Grid());
     A_VR_STAR.AlignColsWith(*this);
     A_VR_STAR = A;
@@ -224,6 +233,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [STAR,VC]"))
+    CommProfileRegion profile("[STAR,VC] -> [MR,STAR]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -233,6 +243,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [VR,STAR]"))
+    CommProfileRegion profile("[VR,STAR] -> [MR,STAR]");
     A.PartialColAllGather( *this );
     return *this;
 }
@@ -241,6 +252,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [STAR,VR]"))
+    CommProfileRegion profile("[STAR,VR] -> [MR,STAR]");
     auto A_STAR_VC = MakeUnique<DistMatrix<T,STAR,VC>>( A );
     auto A_MR_MC = MakeUnique<DistMatrix<T,MR,MC>>( this->Grid() );
     A_MR_MC->AlignColsWith(*this);
@@ -255,6 +267,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [STAR,STAR]"))
+    CommProfileRegion profile("[STAR,STAR] -> [MR,STAR]");
     this->ColFilterFrom( A );
     return *this;
 }
@@ -263,6 +276,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[MR,STAR] = [CIRC,CIRC]"))
+    CommProfileRegion profile("[CIRC,CIRC] -> [MR,STAR]");
     DistMatrix<T,MR,MC> A_MR_MC( this->Grid() );
     A_MR_MC.AlignWith( *this );
     A_MR_MC = A;
@@ -46,6 +46,7 @@ template<typename T>
 DM& DM::operator=( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("DM[STAR,MC] = DM[STAR,MC]"))
+    CommProfileRegion profile("[STAR,MC] -> [STAR,MC]");
     A.Translate( *this );
     return *this;
 }
@@ -54,6 +55,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [MC,MR]"))
+    CommProfileRegion profile("[MC,MR] -> [STAR,MC]");
     auto A_STAR_VR = MakeUnique<DistMatrix<T,STAR,VR>>( A );
     auto A_STAR_VC = MakeUnique<DistMatrix<T,STAR,VC>>( this->Grid() );
     A_STAR_VC->AlignRowsWith(*this);
@@ -68,6 +70,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [MC,STAR]"))
+    CommProfileRegion profile("[MC,STAR] -> [STAR,MC]");
     auto A_MC_MR = MakeUnique<DistMatrix<T,MC,MR>>( A );
     auto A_STAR_VR = MakeUnique<DistMatrix<T,STAR,VR>>( *A_MC_MR );
     A_MC_MR.reset(); 
@@ -89,6 +92,7 @@ DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[STAR,MR] -> [STAR,MC]");
     const El::Grid& g = this->Grid();
     if( A.Height() == 1 )
     {
@@ -175,6 +179,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [MD,STAR]"))
+    CommProfileRegion profile("[MD,STAR] -> [STAR,MC]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -185,6 +190,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [STAR,MD]"))
+    CommProfileRegion profile("[STAR,MD] -> [STAR,MC]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -195,6 +201,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [MR,MC]"))
+    CommProfileRegion profile("[MR,MC] -> [STAR,MC]");
     A.ColAllGather( *this );
     return *this;
 }
@@ -203,6 +210,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [MR,STAR]"))
+    CommProfileRegion profile("[MR,STAR] -> [STAR,MC]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -212,6 +220,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [VC,STAR]"))
+    CommProfileRegion profile("[VC,STAR] -> [STAR,MC]");
     auto A_VR_STAR = MakeUnique<DistMatrix<T,VR,STAR>>( A );
     auto A_MR_MC = MakeUnique<DistMatrix<T,MR,MC>>( this->Grid() );
     A_MR_MC->AlignRowsWith(*this);
@@ -226,6 +235,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [STAR,VC]"))
+    CommProfileRegion profile("[STAR,VC] -> [STAR,MC]");
     A.PartialRowAllGather( *this );
     return *this;
 }
@@ -234,6 +244,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [VR,STAR]"))
+    CommProfileRegion profile("[VR,STAR] -> [STAR,MC]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -243,6 +254,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [STAR,VR]"))
+    CommProfileRegion profile("[STAR,VR] -> [STAR,MC]");
     DistMatrix<T,STAR,VC> A_STAR_VC(this->Grid());
     A_STAR_VC.AlignRowsWith(*this);
     *this = A_STAR_VC = A;
@@ -253,6 +265,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [STAR,STAR]"))
+    CommProfileRegion profile("[STAR,STAR] -> [STAR,MC]");
     this->RowFilterFrom( A );
     return *this;
 }
@@ -261,6 +274,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MC] = [CIRC,CIRC]"))
+    CommProfileRegion profile("[CIRC,CIRC] -> [STAR,MC]");
     DistMatrix<T,MR,MC> A_MR_MC( A.Grid() );
     A_MR_MC.AlignWith( *this );
     A_MR_MC = A;
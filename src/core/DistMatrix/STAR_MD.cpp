@@ -46,6 +46,7 @@ template<typename T>
 DM& DM::operator=( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("DM[STAR,MD] = DM[STAR,MD]"))
+    CommProfileRegion profile("[STAR,MD] -> [STAR,MD]");
     A.Translate( *this );
     return *this;
 }
@@ -54,6 +55,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MD] = [MC,MR]"))
+    CommProfileRegion profile("[MC,MR] -> [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -64,6 +66,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MD] = [MC,STAR]"))
+    CommProfileRegion profile("[MC,STAR] -> [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -74,6 +77,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MD] = [STAR,MR]"))
+    CommProfileRegion profile("[STAR,MR] -> [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -84,6 +88,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MD] = [MD,STAR]"))
+    CommProfileRegion profile("[MD,STAR] -> [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -94,6 +99,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MD] = [MR,MC]"))
+    CommProfileRegion profile("[MR,MC] -> [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -104,6 +110,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MD] = [MR,STAR]"))
+    CommProfileRegion profile("[MR,STAR] -> [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -114,6 +121,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MD] = [STAR,MC]"))
+    CommProfileRegion profile("[STAR,MC] -> [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -124,6 +132,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MD] = [VC,STAR]"))
+    CommProfileRegion profile("[VC,STAR] -> [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -134,6 +143,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MD] = [STAR,VC]"))
+    CommProfileRegion profile("[STAR,VC] -> [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -144,6 +154,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MD] = [VR,STAR]"))
+    CommProfileRegion profile("[VR,STAR] -> [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -154,6 +165,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MD] = [STAR,VR]"))
+    CommProfileRegion profile("[STAR,VR] -> [STAR,MD]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -164,6 +176,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MD] = [STAR,STAR]"))
+    CommProfileRegion profile("[STAR,STAR] -> [STAR,MD]");
     this->RowFilterFrom( A );
     return *this;
 }
@@ -172,6 +185,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MD] = [CIRC,CIRC]"))
+    CommProfileRegion profile("[CIRC,CIRC] -> [STAR,MD]");
     DistMatrix<T,MC,MR> A_MC_MR( A.Grid() );
     A_MC_MR.AlignWith( *this );
     A_MC_MR = A;
@@ -46,6 +46,7 @@ template<typename T>
 DM& DM::operator=( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("DM[STAR,MR] = DM[STAR,MR]"))
+    CommProfileRegion profile("[STAR,MR] -> [STAR,MR]");
     A.Translate( *this );
     return *this;
 }
@@ -54,6 +55,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MR] = [MC,MR]"))
+    CommProfileRegion profile("[MC,MR] -> [STAR,MR]");
     A.ColAllGather( *this );
     return *this;
 }
@@ -62,6 +64,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MR] = [MC,STAR]"))
+    CommProfileRegion profile("[MC,STAR] -> [STAR,MR]");
     DistMatrix<T,MC,MR> A_MC_MR(this->Grid());
     A_MC_MR.AlignRowsWith(*this);
     A_MC_MR = A;
@@ -73,6 +76,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MR] = [MD,STAR]"))
+    CommProfileRegion profile("[MD,STAR] -> [STAR,MR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -83,6 +87,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MR] = [STAR,MD]"))
+    CommProfileRegion profile("[STAR,MD] -> [STAR,MR]");
     // TODO: More efficient implementation?
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -93,6 +98,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MR] = [MR,MC]"))
+    CommProfileRegion profile("[MR,MC] -> [STAR,MR]");
     auto A_STAR_VC = MakeUnique<DistMatrix<T,STAR,VC>>( A );
     auto A_STAR_VR = MakeUnique<DistMatrix<T,STAR,VR>>( this->Grid() );
     A_STAR_VR->AlignRowsWith(*this);
@@ -107,6 +113,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MR] = [MR,STAR]"))
+    CommProfileRegion profile("[MR,STAR] -> [STAR,MR]");
     auto A_VR_STAR = MakeUnique<DistMatrix<T,VR,STAR>>( A );
     auto A_VC_STAR = MakeUnique<DistMatrix<T,VC,STAR>>( *A_VR_STAR );
     A_VR_STAR.reset(); 
@@ -124,6 +131,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MR] = [STAR,MC]"))
+    CommProfileRegion profile("[STAR,MC] -> [STAR,MR]");
     auto A_STAR_VC = MakeUnique<DistMatrix<T,STAR,VC>>( A );
     auto A_STAR_VR = MakeUnique<DistMatrix<T,STAR,VR>>( this->Grid() );
     A_STAR_VR->AlignRowsWith(*this);
@@ -141,6 +149,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MR] = [VC,STAR]"))
+    CommProfileRegion profile("[VC,STAR] -> [STAR,MR]");
     DistMatrix<T,MC,MR> A_MC_MR(this->Grid());
     A_MC_MR.AlignRowsWith(*this);
     A_MC_MR = A;
@@ -152,6 +161,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MR] = [STAR,VC]"))
+    CommProfileRegion profile("[STAR,VC] -> [STAR,MR]");
     DistMatrix<T,STAR,VR> A_STAR_VR(this->Grid());
     A_STAR_VR.AlignRowsWith(*this);
     A_STAR_VR = A;
@@ -163,6 +173,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MR] = [VR,STAR]"))
+    CommProfileRegion profile("[VR,STAR] -> [STAR,MR]");
     auto A_VC_STAR = MakeUnique<DistMatrix<T,VC,STAR>>( A );
     auto A_MC_MR = MakeUnique<DistMatrix<T,MC,MR>>( this->Grid() );
     A_MC_MR->AlignRowsWith(*this);
@@ -177,6 +188,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,MR] = [STAR,VR]"))
+    CommProfileRegion profile("[STAR,VR] -> [STAR,MR]");
     A.PartialRowAllGather( *this );
     return *this;
 }
@@ -185,6 +197,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MR] = [STAR,STAR]"))
+    CommProfileRegion profile("[STAR,STAR] -> [STAR,MR]");
     this->RowFilterFrom( A );
     return *this;
 }
@@ -193,6 +206,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,MR] = [CIRC,CIRC]"))
+    CommProfileRegion profile("[CIRC,CIRC] -> [STAR,MR]");
     DistMatrix<T,MC,MR> A_MC_MR( A );
     A_MC_MR.AlignWith( *this );
     A_MC_MR = A;
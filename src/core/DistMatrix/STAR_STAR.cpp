@@ -46,6 +46,7 @@ template<typename T>
 DM& DM::operator=( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [STAR,STAR]"))
+    CommProfileRegion profile("[STAR,STAR] -> [STAR,STAR]");
     this->Resize( A.Height(), A.Width() );
     if( this->Grid() == A.Grid() )
     {
@@ -117,6 +118,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [MC,MR]"))
+    CommProfileRegion profile("[MC,MR] -> [STAR,STAR]");
     A.AllGather( *this );
     return *this;
 }
@@ -125,6 +127,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [MC,STAR]"))
+    CommProfileRegion profile("[MC,STAR] -> [STAR,STAR]");
     A.ColAllGather( *this );
     return *this;
 }
@@ -133,6 +136,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [STAR,MR]"))
+    CommProfileRegion profile("[STAR,MR] -> [STAR,STAR]");
     A.RowAllGather( *this );
     return *this;
 }
@@ -141,6 +145,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [MD,STAR]"))
+    CommProfileRegion profile("[MD,STAR] -> [STAR,STAR]");
     A.ColAllGather( *this );
     return *this;
 }
@@ -149,6 +154,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [STAR,MD]"))
+    CommProfileRegion profile("[STAR,MD] -> [STAR,STAR]");
     A.RowAllGather( *this );
     return *this;
 }
@@ -157,6 +163,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [MR,MC]"))
+    CommProfileRegion profile("[MR,MC] -> [STAR,STAR]");
     A.AllGather( *this );
     return *this;
 }
@@ -165,6 +172,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [MR,STAR]"))
+    CommProfileRegion profile("[MR,STAR] -> [STAR,STAR]");
     A.ColAllGather( *this );
     return *this;
 }
@@ -173,6 +181,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [STAR,MC]"))
+    CommProfileRegion profile("[STAR,MC] -> [STAR,STAR]");
     A.RowAllGather( *this );
     return *this;
 }
@@ -181,6 +190,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [VC,STAR]"))
+    CommProfileRegion profile("[VC,STAR] -> [STAR,STAR]");
     A.ColAllGather( *this );
     return *this;
 }
@@ -189,6 +199,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [STAR,VC]"))
+    CommProfileRegion profile("[STAR,VC] -> [STAR,STAR]");
     A.RowAllGather( *this );
     return *this;
 }
@@ -197,6 +208,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [VR,STAR]"))
+    CommProfileRegion profile("[VR,STAR] -> [STAR,STAR]");
     A.ColAllGather( *this );
     return *this;
 }
@@ -205,6 +217,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [STAR,VR]"))
+    CommProfileRegion profile("[STAR,VR] -> [STAR,STAR]");
     A.RowAllGather( *this );
     return *this;
 }
@@ -213,6 +226,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,STAR] = [CIRC,CIRC]"))
+    CommProfileRegion profile("[CIRC,CIRC] -> [STAR,STAR]");
     const Grid& g = A.Grid();
     const Int m = A.Height(); 
     const Int n = A.Width();
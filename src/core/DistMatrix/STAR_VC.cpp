@@ -46,6 +46,7 @@ template<typename T>
 DM& DM::operator=( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("DM[STAR,VC] = DM[STAR,VC]"))
+    CommProfileRegion profile("[STAR,VC] -> [STAR,VC]");
     A.Translate( *this );
     return *this;
 }
@@ -54,6 +55,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [MC,MR]"))
+    CommProfileRegion profile("[MC,MR] -> [STAR,VC]");
     DistMatrix<T,STAR,VR> A_STAR_VR( A );
     *this = A_STAR_VR;
     return *this;
@@ -63,6 +65,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [MC,STAR]"))
+    CommProfileRegion profile("[MC,STAR] -> [STAR,VC]");
     auto A_MC_MR = MakeUnique<DistMatrix<T,MC,MR>>( A );
     auto A_STAR_VR = MakeUnique<DistMatrix<T,STAR,VR>>( *A_MC_MR );
     A_MC_MR.reset(); 
@@ -74,6 +77,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [STAR,MR]"))
+    CommProfileRegion profile("[STAR,MR] -> [STAR,VC]");
     DistMatrix<T,STAR,VR> A_STAR_VR( A );
     *this = A_STAR_VR;
     return *this;
@@ -83,6 +87,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [MD,STAR]"))
+    CommProfileRegion profile("[MD,STAR] -> [STAR,VC]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -93,6 +98,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [STAR,MD]"))
+    CommProfileRegion profile("[STAR,MD] -> [STAR,VC]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -103,6 +109,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [MR,MC]"))
+    CommProfileRegion profile("[MR,MC] -> [STAR,VC]");
     this->PartialRowAllToAllFrom( A );
     return *this;
 }
@@ -111,6 +118,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [MR,STAR]"))
+    CommProfileRegion profile("[MR,STAR] -> [STAR,VC]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -120,6 +128,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [STAR,MC]"))
+    CommProfileRegion profile("[STAR,MC] -> [STAR,VC]");
     this->PartialRowFilterFrom( A );
     return *this;
 }
@@ -128,6 +137,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [VC,STAR]"))
+    CommProfileRegion profile("[VC,STAR] -> [STAR,VC]");
     auto A_MC_MR = MakeUnique<DistMatrix<T,MC,MR>>( A );
     auto A_STAR_VR = MakeUnique<DistMatrix<T,STAR,VR>>( *A_MC_MR );
     A_MC_MR.reset(); 
@@ -139,6 +149,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [VR,STAR]"))
+    CommProfileRegion profile("[VR,STAR] -> [STAR,VC]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -152,6 +163,7 @@ DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[STAR,VR] -> [STAR,VC]");
     const Grid& g = this->Grid();
     this->Resize( A.Height(), A.Width() );
     if( !this->Participating() )
@@ -218,6 +230,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VC] = [STAR,STAR]"))
+    CommProfileRegion profile("[STAR,STAR] -> [STAR,VC]");
     this->RowFilterFrom( A );
     return *this;
 }
@@ -231,6 +244,7 @@ DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[CIRC,CIRC] -> [VC,STAR]");
     const Grid& g = A.Grid();
     const Int m = A.Height();
     const Int n = A.Width();
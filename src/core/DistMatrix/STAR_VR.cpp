@@ -46,6 +46,7 @@ template<typename T>
 DM& DM::operator=( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("DM[STAR,VR] = DM[STAR,VR]"))
+    CommProfileRegion profile("[STAR,VR] -> [STAR,VR]");
     A.Translate( *this );
     return *this;
 }
@@ -54,6 +55,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [MC,MR]"))
+    CommProfileRegion profile("[MC,MR] -> [STAR,VR]");
     this->PartialRowAllToAllFrom( A );
     return *this;
 }
@@ -62,6 +64,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [MC,STAR]"))
+    CommProfileRegion profile("[MC,STAR] -> [STAR,VR]");
     DistMatrix<T,MC,MR> A_MC_MR( A );
     *this = A_MC_MR;
     return *this;
@@ -71,6 +74,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [STAR,MR]"))
+    CommProfileRegion profile("[STAR,MR] -> [STAR,VR]");
     this->PartialRowFilterFrom( A );
     return *this;
 }
@@ -79,6 +83,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [MD,STAR]"))
+    CommProfileRegion profile("[MD,STAR] -> [STAR,VR]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -89,6 +94,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [STAR,MD]"))
+    CommProfileRegion profile("[STAR,MD] -> [STAR,VR]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -99,6 +105,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [MR,MC]"))
+    CommProfileRegion profile("[MR,MC] -> [STAR,VR]");
     DistMatrix<T,STAR,VC> A_STAR_VC( A );
     *this = A_STAR_VC;
     return *this;
@@ -108,6 +115,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [MR,STAR]"))
+    CommProfileRegion profile("[MR,STAR] -> [STAR,VR]");
     auto A_MR_MC = MakeUnique<DistMatrix<T,MR,MC>>( A );
     auto A_STAR_VC = MakeUnique<DistMatrix<T,STAR,VC>>( *A_MR_MC );
     A_MR_MC.reset(); 
@@ -119,6 +127,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [STAR,MC]"))
+    CommProfileRegion profile("[STAR,MC] -> [STAR,VR]");
     DistMatrix<T,STAR,VC> A_STAR_VC( A );
     *this = A_STAR_VC;
     return *this;
@@ -128,6 +137,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [VC,STAR]"))
+    CommProfileRegion profile("[VC,STAR] -> [STAR,VR]");
     DistMatrix<T,MC,MR> A_MC_MR( A );
     *this = A_MC_MR;
     return *this;
@@ -141,6 +151,7 @@ DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[STAR,VC] -> [STAR,VR]");
     const El::Grid& g = this->Grid();
     this->Resize( A.Height(), A.Width() );
     if( !this->Participating() )
@@ -207,6 +218,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [VR,STAR]"))
+    CommProfileRegion profile("[VR,STAR] -> [STAR,VR]");
     auto A_MR_MC = MakeUnique<DistMatrix<T,MR,MC>>( A );
     auto A_STAR_VC = MakeUnique<DistMatrix<T,STAR,VC>>( *A_MR_MC );
     A_MR_MC.reset(); 
@@ -218,6 +230,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[STAR,VR] = [STAR,STAR]"))
+    CommProfileRegion profile("[STAR,STAR] -> [STAR,VR]");
     this->RowFilterFrom( A );
     return *this;
 }
@@ -231,6 +244,7 @@ DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[CIRC,CIRC] -> [VR,STAR]");
     const Grid& g = A.Grid();
     const Int m = A.Height();
     const Int n = A.Width();
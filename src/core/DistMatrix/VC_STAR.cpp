@@ -46,6 +46,7 @@ template<typename T>
 DM& DM::operator=( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("DM[VC,STAR] = DM[VC,STAR]"))
+    CommProfileRegion profile("[VC,STAR] -> [VC,STAR]");
     A.Translate( *this );
     return *this;
 }
@@ -54,6 +55,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [MC,MR]"))
+    CommProfileRegion profile("[MC,MR] -> [VC,STAR]");
     this->PartialColAllToAllFrom( A );
     return *this;
 }
@@ -62,6 +64,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [MC,STAR]"))
+    CommProfileRegion profile("[MC,STAR] -> [VC,STAR]");
     this->PartialColFilterFrom( A );
     return *this;
 }
@@ -70,6 +73,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [STAR,MR]"))
+    CommProfileRegion profile("[STAR,MR] -> [VC,STAR]");
     DistMatrix<T,MC,MR> A_MC_MR( A );
     *this = A_MC_MR;
     return *this;
@@ -79,6 +83,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [MD,STAR]"))
+    CommProfileRegion profile("[MD,STAR] -> [VC,STAR]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -89,6 +94,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [STAR,MD]"))
+    CommProfileRegion profile("[STAR,MD] -> [VC,STAR]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -99,6 +105,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [MR,MC]"))
+    CommProfileRegion profile("[MR,MC] -> [VC,STAR]");
     DistMatrix<T,VR,STAR> A_VR_STAR( A );
     *this = A_VR_STAR;
     return *this;
@@ -108,6 +115,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [MR,STAR]"))
+    CommProfileRegion profile("[MR,STAR] -> [VC,STAR]");
     DistMatrix<T,VR,STAR> A_VR_STAR( A );
     *this = A_VR_STAR;
     return *this;
@@ -117,6 +125,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [STAR,MC]"))
+    CommProfileRegion profile("[STAR,MC] -> [VC,STAR]");
     auto A_MR_MC = MakeUnique<DistMatrix<T,MR,MC>>( A );
     auto A_VR_STAR = MakeUnique<DistMatrix<T,VR,STAR>>( *A_MR_MC );
     A_MR_MC.reset(); 
@@ -128,6 +137,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [STAR,VC]"))
+    CommProfileRegion profile("[STAR,VC] -> [VC,STAR]");
     auto A_MR_MC = MakeUnique<DistMatrix<T,MR,MC>>( A );
     auto A_VR_STAR = MakeUnique<DistMatrix<T,VR,STAR>>( *A_MR_MC );
     A_MR_MC.reset(); 
@@ -143,6 +153,7 @@ DM& DM::operator=( const DistMatrix<T,VR,STAR>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[VR,STAR] -> [VC,STAR]");
     const Grid& g = this->Grid();
     this->Resize( A.Height(), A.Width() );
     if( !this->Participating() )
@@ -210,6 +221,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [STAR,VR]"))
+    CommProfileRegion profile("[STAR,VR] -> [VC,STAR]");
     DistMatrix<T,MC,MR> A_MC_MR( A );
     *this = A_MC_MR;
     return *this;
@@ -219,6 +231,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[VC,STAR] = [STAR,STAR]"))
+    CommProfileRegion profile("[STAR,STAR] -> [VC,STAR]");
     this->ColFilterFrom( A );
     return *this;
 }
@@ -232,6 +245,7 @@ DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[CIRC,CIRC] -> [VC,STAR]");
     const Grid& g = A.Grid();
     const Int m = A.Height();
     const Int n = A.Width();
@@ -46,6 +46,7 @@ template<typename T>
 DM& DM::operator=( const DM& A )
 {
     DEBUG_ONLY(CallStackEntry cse("DM[VR,STAR] = DM[VR,STAR]"))
+    CommProfileRegion profile("[VR,STAR] -> [VR,STAR]");
     A.Translate( *this );
     return *this;
 }
@@ -54,6 +55,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [MC,MR]"))
+    CommProfileRegion profile("[MC,MR] -> [VR,STAR]");
     DistMatrix<T,VC,STAR> A_VC_STAR( A );
     *this = A_VC_STAR;
     return *this;
@@ -63,6 +65,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MC,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [MC,STAR]"))
+    CommProfileRegion profile("[MC,STAR] -> [VR,STAR]");
     DistMatrix<T,VC,STAR> A_VC_STAR( A );
     *this = A_VC_STAR;
     return *this;
@@ -72,6 +75,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [STAR,MR]"))
+    CommProfileRegion profile("[STAR,MR] -> [VR,STAR]");
     auto A_MC_MR = MakeUnique<DistMatrix<T,MC,MR>>( A );
     auto A_VC_STAR = MakeUnique<DistMatrix<T,VC,STAR>>( *A_MC_MR );
     A_MC_MR.reset(); 
@@ -83,6 +87,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MD,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [MD,STAR]"))
+    CommProfileRegion profile("[MD,STAR] -> [VR,STAR]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -93,6 +98,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MD>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [STAR,MD]"))
+    CommProfileRegion profile("[STAR,MD] -> [VR,STAR]");
     // TODO: Optimize this later if important
     DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
     *this = A_STAR_STAR;
@@ -103,6 +109,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [MR,MC]"))
+    CommProfileRegion profile("[MR,MC] -> [VR,STAR]");
     this->PartialColAllToAllFrom( A );
     return *this;
 }
@@ -111,6 +118,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,MR,STAR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [MR,STAR]"))
+    CommProfileRegion profile("[MR,STAR] -> [VR,STAR]");
     this->PartialColFilterFrom( A );
     return *this;
 }
@@ -119,6 +127,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,MC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [STAR,MC]"))
+    CommProfileRegion profile("[STAR,MC] -> [VR,STAR]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -132,6 +141,7 @@ DM& DM::operator=( const DistMatrix<T,VC,STAR>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[VC,STAR] -> [VR,STAR]");
     const El::Grid& g = this->Grid();
     this->Resize( A.Height(), A.Width() );
     if( !this->Participating() )
@@ -199,6 +209,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VC>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [STAR,VC]"))
+    CommProfileRegion profile("[STAR,VC] -> [VR,STAR]");
     DistMatrix<T,MR,MC> A_MR_MC( A );
     *this = A_MR_MC;
     return *this;
@@ -208,6 +219,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,VR>& A )
 { 
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [STAR,VR]"))
+    CommProfileRegion profile("[STAR,VR] -> [VR,STAR]");
     auto A_MC_MR = MakeUnique<DistMatrix<T,MC,MR>>( A );
     auto A_VC_STAR = MakeUnique<DistMatrix<T,VC,STAR>>( *A_MC_MR );
     A_MC_MR.reset(); 
@@ -219,6 +231,7 @@ template<typename T>
 DM& DM::operator=( const DistMatrix<T,STAR,STAR>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("[VR,STAR] = [STAR,STAR]"))
+    CommProfileRegion profile("[STAR,STAR] -> [VR,STAR]");
     this->ColFilterFrom( A );
     return *this;
 }
@@ -232,6 +245,7 @@ DM& DM::operator=( const DistMatrix<T,CIRC,CIRC>& A )
         AssertSameGrids( *this, A );
         this->AssertNotLocked();
     )
+    CommProfileRegion profile("[CIRC,CIRC] -> [VR,STAR]");
     const Grid& g = A.Grid();
     const Int m = A.Height();
     const Int n = A.Width();
@@ -9,6 +9,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include "./SparseAssembly.hpp"
 
 namespace El {
 
@@ -52,6 +53,7 @@ void DistSparseMatrix<T>::Empty()
 {
     distGraph_.Empty();
     SwapClear( vals_ );
+    patternLocked_ = false;
     multMeta.Clear();
 }
 
@@ -60,6 +62,8 @@ void DistSparseMatrix<T>::Resize( int height, int width )
 {
     distGraph_.Resize( height, width );
     SwapClear( vals_ );
+    patternLocked_ = false;
+    multMeta.Clear();
 }
 
 // Change the distribution
@@ -69,6 +73,8 @@ void DistSparseMatrix<T>::SetComm( mpi::Comm comm )
 { 
     distGraph_.SetComm( comm ); 
     SwapClear( vals_ );
+    patternLocked_ = false;
+    multMeta.Clear();
 }
 
 // Assembly
@@ -124,6 +130,11 @@ template<typename T>
 void DistSparseMatrix<T>::QueueLocalUpdate( Int localRow, Int col, T value )
 {
     DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix::QueueLocalUpdate"))
+    if( patternLocked_ )
+    {
+        vals_[LocalIndex(localRow,col)] += value;
+        return;
+    }
     distGraph_.QueueLocalConnection( localRow, col );
     vals_.push_back( value );
     multMeta.ready = false;
@@ -140,11 +151,35 @@ void DistSparseMatrix<T>::QueueZero( Int row, Int col )
 template<typename T>
 void DistSparseMatrix<T>::QueueLocalZero( Int localRow, Int col )
 {
-    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix::QueueZero"))
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix::QueueLocalZero"))
+    if( patternLocked_ )
+        LogicError("Cannot remove entries while the pattern is locked");
     distGraph_.QueueLocalDisconnection( localRow, col );
     multMeta.ready = false;
 }
 
+template<typename T>
+void DistSparseMatrix<T>::LockPattern()
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix::LockPattern"))
+    MakeConsistent();
+    patternLocked_ = true;
+}
+
+template<typename T>
+void DistSparseMatrix<T>::UnlockPattern()
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix::UnlockPattern"))
+    patternLocked_ = false;
+}
+
+template<typename T>
+void DistSparseMatrix<T>::ZeroValues()
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSparseMatrix::ZeroValues"))
+    MemZero( vals_.data(), vals_.size() );
+}
+
 template<typename T>
 void DistSparseMatrix<T>::MakeConsistent()
 {
@@ -157,59 +192,13 @@ void DistSparseMatrix<T>::MakeConsistent()
 
     if( !distGraph_.consistent_ )
     {
-        const Int numLocalEntries = vals_.size();
-        Int numRemoved = 0;
-        std::vector<Entry<T>> entries( numLocalEntries );
-        for( Int s=0; s<numLocalEntries; ++s )
-        {
-            std::pair<Int,Int> 
-              candidate(distGraph_.sources_[s],distGraph_.targets_[s]);
-            if( distGraph_.markedForRemoval_.find(candidate) ==
-                distGraph_.markedForRemoval_.end() )
-            {
-                entries[s-numRemoved].indices[0] = distGraph_.sources_[s];
-                entries[s-numRemoved].indices[1] = distGraph_.targets_[s];
-                entries[s-numRemoved].value = vals_[s];
-            }
-            else
-            {
-                ++numRemoved;
-            }
-        }
-        distGraph_.markedForRemoval_.clear();
-        entries.resize( numLocalEntries-numRemoved );
-        std::sort( entries.begin(), entries.end(), CompareEntries );
-
-        // Compress out duplicates
-        Int lastUnique=0;
-        for( Int s=1; s<numLocalEntries; ++s )
-        {
-            if( entries[s].indices[0] != entries[lastUnique].indices[0] ||
-                entries[s].indices[1] != entries[lastUnique].indices[1] )
-            {
-                ++lastUnique;
-                if( s != lastUnique )
-                {
-                    entries[lastUnique].indices[0] = entries[s].indices[0];
-                    entries[lastUnique].indices[1] = entries[s].indices[1];
-                    entries[lastUnique].value = entries[s].value;
-                }
-            }
-            else
-                entries[lastUnique].value += entries[s].value;
-        }
-        const Int numUnique = lastUnique+1;
-        entries.resize( numUnique );
-
-        distGraph_.sources_.resize( numUnique );
-        distGraph_.targets_.resize( numUnique );
-        vals_.resize( numUnique );
-        for( int s=0; s<numUnique; ++s )
-        {
-            distGraph_.sources_[s] = entries[s].indices[0];
-            distGraph_.targets_[s] = entries[s].indices[1];
-            vals_[s] = entries[s].value;
-        }
+        const Int numLocalEntries = assembly::Consolidate
+        ( distGraph_.firstLocalSource_, distGraph_.numLocalSources_, 
+          vals_.size(), distGraph_.sources_.data(), distGraph_.targets_.data(), 
+          vals_.data(), distGraph_.markedForRemoval_ );
+        distGraph_.sources_.resize( numLocalEntries );
+        distGraph_.targets_.resize( numLocalEntries );
+        vals_.resize( numLocalEntries );
 
         distGraph_.ComputeEdgeOffsets();
 
@@ -259,6 +248,9 @@ template<typename T>
 bool DistSparseMatrix<T>::Consistent() const
 { return distGraph_.Consistent(); }
 
+template<typename T>
+bool DistSparseMatrix<T>::PatternLocked() const { return patternLocked_; }
+
 // Distribution information
 // ------------------------
 template<typename T>
@@ -296,6 +288,33 @@ Int DistSparseMatrix<T>::NumConnections( Int localRow ) const
     return distGraph_.NumConnections( localRow );
 }
 
+template<typename T>
+Int DistSparseMatrix<T>::LocalIndex( Int localRow, Int col ) const
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistSparseMatrix::LocalIndex");
+        AssertConsistent();
+        if( localRow < 0 || localRow >= LocalHeight() )
+            LogicError
+            ("Local row ",localRow," is not in [0,",LocalHeight(),")");
+    )
+    if( NumLocalEntries() == 0 )
+        LogicError
+        ("Entry (",FirstLocalRow()+localRow,",",col,
+         ") is not in the sparsity pattern");
+    // The columns of each row are sorted
+    const std::vector<Int>& targets = distGraph_.targets_;
+    const std::vector<Int>& offs = distGraph_.localEdgeOffsets_;
+    auto rowBeg = targets.cbegin() + offs[localRow];
+    auto rowEnd = targets.cbegin() + offs[localRow+1];
+    auto it = std::lower_bound( rowBeg, rowEnd, col );
+    if( it == rowEnd || *it != col )
+        LogicError
+        ("Entry (",FirstLocalRow()+localRow,",",col,
+         ") is not in the sparsity pattern");
+    return it - targets.cbegin();
+}
+
 template<typename T>
 T DistSparseMatrix<T>::Value( Int localInd ) const
 { 
@@ -327,13 +346,157 @@ template<typename T>
 const T* DistSparseMatrix<T>::LockedValueBuffer() const
 { return vals_.data(); }
 
-// Auxiliary routines
-// ==================
+template<typename T>
+const Int* DistSparseMatrix<T>::LockedOffsetBuffer() const
+{ return distGraph_.LockedOffsetBuffer(); }
+
+// Communication metadata
+// ======================
 
 template<typename T>
-bool DistSparseMatrix<T>::CompareEntries( const Entry<T>& a, const Entry<T>& b )
-{ return a.indices[0] < b.indices[0] || 
-         (a.indices[0] == b.indices[0] && a.indices[1] < b.indices[1]); }
+const SparseMultMeta<T>& DistSparseMatrix<T>::InitializeMultMeta() const
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("DistSparseMatrix::InitializeMultMeta");
+        AssertConsistent();
+    )
+    SparseMultMeta<T>& meta = multMeta;
+    if( meta.ready )
+        return meta;
+    meta.transposeMeta.Clear();
+
+    mpi::Comm comm = Comm();
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    // The rows of X in a normal multiply (and of Y in the adjoint case) are
+    // distributed like those of a DistMultiVec of height Width()
+    const Int blocksize = Width() / commSize;
+    const Int localHeight = LocalHeight();
+    const Int numLocalEntries = NumLocalEntries();
+    const Int* colBuf = LockedTargetBuffer();
+    Timer timer;
+
+    // Compute the sorted set of row indices that we need from X in a normal
+    // multiply or update of Y in the adjoint case. When the columns fall
+    // within a range that is not much larger than the number of nonzeros,
+    // a dense map of that range also provides the index of each nonzero;
+    // otherwise we fall back to sorting a copy of the column indices.
+    timer.Start();
+    Int minCol=0, maxCol=-1;
+    if( numLocalEntries != 0 )
+    {
+        minCol = maxCol = colBuf[0];
+        for( Int e=1; e<numLocalEntries; ++e )
+        {
+            minCol = Min( minCol, colBuf[e] );
+            maxCol = Max( maxCol, colBuf[e] );
+        }
+    }
+    const Int colSpan = maxCol - minCol + 1;
+    const bool denseMap = ( colSpan <= 2*numLocalEntries + localHeight );
+    std::vector<Int> recvInds, colMap;
+    if( denseMap )
+    {
+        colMap.resize( colSpan, -1 );
+        for( Int e=0; e<numLocalEntries; ++e )
+            colMap[colBuf[e]-minCol] = 0;
+        Int numRecvInds = 0;
+        for( Int k=0; k<colSpan; ++k )
+            if( colMap[k] == 0 )
+                ++numRecvInds;
+        recvInds.resize( numRecvInds );
+        for( Int k=0, off=0; k<colSpan; ++k )
+        {
+            if( colMap[k] == 0 )
+            {
+                recvInds[off] = k + minCol;
+                colMap[k] = off++;
+            }
+        }
+    }
+    else
+    {
+        recvInds.assign( colBuf, colBuf+numLocalEntries );
+        std::sort( recvInds.begin(), recvInds.end() );
+        recvInds.erase
+        ( std::unique( recvInds.begin(), recvInds.end() ), recvInds.end() );
+    }
+    const Int numRecvInds = recvInds.size();
+    meta.recvSizes.assign( commSize, 0 );
+    meta.recvOffs.assign( commSize, 0 );
+    for( Int s=0; s<numRecvInds; ++s )
+        ++meta.recvSizes[RowToProcess(recvInds[s],blocksize,commSize)];
+    for( int q=0; q<commSize-1; ++q )
+        meta.recvOffs[q+1] = meta.recvOffs[q] + meta.recvSizes[q];
+    meta.numRecvInds = numRecvInds;
+    meta.discoveryTime = timer.Stop();
+
+    // Coordinate
+    timer.Start();
+    meta.sendSizes.resize( commSize );
+    mpi::AllToAll( meta.recvSizes.data(), 1, meta.sendSizes.data(), 1, comm );
+    Int numSendInds=0;
+    meta.sendOffs.resize( commSize );
+    for( int q=0; q<commSize; ++q )
+    {
+        meta.sendOffs[q] = numSendInds;
+        numSendInds += meta.sendSizes[q];
+    }
+    meta.sendInds.resize( numSendInds );
+    mpi::AllToAll
+    ( recvInds.data(), meta.recvSizes.data(), meta.recvOffs.data(),
+      meta.sendInds.data(), meta.sendSizes.data(), meta.sendOffs.data(), 
+      comm );
+    meta.exchangeTime = timer.Stop();
+
+    // Map each nonzero to the index of its column within recvInds
+    timer.Start();
+    meta.colOffs.resize( numLocalEntries );
+    if( denseMap )
+    {
+        EL_PARALLEL_FOR
+        for( Int e=0; e<numLocalEntries; ++e )
+            meta.colOffs[e] = colMap[colBuf[e]-minCol];
+    }
+    else
+    {
+        EL_PARALLEL_FOR
+        for( Int e=0; e<numLocalEntries; ++e )
+            meta.colOffs[e] = 
+              std::lower_bound( recvInds.begin(), recvInds.end(), colBuf[e] ) -
+              recvInds.begin();
+    }
+
+    // Since the columns of each row are sorted, the nonzeros whose 
+    // columns are owned by this process form a contiguous range
+    const Int selfBeg = meta.recvOffs[commRank];
+    const Int selfEnd = selfBeg + meta.recvSizes[commRank];
+    meta.localBegs.assign( localHeight, 0 );
+    meta.localEnds.assign( localHeight, 0 );
+    if( numLocalEntries != 0 )
+    {
+        const Int* offs = LockedOffsetBuffer();
+        EL_PARALLEL_FOR
+        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            Int e = offs[iLocal];
+            const Int eEnd = offs[iLocal+1];
+            while( e < eEnd && meta.colOffs[e] < selfBeg )
+                ++e;
+            meta.localBegs[iLocal] = e;
+            while( e < eEnd && meta.colOffs[e] < selfEnd )
+                ++e;
+            meta.localEnds[iLocal] = e;
+        }
+    }
+    meta.mapTime = timer.Stop();
+
+    meta.ready = true;
+    return meta;
+}
+
+// Auxiliary routines
+// ==================
 
 template<typename T>
 void DistSparseMatrix<T>::AssertConsistent() const
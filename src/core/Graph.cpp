@@ -9,6 +9,7 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp"
+#include "./SparseAssembly.hpp"
 
 namespace El {
 
@@ -88,6 +89,7 @@ void Graph::Empty()
     SwapClear( sources_ );
     SwapClear( targets_ );
     SwapClear( edgeOffsets_ );
+    SwapClear( markedForRemoval_ );
     consistent_ = true;
 }
 
@@ -101,6 +103,7 @@ void Graph::Resize( Int numSources, Int numTargets )
     SwapClear( sources_ );
     SwapClear( targets_ );
     SwapClear( edgeOffsets_ );
+    SwapClear( markedForRemoval_ );
     consistent_ = true;
 }
 
@@ -150,7 +153,7 @@ void Graph::QueueConnection( Int source, Int target )
 void Graph::QueueDisconnection( Int source, Int target )
 {
     DEBUG_ONLY(CallStackEntry cse("Graph::QueueDisconnection"))
-    markedForRemoval_.insert( std::pair<Int,Int>(source,target) );
+    markedForRemoval_.push_back( std::pair<Int,Int>(source,target) );
     consistent_ = false;
 }
 
@@ -163,43 +166,11 @@ void Graph::MakeConsistent()
     )
     if( !consistent_ )
     {
-        const Int numEdges = sources_.size();
-        // TODO: Consider switching to using the following by default so that
-        //       no extra allocation/memcpy is required
-        Int numRemoved=0;
-        std::vector<std::pair<Int,Int>> pairs( numEdges );
-        for( Int e=0; e<numEdges; ++e )
-        {
-            std::pair<Int,Int> candidate(sources_[e],targets_[e]);
-            if( markedForRemoval_.find(candidate) == markedForRemoval_.end() )
-            {
-                pairs[e-numRemoved].first = sources_[e];
-                pairs[e-numRemoved].second = targets_[e];
-            }
-            else
-            {
-                ++numRemoved;
-            }
-        }
-        markedForRemoval_.clear();
-        pairs.resize( numEdges-numRemoved );
-        std::sort( pairs.begin(), pairs.end(), ComparePairs );
-
-        // Compress out duplicates
-        Int lastUnique=0;
-        for( Int e=1; e<pairs.size(); ++e )
-            if( pairs[e] != pairs[lastUnique] )
-                pairs[++lastUnique] = pairs[e];
-        const Int numUnique = lastUnique+1;
-        pairs.resize( numUnique );
-
-        sources_.resize( numUnique );
-        targets_.resize( numUnique );
-        for( Int e=0; e<numUnique; ++e )
-        {
-            sources_[e] = pairs[e].first;
-            targets_[e] = pairs[e].second;
-        }
+        const Int numEdges = assembly::Consolidate
+        ( 0, numSources_, sources_.size(), sources_.data(), targets_.data(), 
+          markedForRemoval_ );
+        sources_.resize( numEdges );
+        targets_.resize( numEdges );
 
         ComputeEdgeOffsets();
 
@@ -277,35 +248,23 @@ Int* Graph::TargetBuffer() { return targets_.data(); }
 const Int* Graph::LockedSourceBuffer() const { return sources_.data(); }
 const Int* Graph::LockedTargetBuffer() const { return targets_.data(); }
 
+const Int* Graph::LockedOffsetBuffer() const
+{
+    DEBUG_ONLY(
+      CallStackEntry cse("Graph::LockedOffsetBuffer");
+      AssertConsistent();
+    )
+    return edgeOffsets_.data();
+}
+
 // Auxiliary functions
 // ===================
 
-bool Graph::ComparePairs
-( const std::pair<Int,Int>& a, const std::pair<Int,Int>& b )
-{ return a.first < b.first || (a.first  == b.first && a.second < b.second); }
-
 void Graph::ComputeEdgeOffsets()
 {
     DEBUG_ONLY(CallStackEntry cse("Graph::ComputeEdgeOffsets"))
-    // Compute the edge offsets
-    Int sourceOffset = 0;
-    Int prevSource = -1;
-    edgeOffsets_.resize( numSources_+1 );
-    const Int numEdges = NumEdges();
-    for( Int edge=0; edge<numEdges; ++edge )
-    {
-        const Int source = Source( edge );
-        DEBUG_ONLY(
-            if( source < prevSource )
-                RuntimeError("sources were not properly sorted");
-        )
-        while( source != prevSource )
-        {
-            edgeOffsets_[sourceOffset++] = edge;
-            ++prevSource;
-        }
-    }
-    edgeOffsets_[numSources_] = numEdges;
+    assembly::EdgeOffsets
+    ( 0, numSources_, sources_.size(), sources_.data(), edgeOffsets_ );
 }
 
 void Graph::AssertConsistent() const
@@ -8,9 +8,208 @@
 */
 #include "El.hpp"
 #include "El/config-internal.h"
+#ifdef EL_HAVE_POSIX_MEMALIGN
+# include <stdlib.h>
+#endif
+#if defined(EL_HUGE_PAGES) && defined(EL_HAVE_MADV_HUGEPAGE)
+# include <sys/mman.h>
+#endif
+#include <mutex>
 
 namespace El {
 
+namespace {
+
+#if defined(EL_HUGE_PAGES) && defined(EL_HAVE_MADV_HUGEPAGE)
+// Allocations of at least this many bytes are aligned to, and advised to be
+// backed by, (2 MiB) transparent huge pages
+const std::size_t hugePageSize = 2*1024*1024;
+#endif
+
+// Buffers are aligned to EL_MEMORY_ALIGNMENT bytes when posix_memalign is
+// available (and otherwise come from operator new[])
+template<typename G>
+G* AlignedNew( std::size_t size )
+{
+#ifdef EL_HAVE_POSIX_MEMALIGN
+    std::size_t numBytes = size*sizeof(G);
+    std::size_t alignment = Max( EL_MEMORY_ALIGNMENT, sizeof(void*) );
+#if defined(EL_HUGE_PAGES) && defined(EL_HAVE_MADV_HUGEPAGE)
+    const bool huge = ( numBytes >= hugePageSize );
+    if( huge )
+    {
+        alignment = hugePageSize;
+        numBytes = ((numBytes+hugePageSize-1)/hugePageSize)*hugePageSize;
+    }
+#endif
+    void* ptr;
+    if( posix_memalign( &ptr, alignment, numBytes ) != 0 )
+        throw std::bad_alloc();
+#if defined(EL_HUGE_PAGES) && defined(EL_HAVE_MADV_HUGEPAGE)
+    // The advice is only a hint, so a failure is not an error
+    if( huge )
+        madvise( ptr, numBytes, MADV_HUGEPAGE );
+#endif
+    return static_cast<G*>(ptr);
+#else
+    return new G[size];
+#endif
+}
+
+template<typename G>
+void AlignedDelete( G* buffer )
+{
+#ifdef EL_HAVE_POSIX_MEMALIGN
+    free( buffer );
+#else
+    delete[] buffer;
+#endif
+}
+
+// Buffer sizes are rounded up to one of 2^k, (5/4) 2^k, (3/2) 2^k, or 
+// (7/4) 2^k entries so that at most a fifth of each pooled buffer is wasted
+std::size_t SizeClass( std::size_t size, std::size_t& capacity )
+{
+    if( size < 4 )
+    {
+        capacity = size;
+        return size;
+    }
+    std::size_t k=2;
+    while( (size >> (k+1)) != 0 )
+        ++k;
+    const std::size_t quarter = std::size_t(1) << (k-2);
+    const std::size_t q = (size+quarter-1) / quarter;
+    capacity = q*quarter;
+    return 4*(k-1) + (q-4);
+}
+
+std::size_t ClassCapacity( std::size_t sizeClass )
+{
+    if( sizeClass < 4 )
+        return sizeClass;
+    const std::size_t k = sizeClass/4 + 1;
+    const std::size_t q = sizeClass%4 + 4;
+    return q << (k-2);
+}
+
+// A thread-safe cache of freed buffers of each size class
+template<typename G>
+class MemoryPool
+{
+public:
+    MemoryPool() : stats_() { }
+
+    G* Allocate( std::size_t size, std::size_t& capacity )
+    {
+        const std::size_t sizeClass = SizeClass( size, capacity );
+        std::lock_guard<std::mutex> lock( mutex_ );
+        ++stats_.numRequests;
+        G* buffer;
+        if( sizeClass < freeLists_.size() && !freeLists_[sizeClass].empty() )
+        {
+            buffer = freeLists_[sizeClass].back();
+            freeLists_[sizeClass].pop_back();
+            stats_.bytesCached -= capacity*sizeof(G);
+            ++stats_.numHits;
+        }
+        else
+        {
+            try { buffer = AlignedNew<G>( capacity ); }
+            catch( std::bad_alloc& e )
+            {
+                // Give the cached buffers back to the system and try again
+                TrimLocked( 0 );
+                buffer = AlignedNew<G>( capacity );
+            }
+        }
+        stats_.bytesInUse += capacity*sizeof(G);
+        stats_.highWaterMark = 
+          Max( stats_.highWaterMark, stats_.bytesInUse+stats_.bytesCached );
+        return buffer;
+    }
+
+    void Free( G* buffer, std::size_t capacity )
+    {
+        std::size_t classCapacity;
+        const std::size_t sizeClass = SizeClass( capacity, classCapacity );
+        std::lock_guard<std::mutex> lock( mutex_ );
+        if( sizeClass >= freeLists_.size() )
+            freeLists_.resize( sizeClass+1 );
+        freeLists_[sizeClass].push_back( buffer );
+        stats_.bytesInUse -= capacity*sizeof(G);
+        stats_.bytesCached += capacity*sizeof(G);
+    }
+
+    void Trim( std::size_t maxCachedBytes )
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        TrimLocked( maxCachedBytes );
+    }
+
+    MemoryPoolStats Statistics()
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        return stats_;
+    }
+
+private:
+    std::mutex mutex_;
+    std::vector<std::vector<G*>> freeLists_;
+    MemoryPoolStats stats_;
+
+    // Free the largest cached buffers first
+    void TrimLocked( std::size_t maxCachedBytes )
+    {
+        for( std::size_t c=freeLists_.size(); c>0; --c )
+        {
+            std::vector<G*>& freeList = freeLists_[c-1];
+            const std::size_t numBytes = ClassCapacity(c-1)*sizeof(G);
+            while( stats_.bytesCached > maxCachedBytes && !freeList.empty() )
+            {
+                AlignedDelete( freeList.back() );
+                freeList.pop_back();
+                stats_.bytesCached -= numBytes;
+            }
+            if( freeList.empty() )
+                SwapClear( freeList );
+        }
+    }
+};
+
+template<typename G>
+MemoryPool<G>& Pool()
+{
+    // This is intentionally never destroyed so that Memory objects with 
+    // static storage duration can still return their buffers at exit
+    static MemoryPool<G>* pool = new MemoryPool<G>;
+    return *pool;
+}
+
+template<typename G>
+G* Acquire( std::size_t size, std::size_t& capacity )
+{
+#ifdef EL_POOL_MEMORY
+    return Pool<G>().Allocate( size, capacity );
+#else
+    capacity = size;
+    return AlignedNew<G>( size );
+#endif
+}
+
+template<typename G>
+void Relinquish( G* buffer, std::size_t capacity )
+{
+#ifdef EL_POOL_MEMORY
+    if( buffer != nullptr )
+        Pool<G>().Free( buffer, capacity );
+#else
+    AlignedDelete( buffer );
+#endif
+}
+
+} // anonymous namespace
+
 template<typename G>
 Memory<G>::Memory()
 : size_(0), buffer_(nullptr)
@@ -38,7 +237,7 @@ void Memory<G>::ShallowSwap( Memory<G>& mem )
 }
 
 template<typename G>
-Memory<G>::~Memory() { delete[] buffer_; }
+Memory<G>::~Memory() { Relinquish( buffer_, size_ ); }
 
 template<typename G>
 G* Memory<G>::Buffer() const { return buffer_; }
@@ -51,11 +250,15 @@ G* Memory<G>::Require( std::size_t size )
 {
     if( size > size_ )
     {
-        delete[] buffer_;
+        Relinquish( buffer_, size_ );
+        // Avoid a dangling pointer if the allocation fails
+        buffer_ = nullptr;
+        size_ = 0;
+        std::size_t capacity;
 #ifndef EL_RELEASE
         try {
 #endif
-            buffer_ = new G[size];
+            buffer_ = Acquire<G>( size, capacity );
 #ifndef EL_RELEASE
         } 
         catch( std::bad_alloc& e )
@@ -67,7 +270,7 @@ G* Memory<G>::Require( std::size_t size )
             throw e;
         }
 #endif
-        size_ = size;
+        size_ = capacity;
 #ifdef EL_ZERO_INIT
         MemZero( buffer_, size_ );
 #elif defined(EL_HAVE_VALGRIND)
@@ -80,24 +283,42 @@ G* Memory<G>::Require( std::size_t size )
 
 template<typename G>
 void Memory<G>::Release()
-{
-#ifndef EL_POOL_MEMORY
-    this->Empty();
-#endif
-}
+{ this->Empty(); }
 
 template<typename G>
 void Memory<G>::Empty()
 {
-    delete[] buffer_;
+    Relinquish( buffer_, size_ );
     size_ = 0;
     buffer_ = nullptr;
 }
 
-template class Memory<Int>;
-template class Memory<float>;
-template class Memory<double>;
-template class Memory<Complex<float>>;
-template class Memory<Complex<double>>;
+template<typename G>
+MemoryPoolStats MemoryPoolStatistics()
+{ return Pool<G>().Statistics(); }
+
+template<typename G>
+void TrimMemoryPool( std::size_t maxCachedBytes )
+{ Pool<G>().Trim( maxCachedBytes ); }
+
+void TrimMemoryPools( std::size_t maxCachedBytes )
+{
+    TrimMemoryPool<Int>( maxCachedBytes );
+    TrimMemoryPool<float>( maxCachedBytes );
+    TrimMemoryPool<double>( maxCachedBytes );
+    TrimMemoryPool<Complex<float>>( maxCachedBytes );
+    TrimMemoryPool<Complex<double>>( maxCachedBytes );
+}
+
+#define PROTO(G) \
+  template class Memory<G>; \
+  template MemoryPoolStats MemoryPoolStatistics<G>(); \
+  template void TrimMemoryPool<G>( std::size_t maxCachedBytes );
+
+PROTO(Int)
+PROTO(float)
+PROTO(double)
+PROTO(Complex<float>)
+PROTO(Complex<double>)
 
 } // namespace El
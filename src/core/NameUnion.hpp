@@ -0,0 +1,57 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_CORE_NAMEUNION_HPP
+#define EL_CORE_NAMEUNION_HPP
+
+namespace El {
+
+// The sorted union over 'comm' of the names held by each process, which is
+// used to line up the entries of the profiling reports (the names may not
+// contain newlines)
+inline std::vector<std::string>
+NameUnion( const std::vector<std::string>& localNames, mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("NameUnion"))
+    const int commSize = mpi::Size( comm );
+    std::string packed;
+    for( const auto& name : localNames )
+        packed += name + '\n';
+    const int localSize = packed.size();
+    std::vector<int> sizes( commSize ), offs( commSize );
+    mpi::AllGather( &localSize, 1, sizes.data(), 1, comm );
+    int totalSize=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        offs[q] = totalSize;
+        totalSize += sizes[q];
+    }
+    std::vector<byte> allPacked( Max(totalSize,1) );
+    mpi::AllGather
+    ( (const byte*)packed.data(), localSize,
+      allPacked.data(), sizes.data(), offs.data(), comm );
+
+    std::set<std::string> nameSet;
+    std::string name;
+    for( int k=0; k<totalSize; ++k )
+    {
+        if( allPacked[k] == '\n' )
+        {
+            nameSet.insert( name );
+            name.clear();
+        }
+        else
+            name += allPacked[k];
+    }
+    return std::vector<std::string>( nameSet.begin(), nameSet.end() );
+}
+
+} // namespace El
+
+#endif // ifndef EL_CORE_NAMEUNION_HPP
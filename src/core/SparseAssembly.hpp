@@ -0,0 +1,222 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_CORE_SPARSEASSEMBLY_HPP
+#define EL_CORE_SPARSEASSEMBLY_HPP
+
+// The assembly engine shared by the MakeConsistent routines of Graph,
+// DistGraph, SparseMatrix, and DistSparseMatrix. The edges (or entries) are
+// stored as parallel arrays of sources, targets, and (optionally) values,
+// where a prefix is left sorted by (source,target), with no duplicates, by
+// the previous call and the newly queued edges have been appended. Only the
+// queued portion is sorted, and it is then merged into the sorted prefix in
+// place.
+
+namespace El {
+namespace assembly {
+
+// Graphs carry no values
+struct NoValue { };
+
+template<typename T>
+struct ValueArray
+{
+    T* buf;
+    ValueArray( T* vals ) : buf(vals) { }
+    T Get( Int e ) const { return buf[e]; }
+    void Set( Int e, const T& value ) { buf[e] = value; }
+    void Update( Int e, const T& value ) { buf[e] += value; }
+};
+
+template<>
+struct ValueArray<NoValue>
+{
+    ValueArray( NoValue* vals ) { }
+    NoValue Get( Int e ) const { return NoValue(); }
+    void Set( Int e, const NoValue& value ) { }
+    void Update( Int e, const NoValue& value ) { }
+};
+
+template<typename T>
+struct Queued
+{
+    Int source, target;
+    T value;
+    Queued() { }
+    Queued( Int s, Int t, const T& v ) : source(s), target(t), value(v) { }
+    bool operator<( const Queued<T>& b ) const
+    { return source < b.source || (source == b.source && target < b.target); }
+};
+
+template<>
+struct Queued<NoValue>
+{
+    Int source, target;
+    Queued() { }
+    Queued( Int s, Int t, const NoValue& v ) : source(s), target(t) { }
+    bool operator<( const Queued<NoValue>& b ) const
+    { return source < b.source || (source == b.source && target < b.target); }
+};
+
+template<typename T>
+inline T QueuedValue( const Queued<T>& q ) { return q.value; }
+inline NoValue QueuedValue( const Queued<NoValue>& q ) { return NoValue(); }
+
+inline bool Less( Int sourceA, Int targetA, Int sourceB, Int targetB )
+{ return sourceA < sourceB || (sourceA == sourceB && targetA < targetB); }
+
+// The length of the longest strictly increasing prefix of the edges, which
+// contains at least the portion left sorted by the last consolidation
+inline Int SortedPrefix( Int numEdges, const Int* sources, const Int* targets )
+{
+    Int e=1;
+    for( ; e<numEdges; ++e )
+        if( !Less(sources[e-1],targets[e-1],sources[e],targets[e]) )
+            break;
+    return Min(e,numEdges);
+}
+
+// Sort the edges by (source,target), combine duplicates (by summing the
+// values), and drop any edges marked for removal. Only the edges past the
+// sorted prefix are copied; they are ordered with a counting sort over the
+// sources, followed by independent sorts of the targets of each source,
+// unless they are few enough that a single comparison sort is cheaper.
+// Returns the number of remaining edges, which are left at the beginning
+// of the arrays.
+template<typename T>
+inline Int Consolidate
+( Int firstSource, Int numSources,
+  Int numEdges, Int* sources, Int* targets, T* vals,
+  std::vector<std::pair<Int,Int>>& removals )
+{
+    DEBUG_ONLY(CallStackEntry cse("assembly::Consolidate"))
+    ValueArray<T> values( vals );
+    const Int numSorted = SortedPrefix( numEdges, sources, targets );
+    const Int numQueued = numEdges - numSorted;
+
+    std::vector<Queued<T>> queue( numQueued );
+    if( numQueued < numSources )
+    {
+        for( Int e=numSorted; e<numEdges; ++e )
+            queue[e-numSorted] =
+              Queued<T>( sources[e], targets[e], values.Get(e) );
+        std::sort( queue.begin(), queue.end() );
+    }
+    else
+    {
+        std::vector<Int> queueOffs( numSources+1, 0 );
+        for( Int e=numSorted; e<numEdges; ++e )
+            ++queueOffs[sources[e]-firstSource+1];
+        for( Int s=0; s<numSources; ++s )
+            queueOffs[s+1] += queueOffs[s];
+        for( Int e=numSorted; e<numEdges; ++e )
+            queue[queueOffs[sources[e]-firstSource]++] =
+              Queued<T>( sources[e], targets[e], values.Get(e) );
+        for( Int s=numSources; s>0; --s )
+            queueOffs[s] = queueOffs[s-1];
+        queueOffs[0] = 0;
+
+        Queued<T>* queueBuf = queue.data();
+        EL_PARALLEL_FOR
+        for( Int s=0; s<numSources; ++s )
+            std::sort( queueBuf+queueOffs[s], queueBuf+queueOffs[s+1] );
+    }
+
+    // Merge from the back so that the queued edges can be written into the
+    // slots that they vacated, combining equal edges as they are met
+    Int w=numEdges, i=numSorted-1, j=numQueued-1;
+    while( i >= 0 || j >= 0 )
+    {
+        Int source, target;
+        T value;
+        if( j >= 0 &&
+            (i < 0 ||
+             Less(sources[i],targets[i],queue[j].source,queue[j].target)) )
+        {
+            source = queue[j].source;
+            target = queue[j].target;
+            value = QueuedValue( queue[j] );
+            --j;
+        }
+        else
+        {
+            source = sources[i];
+            target = targets[i];
+            value = values.Get(i);
+            --i;
+        }
+        if( w < numEdges && sources[w] == source && targets[w] == target )
+            values.Update( w, value );
+        else
+        {
+            --w;
+            sources[w] = source;
+            targets[w] = target;
+            values.Set( w, value );
+        }
+    }
+    SwapClear( queue );
+
+    // Shift the result to the front while dropping the removed edges, which
+    // only requires a simultaneous walk over the sorted list of removals
+    std::sort( removals.begin(), removals.end() );
+    auto r = removals.cbegin();
+    Int numKept=0;
+    for( Int e=w; e<numEdges; ++e )
+    {
+        while( r != removals.cend() &&
+               Less(r->first,r->second,sources[e],targets[e]) )
+            ++r;
+        if( r != removals.cend() &&
+            r->first == sources[e] && r->second == targets[e] )
+            continue;
+        if( numKept != e )
+        {
+            sources[numKept] = sources[e];
+            targets[numKept] = targets[e];
+            values.Set( numKept, values.Get(e) );
+        }
+        ++numKept;
+    }
+    SwapClear( removals );
+    return numKept;
+}
+
+inline Int Consolidate
+( Int firstSource, Int numSources, Int numEdges, Int* sources, Int* targets,
+  std::vector<std::pair<Int,Int>>& removals )
+{
+    return Consolidate<NoValue>
+    ( firstSource, numSources, numEdges, sources, targets, nullptr, removals );
+}
+
+// Compute the offset of the first edge of each source from the sorted list
+// of sources (including for any sources without edges)
+inline void EdgeOffsets
+( Int firstSource, Int numSources, Int numEdges, const Int* sources,
+  std::vector<Int>& offsets )
+{
+    DEBUG_ONLY(CallStackEntry cse("assembly::EdgeOffsets"))
+    offsets.resize( numSources+1 );
+    Int e=0;
+    for( Int s=0; s<numSources; ++s )
+    {
+        offsets[s] = e;
+        while( e < numEdges && sources[e] == firstSource+s )
+            ++e;
+    }
+    if( e != numEdges )
+        RuntimeError("sources were not properly sorted");
+    offsets[numSources] = numEdges;
+}
+
+} // namespace assembly
+} // namespace El
+
+#endif // ifndef EL_CORE_SPARSEASSEMBLY_HPP
@@ -9,6 +9,8 @@
    http://opensource.org/licenses/BSD-2-Clause
 */
 #include "El.hpp" 
+#include "./SparseAssembly.hpp"
+
 namespace El {
 
 // Constructors and destructors
@@ -58,6 +60,8 @@ const SparseMatrix<T>& SparseMatrix<T>::operator=( const SparseMatrix<T>& A )
     DEBUG_ONLY(CallStackEntry cse("SparseMatrix::operator="))
     graph_ = A.graph_;
     vals_ = A.vals_;
+    patternLocked_ = false;
+    transposeMeta.Clear();
     return *this;
 }
 
@@ -73,6 +77,8 @@ SparseMatrix<T>::operator=( const DistSparseMatrix<T>& A )
 
     graph_ = A.distGraph_;
     vals_ = A.vals_;
+    patternLocked_ = false;
+    transposeMeta.Clear();
     return *this;
 }
 
@@ -83,6 +89,8 @@ void SparseMatrix<T>::Empty()
 {
     graph_.Empty();
     SwapClear( vals_ );
+    patternLocked_ = false;
+    transposeMeta.Clear();
 }
 
 template<typename T>
@@ -90,6 +98,8 @@ void SparseMatrix<T>::Resize( Int height, Int width )
 {
     graph_.Resize( height, width );
     SwapClear( vals_ );
+    patternLocked_ = false;
+    transposeMeta.Clear();
 }
 
 // Assembly
@@ -121,15 +131,46 @@ template<typename T>
 void SparseMatrix<T>::QueueUpdate( Int row, Int col, T value )
 {
     DEBUG_ONLY(CallStackEntry cse("SparseMatrix::QueueUpdate"))
+    if( patternLocked_ )
+    {
+        vals_[Index(row,col)] += value;
+        return;
+    }
     graph_.QueueConnection( row, col );
     vals_.push_back( value );
+    transposeMeta.ready = false;
 }
 
 template<typename T>
 void SparseMatrix<T>::QueueZero( Int row, Int col )
 {
-    DEBUG_ONLY(CallStackEntry cse("SparseMatrix::QueueUpdate"))
+    DEBUG_ONLY(CallStackEntry cse("SparseMatrix::QueueZero"))
+    if( patternLocked_ )
+        LogicError("Cannot remove entries while the pattern is locked");
     graph_.QueueDisconnection( row, col );
+    transposeMeta.ready = false;
+}
+
+template<typename T>
+void SparseMatrix<T>::LockPattern()
+{
+    DEBUG_ONLY(CallStackEntry cse("SparseMatrix::LockPattern"))
+    MakeConsistent();
+    patternLocked_ = true;
+}
+
+template<typename T>
+void SparseMatrix<T>::UnlockPattern()
+{
+    DEBUG_ONLY(CallStackEntry cse("SparseMatrix::UnlockPattern"))
+    patternLocked_ = false;
+}
+
+template<typename T>
+void SparseMatrix<T>::ZeroValues()
+{
+    DEBUG_ONLY(CallStackEntry cse("SparseMatrix::ZeroValues"))
+    MemZero( vals_.data(), vals_.size() );
 }
 
 // Queries
@@ -159,6 +200,9 @@ Int SparseMatrix<T>::Capacity() const
 template<typename T>
 bool SparseMatrix<T>::Consistent() const { return graph_.Consistent(); }
 
+template<typename T>
+bool SparseMatrix<T>::PatternLocked() const { return patternLocked_; }
+
 template<typename T>
 El::Graph& SparseMatrix<T>::Graph() { return graph_; }
 template<typename T>
@@ -194,6 +238,26 @@ Int SparseMatrix<T>::NumConnections( Int row ) const
     return graph_.NumConnections( row );
 }
 
+template<typename T>
+Int SparseMatrix<T>::Index( Int row, Int col ) const
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("SparseMatrix::Index");
+        AssertConsistent();
+        if( row < 0 || row >= Height() )
+            LogicError("Row ",row," is not in [0,",Height(),")");
+    )
+    if( NumEntries() == 0 )
+        LogicError("Entry (",row,",",col,") is not in the sparsity pattern");
+    // The columns of each row are sorted
+    auto rowBeg = graph_.targets_.cbegin() + graph_.edgeOffsets_[row];
+    auto rowEnd = graph_.targets_.cbegin() + graph_.edgeOffsets_[row+1];
+    auto it = std::lower_bound( rowBeg, rowEnd, col );
+    if( it == rowEnd || *it != col )
+        LogicError("Entry (",row,",",col,") is not in the sparsity pattern");
+    return it - graph_.targets_.cbegin();
+}
+
 template<typename T>
 T SparseMatrix<T>::Value( Int index ) const
 { 
@@ -221,15 +285,13 @@ const Int* SparseMatrix<T>::LockedTargetBuffer() const
 template<typename T>
 const T* SparseMatrix<T>::LockedValueBuffer() const
 { return vals_.data(); }
+template<typename T>
+const Int* SparseMatrix<T>::LockedOffsetBuffer() const
+{ return graph_.LockedOffsetBuffer(); }
 
 // Auxiliary routines
 // ==================
 
-template<typename T>
-bool SparseMatrix<T>::CompareEntries( const Entry<T>& a, const Entry<T>& b )
-{ return a.indices[0] < b.indices[0] || 
-         (a.indices[0] == b.indices[0] && a.indices[1] < b.indices[1]); }
-
 template<typename T>
 void SparseMatrix<T>::MakeConsistent()
 {
@@ -241,55 +303,13 @@ void SparseMatrix<T>::MakeConsistent()
     )
     if( !graph_.consistent_ )
     {
-        const Int numEntries = vals_.size();
-        Int numRemoved = 0;
-        std::vector<Entry<T>> entries( numEntries );
-        for( Int s=0; s<numEntries; ++s )
-        {
-            std::pair<Int,Int> candidate(graph_.sources_[s],graph_.targets_[s]);
-            if( graph_.markedForRemoval_.find(candidate) == 
-                graph_.markedForRemoval_.end() )
-            {
-                entries[s-numRemoved].indices[0] = graph_.sources_[s];
-                entries[s-numRemoved].indices[1] = graph_.targets_[s];
-                entries[s-numRemoved].value = vals_[s];
-            }
-            else
-            {
-                ++numRemoved;
-            }
-        }
-        graph_.markedForRemoval_.clear();
-        entries.resize( numEntries-numRemoved );
-        std::sort( entries.begin(), entries.end(), CompareEntries );
-
-        // Compress out duplicates
-        Int lastUnique=0;
-        for( Int s=1; s<numEntries; ++s )
-        {
-            if( entries[s].indices[0] != entries[lastUnique].indices[0] ||
-                entries[s].indices[1] != entries[lastUnique].indices[1] )
-            {
-                ++lastUnique;
-                entries[lastUnique].indices[0] = entries[s].indices[0];
-                entries[lastUnique].indices[1] = entries[s].indices[1];
-                entries[lastUnique].value = entries[s].value;
-            }
-            else
-                entries[lastUnique].value += entries[s].value;
-        }
-        const Int numUnique = lastUnique+1;
-        entries.resize( numUnique );
-
-        graph_.sources_.resize( numUnique );
-        graph_.targets_.resize( numUnique );
-        vals_.resize( numUnique );
-        for( Int s=0; s<numUnique; ++s )
-        {
-            graph_.sources_[s] = entries[s].indices[0];
-            graph_.targets_[s] = entries[s].indices[1];
-            vals_[s] = entries[s].value;
-        }
+        const Int numEntries = assembly::Consolidate
+        ( 0, graph_.numSources_, vals_.size(), 
+          graph_.sources_.data(), graph_.targets_.data(), vals_.data(),
+          graph_.markedForRemoval_ );
+        graph_.sources_.resize( numEntries );
+        graph_.targets_.resize( numEntries );
+        vals_.resize( numEntries );
 
         graph_.ComputeEdgeOffsets();
 
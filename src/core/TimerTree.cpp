@@ -0,0 +1,329 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include <iomanip>
+#include <mutex>
+
+#include "./NameUnion.hpp"
+
+namespace El {
+
+struct TimerNode
+{
+    std::string name;
+    TimerNode* parent;
+    std::vector<std::unique_ptr<TimerNode>> children;
+    Int numCalls=0;
+    double time=0;
+
+    TimerNode( const std::string& nodeName, TimerNode* nodeParent )
+    : name(nodeName), parent(nodeParent)
+    { }
+
+    TimerNode* Child( const char* childName )
+    {
+        for( auto& child : children )
+            if( child->name == childName )
+                return child.get();
+        children.emplace_back( new TimerNode(childName,this) );
+        return children.back().get();
+    }
+};
+
+} // namespace El
+
+namespace {
+using namespace El;
+
+bool timing = false;
+bool tracing = false;
+Clock::time_point epoch = Clock::now();
+
+struct TraceEvent
+{
+    const TimerNode* node;
+    double start, duration;
+};
+
+struct ThreadTimers
+{
+    Int thread;
+    TimerNode root;
+    TimerNode* current;
+    std::vector<TraceEvent> events;
+
+    ThreadTimers( Int threadIndex )
+    : thread(threadIndex), root("",nullptr), current(&root)
+    { }
+};
+
+// The timers of each thread are owned by the registry so that they outlive
+// the threads; ResetTimers starts a new generation of them
+std::mutex registryMutex;
+std::vector<std::unique_ptr<ThreadTimers>> registry;
+Int generation = 0;
+
+thread_local ThreadTimers* threadTimers = nullptr;
+thread_local Int threadGeneration = -1;
+
+ThreadTimers& ThisThread()
+{
+    if( threadTimers == nullptr || threadGeneration != generation )
+    {
+        std::lock_guard<std::mutex> lock( registryMutex );
+        registry.emplace_back( new ThreadTimers(registry.size()) );
+        threadTimers = registry.back().get();
+        threadGeneration = generation;
+    }
+    return *threadTimers;
+}
+
+inline double Seconds( Clock::time_point start, Clock::time_point stop )
+{ return duration_cast<duration<double>>(stop-start).count(); }
+
+struct RegionStats
+{
+    double numCalls=0, inclusive=0, exclusive=0;
+};
+
+// Accumulate the regions below 'node' into 'stats', where the path of a
+// region is the tab-separated list of the names of its ancestors
+void Merge
+( const TimerNode& node, const std::string& path,
+  std::map<std::string,RegionStats>& stats )
+{
+    for( const auto& child : node.children )
+    {
+        const std::string childPath =
+          ( path.empty() ? child->name : path+'\t'+child->name );
+        double childrenTime = 0;
+        for( const auto& grandchild : child->children )
+            childrenTime += grandchild->time;
+        RegionStats& region = stats[childPath];
+        region.numCalls += child->numCalls;
+        region.inclusive += child->time;
+        region.exclusive += child->time - childrenTime;
+        Merge( *child, childPath, stats );
+    }
+}
+
+std::string EscapeJSON( const std::string& s )
+{
+    std::string escaped;
+    for( const char c : s )
+    {
+        if( c == '"' || c == '\\' )
+            escaped += '\\';
+        escaped += c;
+    }
+    return escaped;
+}
+
+} // anonymous namespace
+
+namespace El {
+
+void EnableTimers( bool enable, bool trace )
+{
+    ::timing = enable;
+    ::tracing = enable && trace;
+}
+
+bool TimersEnabled() { return ::timing; }
+
+void ResetTimers()
+{
+    std::lock_guard<std::mutex> lock( ::registryMutex );
+    ::registry.clear();
+    ++::generation;
+    ::epoch = Clock::now();
+}
+
+void PrintTimers( mpi::Comm comm, std::ostream& os )
+{
+    DEBUG_ONLY(CallStackEntry cse("PrintTimers"))
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    std::map<std::string,RegionStats> localStats;
+    {
+        std::lock_guard<std::mutex> lock( ::registryMutex );
+        for( const auto& timers : ::registry )
+            Merge( timers->root, "", localStats );
+    }
+    std::vector<std::string> localPaths;
+    for( const auto& pair : localStats )
+        localPaths.push_back( pair.first );
+    // Since a path sorts directly before the paths of its descendants, the
+    // sorted union is a depth-first traversal of the merged tree
+    const std::vector<std::string> paths = NameUnion( localPaths, comm );
+    const Int numPaths = paths.size();
+
+    std::vector<double> localData( 3*numPaths, 0 );
+    for( Int k=0; k<numPaths; ++k )
+    {
+        auto it = localStats.find( paths[k] );
+        if( it != localStats.end() )
+        {
+            localData[3*k+0] = it->second.numCalls;
+            localData[3*k+1] = it->second.inclusive;
+            localData[3*k+2] = it->second.exclusive;
+        }
+    }
+    std::vector<double> data;
+    if( commRank == 0 )
+        data.resize( 3*numPaths*commSize );
+    mpi::Gather
+    ( localData.data(), 3*numPaths, data.data(), 3*numPaths, 0, comm );
+    if( commRank != 0 )
+        return;
+
+    os << "Timers over " << commSize << " processes (seconds, with the "
+       << "min/avg/max over the processes which entered each region)\n"
+       << std::left << std::setw(36) << "region" << std::right
+       << std::setw(10) << "calls"
+       << std::setw(33) << "inclusive (min/avg/max)"
+       << std::setw(33) << "exclusive (min/avg/max)" << "\n";
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    os << std::scientific << std::setprecision(3);
+    for( Int k=0; k<numPaths; ++k )
+    {
+        const std::string& path = paths[k];
+        const Int depth = std::count( path.begin(), path.end(), '\t' );
+        const std::string name =
+          std::string(2*depth,' ') + path.substr(path.find_last_of('\t')+1);
+
+        double numCalls=0;
+        Int numEntered=0;
+        double inclMin=0, inclMax=0, inclSum=0, exclMin=0, exclMax=0, exclSum=0;
+        for( int q=0; q<commSize; ++q )
+        {
+            const double* entry = &data[3*(q*numPaths+k)];
+            if( entry[0] == 0 )
+                continue;
+            numCalls += entry[0];
+            inclMin = ( numEntered==0 ? entry[1] : Min(inclMin,entry[1]) );
+            exclMin = ( numEntered==0 ? entry[2] : Min(exclMin,entry[2]) );
+            inclMax = Max( inclMax, entry[1] );
+            exclMax = Max( exclMax, entry[2] );
+            inclSum += entry[1];
+            exclSum += entry[2];
+            ++numEntered;
+        }
+        os << std::left << std::setw(36) << name << std::right
+           << std::setw(10) << Int(numCalls)
+           << std::setw(11) << inclMin
+           << std::setw(11) << inclSum/Max(numEntered,1)
+           << std::setw(11) << inclMax
+           << std::setw(11) << exclMin
+           << std::setw(11) << exclSum/Max(numEntered,1)
+           << std::setw(11) << exclMax << "\n";
+    }
+    os.flags( flags );
+    os.precision( precision );
+    os.flush();
+}
+
+void WriteChromeTrace( const std::string& filename, mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("WriteChromeTrace"))
+    const int commRank = mpi::Rank( comm );
+    const int commSize = mpi::Size( comm );
+
+    // Line up the clocks of the processes at the exit of a barrier
+    mpi::Barrier( comm );
+    const double localNow = Seconds( ::epoch, Clock::now() );
+    const double maxNow = mpi::AllReduce( localNow, mpi::MAX, comm );
+    const double shift = maxNow - localNow;
+
+    std::ostringstream events;
+    events << std::fixed << std::setprecision(3);
+    {
+        std::lock_guard<std::mutex> lock( ::registryMutex );
+        for( const auto& timers : ::registry )
+            for( const auto& event : timers->events )
+                events << "{\"name\":\"" << EscapeJSON(event.node->name)
+                       << "\",\"ph\":\"X\",\"pid\":" << commRank
+                       << ",\"tid\":" << timers->thread
+                       << ",\"ts\":" << 1.e6*(event.start+shift)
+                       << ",\"dur\":" << 1.e6*event.duration << "},\n";
+    }
+    const std::string localEvents = events.str();
+    const int localSize = localEvents.size();
+
+    std::vector<int> sizes( commSize ), offs( commSize );
+    mpi::Gather( &localSize, 1, sizes.data(), 1, 0, comm );
+    int totalSize=0;
+    for( int q=0; q<commSize; ++q )
+    {
+        offs[q] = totalSize;
+        totalSize += sizes[q];
+    }
+    std::vector<byte> allEvents( Max(totalSize,1) );
+    mpi::Gather
+    ( (const byte*)localEvents.data(), localSize,
+      allEvents.data(), sizes.data(), offs.data(), 0, comm );
+
+    if( commRank == 0 )
+    {
+        std::ofstream file( filename.c_str() );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename);
+        std::string body( allEvents.begin(), allEvents.begin()+totalSize );
+        // Drop the separator after the last event
+        if( totalSize >= 2 )
+            body.erase( totalSize-2, 1 );
+        file << "{\"traceEvents\":[\n" << body << "]}\n";
+    }
+}
+
+ScopedTimer::ScopedTimer( const char* name )
+: node_(nullptr)
+{
+    if( ::timing )
+        Open( name );
+}
+
+ScopedTimer::ScopedTimer( const std::string& name )
+: node_(nullptr)
+{
+    if( ::timing )
+        Open( name.c_str() );
+}
+
+void ScopedTimer::Open( const char* name )
+{
+    ThreadTimers& timers = ThisThread();
+    node_ = timers.current->Child( name );
+    timers.current = node_;
+    start_ = Clock::now();
+}
+
+ScopedTimer::~ScopedTimer()
+{
+    if( node_ == nullptr )
+        return;
+    const double time = Seconds( start_, Clock::now() );
+    ++node_->numCalls;
+    node_->time += time;
+
+    ThreadTimers& timers = ThisThread();
+    timers.current = node_->parent;
+    if( ::tracing )
+    {
+        TraceEvent event;
+        event.node = node_;
+        event.start = Seconds( ::epoch, start_ );
+        event.duration = time;
+        timers.events.push_back( event );
+    }
+}
+
+} // namespace El
@@ -28,6 +28,10 @@ Int blockHeight=32, blockWidth=32;
 // A common Mersenne twister configuration
 std::mt19937 generator;
 
+// The seed and next stream of the counter-based generator
+std::uint64_t randomSeed = 21;
+std::uint64_t randomStream = 0;
+
 // Debugging
 DEBUG_ONLY(std::stack<std::string> callStack)
 
@@ -353,6 +357,8 @@ void Initialize( int& argc, char**& argv )
     const long seed = (secs<<16) | (rank & 0xFFFF);
     ::generator.seed( seed );
     srand( seed );
+    ::randomSeed = secs;
+    ::randomStream = 0;
 }
 
 void Finalize()
@@ -372,6 +378,21 @@ void Finalize()
         delete ::args;
         ::args = 0;
 
+        if( TimersEnabled() && !mpi::Finalized() )
+        {
+            PrintTimers();
+            EnableTimers( false );
+            ResetTimers();
+        }
+        if( CommProfilingEnabled() && !mpi::Finalized() )
+        {
+            PrintCommProfile();
+            EnableCommProfiling( false );
+            ResetCommProfile();
+        }
+
+        TrimMemoryPools();
+
         if( ::elemInitializedMpi )
         {
             // Destroy the types and ops needed for ValueInt
@@ -472,6 +493,32 @@ void SetDefaultBlockWidth( Int nb )
 std::mt19937& Generator()
 { return ::generator; }
 
+void SetRandomSeed( std::uint64_t seed )
+{
+    ::randomSeed = seed;
+    ::randomStream = 0;
+}
+
+std::uint64_t RandomSeed()
+{ return ::randomSeed; }
+
+std::uint64_t NextRandomStream( mpi::Comm comm )
+{
+    const std::uint64_t stream =
+        mpi::AllReduce( ::randomStream, mpi::MAX, comm );
+    ::randomStream = stream+1;
+    return stream;
+}
+
+Int NumThreads()
+{
+#ifdef EL_HAVE_OPENMP
+    return omp_get_max_threads();
+#else
+    return 1;
+#endif
+}
+
 // If we are not in RELEASE mode, then implement wrappers for a CallStack
 DEBUG_ONLY(
 
@@ -28,6 +28,33 @@ SafeMpi( int mpiError )
     )
 }
 
+// The number of bytes recorded by the communication profile for a call
+template<typename T>
+inline double Bytes( int count )
+{ return double(count)*sizeof(T); }
+
+// ...for 'count' entries for each process in 'comm'
+template<typename T>
+inline double Bytes( int count, El::mpi::Comm comm )
+{
+    return El::CommProfilingEnabled() ?
+           Bytes<T>(count)*El::mpi::Size(comm) : 0.;
+}
+
+// ...for 'counts[q]' entries for each process q in 'comm'
+template<typename T>
+inline double Bytes( const int* counts, El::mpi::Comm comm )
+{
+    double numBytes = 0;
+    if( El::CommProfilingEnabled() )
+    {
+        const int commSize = El::mpi::Size( comm );
+        for( int q=0; q<commSize; ++q )
+            numBytes += Bytes<T>( counts[q] );
+    }
+    return numBytes;
+}
+
 } // anonymous namespace
 
 namespace El {
@@ -58,7 +85,7 @@ void Initialize( int& argc, char**& argv )
 { MPI_Init( &argc, &argv ); }
 
 int InitializeThread( int& argc, char**& argv, int required )
-{ 
+{
     int provided; 
 #ifdef EL_HAVE_MPI_INIT_THREAD
     MPI_Init_thread( &argc, &argv, required, &provided ); 
@@ -73,7 +100,7 @@ void Finalize()
 { MPI_Finalize(); }
 
 bool Initialized()
-{ 
+{
     int initialized;
     MPI_Initialized( &initialized );
     return initialized;
@@ -373,6 +400,7 @@ void Translate
 void Barrier( Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Barrier"))
+    CommProfileCall profile( "Barrier", 0 );
     SafeMpi( MPI_Barrier( comm.comm ) );
 }
 
@@ -390,6 +418,7 @@ bool Test( Request& request )
 void Wait( Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Wait"))
+    CommProfileCall profile( "Wait", 0 );
     Status status;
     SafeMpi( MPI_Wait( &request, &status ) );
 }
@@ -398,6 +427,7 @@ void Wait( Request& request )
 void Wait( Request& request, Status& status )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Wait"))
+    CommProfileCall profile( "Wait", 0 );
     SafeMpi( MPI_Wait( &request, &status ) );
 }
 
@@ -405,6 +435,7 @@ void Wait( Request& request, Status& status )
 void WaitAll( int numRequests, Request* requests )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::WaitAll"))
+    CommProfileCall profile( "WaitAll", 0 );
     std::vector<Status> statuses( numRequests );
     SafeMpi( MPI_Waitall( numRequests, requests, statuses.data() ) );
 }
@@ -413,6 +444,7 @@ void WaitAll( int numRequests, Request* requests )
 void WaitAll( int numRequests, Request* requests, Status* statuses )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::WaitAll"))
+    CommProfileCall profile( "WaitAll", 0 );
     SafeMpi( MPI_Waitall( numRequests, requests, statuses ) );
 }
 
@@ -451,8 +483,9 @@ template int GetCount<Complex<double>>( Status& status );
 
 template<typename R>
 void TaggedSend( const R* buf, int count, int to, int tag, Comm comm )
-{ 
+{
     DEBUG_ONLY(CallStackEntry cse("mpi::Send"))
+    CommProfileCall profile( "Send", Bytes<R>( count ) );
     SafeMpi( 
         MPI_Send( const_cast<R*>(buf), count, TypeMap<R>(), to, tag, comm.comm )
     );
@@ -462,6 +495,7 @@ template<typename R>
 void TaggedSend( const Complex<R>* buf, int count, int to, int tag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Send"))
+    CommProfileCall profile( "Send", Bytes<Complex<R>>( count ) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Send
@@ -546,8 +580,9 @@ template void Send( Complex<double> b, int to, Comm comm );
 template<typename R>
 void TaggedISend
 ( const R* buf, int count, int to, int tag, Comm comm, Request& request )
-{ 
+{
     DEBUG_ONLY(CallStackEntry cse("mpi::ISend"))
+    CommProfileCall profile( "ISend", Bytes<R>( count ) );
     SafeMpi
     ( MPI_Isend
       ( const_cast<R*>(buf), count, TypeMap<R>(), to, 
@@ -560,6 +595,7 @@ void TaggedISend
   Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ISend"))
+    CommProfileCall profile( "ISend", Bytes<Complex<R>>( count ) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Isend
@@ -647,6 +683,7 @@ void TaggedISSend
 ( const R* buf, int count, int to, int tag, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ISSend"))
+    CommProfileCall profile( "ISSend", Bytes<R>( count ) );
     SafeMpi
     ( MPI_Issend
       ( const_cast<R*>(buf), count, TypeMap<R>(), to, 
@@ -659,6 +696,7 @@ void TaggedISSend
   Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ISSend"))
+    CommProfileCall profile( "ISSend", Bytes<Complex<R>>( count ) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Issend
@@ -726,6 +764,7 @@ template<typename R>
 void TaggedRecv( R* buf, int count, int from, int tag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Recv"))
+    CommProfileCall profile( "Recv", Bytes<R>( count ) );
     Status status;
     SafeMpi
     ( MPI_Recv( buf, count, TypeMap<R>(), from, tag, comm.comm, &status ) );
@@ -735,6 +774,7 @@ template<typename R>
 void TaggedRecv( Complex<R>* buf, int count, int from, int tag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Recv"))
+    CommProfileCall profile( "Recv", Bytes<Complex<R>>( count ) );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -819,6 +859,7 @@ void TaggedIRecv
 ( R* buf, int count, int from, int tag, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IRecv"))
+    CommProfileCall profile( "IRecv", Bytes<R>( count ) );
     SafeMpi
     ( MPI_Irecv( buf, count, TypeMap<R>(), from, tag, comm.comm, &request ) );
 }
@@ -828,6 +869,7 @@ void TaggedIRecv
 ( Complex<R>* buf, int count, int from, int tag, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IRecv"))
+    CommProfileCall profile( "IRecv", Bytes<Complex<R>>( count ) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Irecv( buf, 2*count, TypeMap<R>(), from, tag, comm.comm, &request ) );
@@ -912,6 +954,7 @@ void TaggedSendRecv
         R* rbuf, int rc, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::SendRecv"))
+    CommProfileCall profile( "SendRecv", Bytes<R>( sc ) );
     Status status;
     SafeMpi
     ( MPI_Sendrecv
@@ -926,6 +969,7 @@ void TaggedSendRecv
         Complex<R>* rbuf, int rc, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::SendRecv"))
+    CommProfileCall profile( "SendRecv", Bytes<Complex<R>>( sc ) );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1023,7 +1067,7 @@ template void SendRecv
 
 template<typename T>
 T TaggedSendRecv( T sb, int to, int stag, int from, int rtag, Comm comm )
-{ 
+{
     T rb; 
     TaggedSendRecv( &sb, 1, to, stag, &rb, 1, from, rtag, comm ); 
     return rb; 
@@ -1079,6 +1123,7 @@ void TaggedSendRecv
 ( R* buf, int count, int to, int stag, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::SendRecv"))
+    CommProfileCall profile( "SendRecv", Bytes<R>( count ) );
     Status status;
     SafeMpi
     ( MPI_Sendrecv_replace
@@ -1090,6 +1135,7 @@ void TaggedSendRecv
 ( Complex<R>* buf, int count, int to, int stag, int from, int rtag, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::SendRecv"))
+    CommProfileCall profile( "SendRecv", Bytes<Complex<R>>( count ) );
     Status status;
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
@@ -1164,6 +1210,7 @@ template<typename R>
 void Broadcast( R* buf, int count, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Broadcast"))
+    CommProfileCall profile( "Broadcast", Bytes<R>( count ) );
     SafeMpi( MPI_Bcast( buf, count, TypeMap<R>(), root, comm.comm ) );
 }
 
@@ -1171,6 +1218,7 @@ template<typename R>
 void Broadcast( Complex<R>* buf, int count, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Broadcast"))
+    CommProfileCall profile( "Broadcast", Bytes<Complex<R>>( count ) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi( MPI_Bcast( buf, 2*count, TypeMap<R>(), root, comm.comm ) );
 #else
@@ -1215,6 +1263,7 @@ template<typename R>
 void IBroadcast( R* buf, int count, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IBroadcast"))
+    CommProfileCall profile( "IBroadcast", Bytes<R>( count ) );
     SafeMpi
     ( MPI_Ibcast( buf, count, TypeMap<R>(), root, comm.comm, &request ) );
 }
@@ -1224,6 +1273,7 @@ void IBroadcast
 ( Complex<R>* buf, int count, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IBroadcast"))
+    CommProfileCall profile( "IBroadcast", Bytes<Complex<R>>( count ) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Ibcast( buf, 2*count, TypeMap<R>(), root, comm.comm, &request ) );
@@ -1273,6 +1323,7 @@ void Gather
         R* rbuf, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Gather"))
+    CommProfileCall profile( "Gather", Bytes<R>( sc ) );
     SafeMpi
     ( MPI_Gather
       ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
@@ -1285,6 +1336,7 @@ void Gather
         Complex<R>* rbuf, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Gather"))
+    CommProfileCall profile( "Gather", Bytes<Complex<R>>( sc ) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Gather
@@ -1320,6 +1372,7 @@ void IGather
         R* rbuf, int rc, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IGather"))
+    CommProfileCall profile( "IGather", Bytes<R>( sc ) );
     SafeMpi
     ( MPI_Igather
       ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
@@ -1332,6 +1385,7 @@ void IGather
         Complex<R>* rbuf, int rc, int root, Comm comm, Request& request )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::IGather"))
+    CommProfileCall profile( "IGather", Bytes<Complex<R>>( sc ) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Igather
@@ -1390,6 +1444,7 @@ void Gather
         R* rbuf, const int* rcs, const int* rds, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Gather"))
+    CommProfileCall profile( "Gather", Bytes<R>( sc ) );
     SafeMpi
     ( MPI_Gatherv
       ( const_cast<R*>(sbuf), 
@@ -1409,6 +1464,7 @@ void Gather
         Complex<R>* rbuf, const int* rcs, const int* rds, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Gather"))
+    CommProfileCall profile( "Gather", Bytes<Complex<R>>( sc ) );
 #ifdef EL_AVOID_COMPLEX_MPI
     const int commRank = Rank( comm );
     const int commSize = Size( comm );
@@ -1487,6 +1543,7 @@ void AllGather
         R* rbuf, int rc, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllGather"))
+    CommProfileCall profile( "AllGather", Bytes<R>( sc ) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1507,6 +1564,7 @@ void AllGather
         Complex<R>* rbuf, int rc, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllGather"))
+    CommProfileCall profile( "AllGather", Bytes<Complex<R>>( sc ) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     SafeMpi
     ( MPI_Allgather
@@ -1548,6 +1606,7 @@ void AllGather
         R* rbuf, const int* rcs, const int* rds, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllGather"))
+    CommProfileCall profile( "AllGather", Bytes<R>( sc ) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     std::vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1581,6 +1640,7 @@ void AllGather
         Complex<R>* rbuf, const int* rcs, const int* rds, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllGather"))
+    CommProfileCall profile( "AllGather", Bytes<Complex<R>>( sc ) );
 #ifdef EL_USE_BYTE_ALLGATHERS
     const int commSize = Size( comm );
     std::vector<int> byteRcs( commSize ), byteRds( commSize );
@@ -1664,6 +1724,7 @@ void Scatter
         R* rbuf, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Scatter"))
+    CommProfileCall profile( "Scatter", Bytes<R>( rc ) );
     SafeMpi
     ( MPI_Scatter
       ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
@@ -1676,6 +1737,7 @@ void Scatter
         Complex<R>* rbuf, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Scatter"))
+    CommProfileCall profile( "Scatter", Bytes<Complex<R>>( rc ) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Scatter
@@ -1730,6 +1792,7 @@ template<typename R>
 void Scatter( R* buf, int sc, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Scatter"))
+    CommProfileCall profile( "Scatter", Bytes<R>( rc ) );
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1761,6 +1824,7 @@ template<typename R>
 void Scatter( Complex<R>* buf, int sc, int rc, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Scatter"))
+    CommProfileCall profile( "Scatter", Bytes<Complex<R>>( rc ) );
     const int commRank = Rank( comm );
     if( commRank == root )
     {
@@ -1832,6 +1896,7 @@ void AllToAll
         R* rbuf, int rc, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllToAll"))
+    CommProfileCall profile( "AllToAll", Bytes<R>( sc, comm ) );
     SafeMpi
     ( MPI_Alltoall
       ( const_cast<R*>(sbuf), sc, TypeMap<R>(),
@@ -1844,6 +1909,7 @@ void AllToAll
         Complex<R>* rbuf, int rc, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllToAll"))
+    CommProfileCall profile( "AllToAll", Bytes<Complex<R>>( sc, comm ) );
 #ifdef EL_AVOID_COMPLEX_MPI
     SafeMpi
     ( MPI_Alltoall
@@ -1899,6 +1965,7 @@ void AllToAll
         R* rbuf, const int* rcs, const int* rds, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllToAll"))
+    CommProfileCall profile( "AllToAll", Bytes<R>( scs, comm ) );
     SafeMpi
     ( MPI_Alltoallv
       ( const_cast<R*>(sbuf), 
@@ -1918,6 +1985,7 @@ void AllToAll
         Complex<R>* rbuf, const int* rcs, const int* rds, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllToAll"))
+    CommProfileCall profile( "AllToAll", Bytes<Complex<R>>( scs, comm ) );
 #ifdef EL_AVOID_COMPLEX_MPI
     int p;
     MPI_Comm_size( comm.comm, &p );
@@ -1994,6 +2062,7 @@ void Reduce
 ( const T* sbuf, T* rbuf, int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Reduce"))
+    CommProfileCall profile( "Reduce", Bytes<T>( count ) );
     if( count != 0 )
     {
         SafeMpi
@@ -2009,6 +2078,7 @@ void Reduce
         Complex<R>* rbuf, int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Reduce"))
+    CommProfileCall profile( "Reduce", Bytes<Complex<R>>( count ) );
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2081,7 +2151,7 @@ template void Reduce( const ValueIntPair<double>* sbuf, ValueIntPair<double>* rb
 
 template<typename T>
 T Reduce( T sb, Op op, int root, Comm comm )
-{ 
+{
     T rb;
     Reduce( &sb, &rb, 1, op, root, comm );
     return rb;
@@ -2109,7 +2179,7 @@ template ValueIntPair<double> Reduce( ValueIntPair<double> sb, Op op, int root,
 
 template<typename T>
 T Reduce( T sb, int root, Comm comm )
-{ 
+{
     T rb;
     Reduce( &sb, &rb, 1, mpi::SUM, root, comm );
     return rb;
@@ -2139,6 +2209,7 @@ template<typename T>
 void Reduce( T* buf, int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Reduce"))
+    CommProfileCall profile( "Reduce", Bytes<T>( count ) );
     if( count != 0 )
     {
         const int commRank = Rank( comm );
@@ -2169,6 +2240,7 @@ template<typename R>
 void Reduce( Complex<R>* buf, int count, Op op, int root, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::Reduce"))
+    CommProfileCall profile( "Reduce", Bytes<Complex<R>>( count ) );
     if( count != 0 )
     {
         const int commRank = Rank( comm );
@@ -2294,6 +2366,7 @@ template<typename T>
 void AllReduce( const T* sbuf, T* rbuf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllReduce"))
+    CommProfileCall profile( "AllReduce", Bytes<T>( count ) );
     if( count != 0 )
     {
         SafeMpi
@@ -2308,6 +2381,7 @@ void AllReduce
 ( const Complex<R>* sbuf, Complex<R>* rbuf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllReduce"))
+    CommProfileCall profile( "AllReduce", Bytes<Complex<R>>( count ) );
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2430,6 +2504,7 @@ template<typename T>
 void AllReduce( T* buf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllReduce"))
+    CommProfileCall profile( "AllReduce", Bytes<T>( count ) );
     if( count != 0 )
     {
 #ifdef EL_HAVE_MPI_IN_PLACE
@@ -2450,6 +2525,7 @@ template<typename R>
 void AllReduce( Complex<R>* buf, int count, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::AllReduce"))
+    CommProfileCall profile( "AllReduce", Bytes<Complex<R>>( count ) );
     if( count != 0 )
     {
 #ifdef EL_AVOID_COMPLEX_MPI
@@ -2550,6 +2626,7 @@ template<typename R>
 void ReduceScatter( R* sbuf, R* rbuf, int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    CommProfileCall profile( "ReduceScatter", Bytes<R>( rc, comm ) );
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2571,6 +2648,7 @@ void ReduceScatter
 ( Complex<R>* sbuf, Complex<R>* rbuf, int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    CommProfileCall profile( "ReduceScatter", Bytes<Complex<R>>( rc, comm ) );
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2665,6 +2743,7 @@ template<typename R>
 void ReduceScatter( R* buf, int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    CommProfileCall profile( "ReduceScatter", Bytes<R>( rc, comm ) );
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2696,6 +2775,7 @@ template<typename R>
 void ReduceScatter( Complex<R>* buf, int rc, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    CommProfileCall profile( "ReduceScatter", Bytes<Complex<R>>( rc, comm ) );
 #ifdef EL_REDUCE_SCATTER_BLOCK_VIA_ALLREDUCE
     const int commSize = Size( comm );
     const int commRank = Rank( comm );
@@ -2774,6 +2854,7 @@ void ReduceScatter
 ( const R* sbuf, R* rbuf, const int* rcs, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    CommProfileCall profile( "ReduceScatter", Bytes<R>( rcs, comm ) );
     SafeMpi
     ( MPI_Reduce_scatter
       ( const_cast<R*>(sbuf), 
@@ -2785,6 +2866,7 @@ void ReduceScatter
 ( const Complex<R>* sbuf, Complex<R>* rbuf, const int* rcs, Op op, Comm comm )
 {
     DEBUG_ONLY(CallStackEntry cse("mpi::ReduceScatter"))
+    CommProfileCall profile( "ReduceScatter", Bytes<Complex<R>>( rcs, comm ) );
 #ifdef EL_AVOID_COMPLEX_MPI
     if( op == SUM )
     {
@@ -14,6 +14,7 @@
 #include "./Cholesky/UVar3.hpp"
 #include "./Cholesky/UVar3Square.hpp"
 #include "./Cholesky/UVar3Pivoted.hpp"
+#include "./Cholesky/Lookahead.hpp"
 #include "./Cholesky/SolveAfter.hpp"
 
 #include "./Cholesky/LMod.hpp"
@@ -31,6 +32,7 @@ void Cholesky( UpperOrLower uplo, Matrix<F>& A )
         if( A.Height() != A.Width() )
             LogicError("A must be square");
     )
+    ScopedTimer timer("Cholesky");
     if( uplo == LOWER )
         cholesky::LVar3( A );
     else
@@ -45,6 +47,7 @@ void Cholesky( UpperOrLower uplo, Matrix<F>& A, Matrix<Int>& pPerm )
         if( A.Height() != A.Width() )
             LogicError("A must be square");
     )
+    ScopedTimer timer("Cholesky");
     if( uplo == LOWER )
         cholesky::LVar3( A, pPerm );
     else
@@ -59,6 +62,7 @@ void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A )
         if( A.Height() != A.Width() )
             LogicError("A must be square");
     )
+    ScopedTimer timer("ReverseCholesky");
     if( uplo == LOWER )
         cholesky::ReverseLVar3( A );
     else
@@ -66,11 +70,20 @@ void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A )
 }
 
 template<typename F> 
-void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A )
+void Cholesky
+( UpperOrLower uplo, AbstractDistMatrix<F>& A, const CholeskyCtrl& ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("Cholesky"))
+    ScopedTimer timer("Cholesky");
     const Grid& g = A.Grid();
-    if( g.Height() == g.Width() )
+    if( ctrl.lookahead )
+    {
+        if( uplo == LOWER )
+            cholesky::LVar3Lookahead( A );
+        else
+            cholesky::UVar3Lookahead( A );
+    }
+    else if( g.Height() == g.Width() )
     {
         if( uplo == LOWER )
             cholesky::LVar3Square( A );
@@ -91,6 +104,7 @@ void Cholesky
 ( UpperOrLower uplo, AbstractDistMatrix<F>& A, AbstractDistMatrix<Int>& pPerm )
 {
     DEBUG_ONLY(CallStackEntry cse("Cholesky"))
+    ScopedTimer timer("Cholesky");
     if( uplo == LOWER )
         cholesky::LVar3( A, pPerm );
     else
@@ -101,6 +115,7 @@ template<typename F>
 void ReverseCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("ReverseCholesky"))
+    ScopedTimer timer("ReverseCholesky");
     if( uplo == LOWER )
         cholesky::ReverseLVar3( A );
     else
@@ -187,7 +202,8 @@ void HPSDCholesky( UpperOrLower uplo, AbstractDistMatrix<F>& APre )
 
 #define PROTO(F) \
   template void Cholesky( UpperOrLower uplo, Matrix<F>& A ); \
-  template void Cholesky( UpperOrLower uplo, AbstractDistMatrix<F>& A ); \
+  template void Cholesky \
+  ( UpperOrLower uplo, AbstractDistMatrix<F>& A, const CholeskyCtrl& ctrl ); \
   template void ReverseCholesky( UpperOrLower uplo, Matrix<F>& A ); \
   template void ReverseCholesky \
   ( UpperOrLower uplo, AbstractDistMatrix<F>& A ); \
@@ -0,0 +1,255 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_CHOLESKY_LOOKAHEAD_HPP
+#define EL_CHOLESKY_LOOKAHEAD_HPP
+
+// These variants perform the same computation as LVar3 and UVar3, but each
+// trailing update is split so that the columns (rows) of the next panel are
+// updated first. The next panel is then factored and redistributed before the
+// remainder of the trailing update is applied, so that the processes enter the
+// collectives of the next panel without first performing the (large and
+// possibly imbalanced) update of the rest of the trailing matrix.
+
+namespace El {
+namespace cholesky {
+
+// Factor the panel A(k:k+nb,k:k+nb), solve against A(k+nb:n,k:k+nb), and
+// form the gathered copies of the latter needed for the trailing update
+template<typename F>
+inline void
+LVar3LookaheadPanel
+( DistMatrix<F>& A, Int k, Int nb,
+  DistMatrix<F,STAR,STAR>& A11_STAR_STAR,
+  DistMatrix<F,VC,  STAR>& A21_VC_STAR,
+  DistMatrix<F,VR,  STAR>& A21_VR_STAR,
+  DistMatrix<F,STAR,MC  >& A21Trans_STAR_MC,
+  DistMatrix<F,STAR,MR  >& A21Adj_STAR_MR )
+{
+    DEBUG_ONLY(CallStackEntry cse("cholesky::LVar3LookaheadPanel"))
+    const Int n = A.Height();
+    const Range<Int> ind1( k,    k+nb ),
+                     ind2( k+nb, n    );
+
+    auto A11 = A( ind1, ind1 );
+    auto A21 = A( ind2, ind1 );
+    auto A22 = A( ind2, ind2 );
+
+    A11_STAR_STAR = A11;
+    LocalCholesky( LOWER, A11_STAR_STAR );
+    A11 = A11_STAR_STAR;
+
+    A21_VC_STAR.AlignWith( A22 );
+    A21_VC_STAR = A21;
+    LocalTrsm
+    ( RIGHT, LOWER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A21_VC_STAR );
+
+    A21_VR_STAR.AlignWith( A22 );
+    A21_VR_STAR = A21_VC_STAR;
+    A21Trans_STAR_MC.AlignWith( A22 );
+    A21Adj_STAR_MR.AlignWith( A22 );
+    A21_VC_STAR.TransposePartialColAllGather( A21Trans_STAR_MC );
+    A21_VR_STAR.AdjointPartialColAllGather( A21Adj_STAR_MR );
+
+    // The trailing update only reads from the gathered copies
+    A21.TransposeRowFilterFrom( A21Trans_STAR_MC );
+}
+
+template<typename F>
+inline void
+LVar3Lookahead( AbstractDistMatrix<F>& APre )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("cholesky::LVar3Lookahead");
+        if( APre.Height() != APre.Width() )
+            LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& g = APre.Grid();
+    auto APtr = ReadWriteProxy<F,MC,MR>( &APre );
+    auto& A = *APtr;
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,VC,  STAR> A21_VC_STAR(g);
+    DistMatrix<F,VR,  STAR> A21_VR_STAR(g);
+    // The gathered copies of the current panel are still needed while those
+    // of the next panel are formed
+    DistMatrix<F,STAR,MC  > A21TransA_STAR_MC(g), A21TransB_STAR_MC(g);
+    DistMatrix<F,STAR,MR  > A21AdjA_STAR_MR(g), A21AdjB_STAR_MR(g);
+    auto* A21Trans_STAR_MC = &A21TransA_STAR_MC;
+    auto* A21Adj_STAR_MR = &A21AdjA_STAR_MR;
+    auto* A21TransNext_STAR_MC = &A21TransB_STAR_MC;
+    auto* A21AdjNext_STAR_MR = &A21AdjB_STAR_MR;
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    if( n == 0 )
+        return;
+    LVar3LookaheadPanel
+    ( A, 0, Min(bsize,n), A11_STAR_STAR, A21_VC_STAR, A21_VR_STAR,
+      *A21Trans_STAR_MC, *A21Adj_STAR_MR );
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int n2 = n-(k+nb);
+        if( n2 == 0 )
+            break;
+        const Int nbNext = Min(bsize,n2);
+
+        const Range<Int> ind2( k+nb, n ),
+                         indP( 0, nb ),
+                         indN( 0, nbNext ),
+                         indR( nbNext, n2 );
+
+        auto A22 = A( ind2, ind2 );
+        auto A22NN = A22( indN, indN );
+        auto A22RN = A22( indR, indN );
+        auto A22RR = A22( indR, indR );
+
+        auto A21TransN_STAR_MC = (*A21Trans_STAR_MC)( indP, indN );
+        auto A21TransR_STAR_MC = (*A21Trans_STAR_MC)( indP, indR );
+        auto A21AdjN_STAR_MR = (*A21Adj_STAR_MR)( indP, indN );
+        auto A21AdjR_STAR_MR = (*A21Adj_STAR_MR)( indP, indR );
+
+        // Update the columns of the next panel
+        LocalTrrk
+        ( LOWER, TRANSPOSE,
+          F(-1), A21TransN_STAR_MC, A21AdjN_STAR_MR, F(1), A22NN );
+        LocalGemm
+        ( TRANSPOSE, NORMAL,
+          F(-1), A21TransR_STAR_MC, A21AdjN_STAR_MR, F(1), A22RN );
+
+        // Factor the next panel before finishing the trailing update
+        LVar3LookaheadPanel
+        ( A, k+nb, nbNext, A11_STAR_STAR, A21_VC_STAR, A21_VR_STAR,
+          *A21TransNext_STAR_MC, *A21AdjNext_STAR_MR );
+
+        LocalTrrk
+        ( LOWER, TRANSPOSE,
+          F(-1), A21TransR_STAR_MC, A21AdjR_STAR_MR, F(1), A22RR );
+
+        std::swap( A21Trans_STAR_MC, A21TransNext_STAR_MC );
+        std::swap( A21Adj_STAR_MR, A21AdjNext_STAR_MR );
+    }
+}
+
+// Factor the panel A(k:k+nb,k:k+nb), solve against A(k:k+nb,k+nb:n), and
+// form the gathered copies of the latter needed for the trailing update
+template<typename F>
+inline void
+UVar3LookaheadPanel
+( DistMatrix<F>& A, Int k, Int nb,
+  DistMatrix<F,STAR,STAR>& A11_STAR_STAR,
+  DistMatrix<F,STAR,VR  >& A12_STAR_VR,
+  DistMatrix<F,STAR,MC  >& A12_STAR_MC,
+  DistMatrix<F,STAR,MR  >& A12_STAR_MR )
+{
+    DEBUG_ONLY(CallStackEntry cse("cholesky::UVar3LookaheadPanel"))
+    const Int n = A.Height();
+    const Range<Int> ind1( k,    k+nb ),
+                     ind2( k+nb, n    );
+
+    auto A11 = A( ind1, ind1 );
+    auto A12 = A( ind1, ind2 );
+    auto A22 = A( ind2, ind2 );
+
+    A11_STAR_STAR = A11;
+    LocalCholesky( UPPER, A11_STAR_STAR );
+    A11 = A11_STAR_STAR;
+
+    A12_STAR_VR.AlignWith( A22 );
+    A12_STAR_VR = A12;
+    LocalTrsm
+    ( LEFT, UPPER, ADJOINT, NON_UNIT, F(1), A11_STAR_STAR, A12_STAR_VR );
+
+    A12_STAR_MC.AlignWith( A22 );
+    A12_STAR_MC = A12_STAR_VR;
+    A12_STAR_MR.AlignWith( A22 );
+    A12_STAR_MR = A12_STAR_VR;
+
+    // The trailing update only reads from the gathered copies
+    A12 = A12_STAR_MR;
+}
+
+template<typename F>
+inline void
+UVar3Lookahead( AbstractDistMatrix<F>& APre )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("cholesky::UVar3Lookahead");
+        if( APre.Height() != APre.Width() )
+            LogicError("Can only compute Cholesky factor of square matrices");
+    )
+    const Grid& g = APre.Grid();
+    auto APtr = ReadWriteProxy<F,MC,MR>( &APre );
+    auto& A = *APtr;
+
+    DistMatrix<F,STAR,STAR> A11_STAR_STAR(g);
+    DistMatrix<F,STAR,VR  > A12_STAR_VR(g);
+    // The gathered copies of the current panel are still needed while those
+    // of the next panel are formed
+    DistMatrix<F,STAR,MC  > A12A_STAR_MC(g), A12B_STAR_MC(g);
+    DistMatrix<F,STAR,MR  > A12A_STAR_MR(g), A12B_STAR_MR(g);
+    auto* A12_STAR_MC = &A12A_STAR_MC;
+    auto* A12_STAR_MR = &A12A_STAR_MR;
+    auto* A12Next_STAR_MC = &A12B_STAR_MC;
+    auto* A12Next_STAR_MR = &A12B_STAR_MR;
+
+    const Int n = A.Height();
+    const Int bsize = Blocksize();
+    if( n == 0 )
+        return;
+    UVar3LookaheadPanel
+    ( A, 0, Min(bsize,n), A11_STAR_STAR, A12_STAR_VR,
+      *A12_STAR_MC, *A12_STAR_MR );
+    for( Int k=0; k<n; k+=bsize )
+    {
+        const Int nb = Min(bsize,n-k);
+        const Int n2 = n-(k+nb);
+        if( n2 == 0 )
+            break;
+        const Int nbNext = Min(bsize,n2);
+
+        const Range<Int> ind2( k+nb, n ),
+                         indP( 0, nb ),
+                         indN( 0, nbNext ),
+                         indR( nbNext, n2 );
+
+        auto A22 = A( ind2, ind2 );
+        auto A22NN = A22( indN, indN );
+        auto A22NR = A22( indN, indR );
+        auto A22RR = A22( indR, indR );
+
+        auto A12N_STAR_MC = (*A12_STAR_MC)( indP, indN );
+        auto A12R_STAR_MC = (*A12_STAR_MC)( indP, indR );
+        auto A12N_STAR_MR = (*A12_STAR_MR)( indP, indN );
+        auto A12R_STAR_MR = (*A12_STAR_MR)( indP, indR );
+
+        // Update the rows of the next panel
+        LocalTrrk
+        ( UPPER, ADJOINT, F(-1), A12N_STAR_MC, A12N_STAR_MR, F(1), A22NN );
+        LocalGemm
+        ( ADJOINT, NORMAL, F(-1), A12N_STAR_MC, A12R_STAR_MR, F(1), A22NR );
+
+        // Factor the next panel before finishing the trailing update
+        UVar3LookaheadPanel
+        ( A, k+nb, nbNext, A11_STAR_STAR, A12_STAR_VR,
+          *A12Next_STAR_MC, *A12Next_STAR_MR );
+
+        LocalTrrk
+        ( UPPER, ADJOINT, F(-1), A12R_STAR_MC, A12R_STAR_MR, F(1), A22RR );
+
+        std::swap( A12_STAR_MC, A12Next_STAR_MC );
+        std::swap( A12_STAR_MR, A12Next_STAR_MR );
+    }
+}
+
+} // namespace cholesky
+} // namespace El
+
+#endif // ifndef EL_CHOLESKY_LOOKAHEAD_HPP
@@ -8,8 +8,11 @@
 */
 #include "El.hpp"
 
+#include "./QR/TS.hpp"
+
 #include "./LU/Local.hpp"
 #include "./LU/Panel.hpp"
+#include "./LU/Tournament.hpp"
 #include "./LU/Full.hpp"
 #include "./LU/Mod.hpp"
 #include "./LU/SolveAfter.hpp"
@@ -22,6 +25,7 @@ template<typename F>
 void LU( Matrix<F>& A )
 {
     DEBUG_ONLY(CallStackEntry cse("LU"))
+    ScopedTimer timer("LU");
     const Int m = A.Height();
     const Int n = A.Width();
     const Int minDim = Min(m,n);
@@ -50,6 +54,7 @@ template<typename F>
 void LU( AbstractDistMatrix<F>& APre )
 {
     DEBUG_ONLY(CallStackEntry cse("LU"))
+    ScopedTimer timer("LU");
 
     auto APtr = ReadWriteProxy<F,MC,MR>( &APre );
     auto& A = *APtr;
@@ -107,6 +112,7 @@ template<typename F>
 void LU( Matrix<F>& A, Matrix<Int>& p )
 {
     DEBUG_ONLY(CallStackEntry cse("LU"))
+    ScopedTimer timer("LU");
 
     const Int m = A.Height();
     const Int n = A.Width();
@@ -159,16 +165,20 @@ template<typename F>
 void LU( Matrix<F>& A, Matrix<Int>& p, Matrix<Int>& q )
 {
     DEBUG_ONLY(CallStackEntry cse("LU"))
+    ScopedTimer timer("LU");
     lu::Full( A, p, q );
 }
 
 template<typename F> 
-void LU( AbstractDistMatrix<F>& APre, AbstractDistMatrix<Int>& pPre )
+void LU
+( AbstractDistMatrix<F>& APre, AbstractDistMatrix<Int>& pPre,
+  const LUCtrl& ctrl )
 {
     DEBUG_ONLY(
         CallStackEntry cse("LU");
         AssertSameGrids( APre, pPre );
     )
+    ScopedTimer timer("LU");
 
     auto APtr = ReadWriteProxy<F,MC,MR>( &APre ); auto& A = *APtr;
     auto pPtr = WriteProxy<Int,VC,STAR>( &pPre ); auto& p = *pPtr;
@@ -213,7 +223,10 @@ void LU( AbstractDistMatrix<F>& APre, AbstractDistMatrix<Int>& pPre )
         A21_MC_STAR = A21;
         A11_STAR_STAR = A11;
 
-        lu::Panel( A11_STAR_STAR, A21_MC_STAR, p1Piv_STAR_STAR );
+        if( ctrl.tournament )
+            lu::TournamentPanel( A11_STAR_STAR, A21_MC_STAR, p1Piv_STAR_STAR );
+        else
+            lu::Panel( A11_STAR_STAR, A21_MC_STAR, p1Piv_STAR_STAR );
         PivotsToPartialPermutation( p1Piv_STAR_STAR, p1, p1Inv );
         PermuteRows( AB, p1, p1Inv );
 
@@ -244,6 +257,7 @@ void LU
   AbstractDistMatrix<Int>& p, AbstractDistMatrix<Int>& q )
 {
     DEBUG_ONLY(CallStackEntry cse("LU"))
+    ScopedTimer timer("LU");
     lu::Full( A, p, q );
 }
 
@@ -251,7 +265,9 @@ void LU
   template void LU( Matrix<F>& A ); \
   template void LU( AbstractDistMatrix<F>& A ); \
   template void LU( Matrix<F>& A, Matrix<Int>& p ); \
-  template void LU( AbstractDistMatrix<F>& A, AbstractDistMatrix<Int>& p ); \
+  template void LU \
+  ( AbstractDistMatrix<F>& A, AbstractDistMatrix<Int>& p, \
+    const LUCtrl& ctrl ); \
   template void LU( Matrix<F>& A, Matrix<Int>& p, Matrix<Int>& q ); \
   template void LU \
   ( AbstractDistMatrix<F>& A, \
@@ -266,6 +282,10 @@ void LU
     bool conjugate, Base<F> tau ); \
   template void lu::Panel( Matrix<F>& APan, Matrix<Int>& p1 ); \
   template void lu::Panel \
+  ( DistMatrix<F,  STAR,STAR>& A11, \
+    DistMatrix<F,  MC,  STAR>& A21, \
+    DistMatrix<Int,STAR,STAR>& p1 ); \
+  template void lu::TournamentPanel \
   ( DistMatrix<F,  STAR,STAR>& A11, \
     DistMatrix<F,  MC,  STAR>& A21, \
     DistMatrix<Int,STAR,STAR>& p1 ); \
@@ -0,0 +1,266 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_LU_TOURNAMENT_HPP
+#define EL_LU_TOURNAMENT_HPP
+
+// Tournament pivoting, as used by communication-avoiding LU (CALU): each
+// process in a process column nominates the rows chosen by partial pivoting
+// on its own rows of the panel, and the nominees are played against each other
+// up the same binary tree over the process column as TSQR (qr::ts::ReduceTree).
+// The panel is then factored without pivoting after moving the winners to the
+// top, which requires O(log p) messages per panel rather than O(nb log p).
+
+namespace El {
+namespace lu {
+namespace tournament {
+
+// Keep the (at most n) rows of C which partial pivoting would choose, in the
+// order in which they are chosen, along with their indices. The original
+// values of the rows are kept, and a column without a nonzero candidate is
+// skipped rather than treated as singular
+template<typename F>
+inline void
+Select( Matrix<F>& C, std::vector<Int>& rows )
+{
+    DEBUG_ONLY(CallStackEntry cse("lu::tournament::Select"))
+    typedef Base<F> Real;
+    const Int m = C.Height();
+    const Int n = C.Width();
+    const Int numWinners = Min(m,n);
+
+    std::vector<Int> order( m );
+    for( Int i=0; i<m; ++i )
+        order[i] = i;
+    Matrix<F> W( C );
+    for( Int j=0; j<numWinners; ++j )
+    {
+        Int iPiv = j;
+        Real maxAbs = FastAbs(W.Get(j,j));
+        for( Int i=j+1; i<m; ++i )
+        {
+            const Real value = FastAbs(W.Get(i,j));
+            if( value > maxAbs )
+            {
+                maxAbs = value;
+                iPiv = i;
+            }
+        }
+        if( iPiv != j )
+        {
+            blas::Swap
+            ( n, W.Buffer(j,0), W.LDim(), W.Buffer(iPiv,0), W.LDim() );
+            std::swap( order[j], order[iPiv] );
+        }
+
+        const F alpha = W.Get(j,j);
+        if( alpha == F(0) )
+            continue;
+        blas::Scal( m-(j+1), F(1)/alpha, W.Buffer(j+1,j), 1 );
+        blas::Geru
+        ( m-(j+1), n-(j+1),
+          F(-1), W.LockedBuffer(j+1,j), 1, W.LockedBuffer(j,j+1), W.LDim(),
+                 W.Buffer(j+1,j+1), W.LDim() );
+    }
+
+    Matrix<F> winners( numWinners, n );
+    std::vector<Int> winnerRows( numWinners );
+    for( Int k=0; k<numWinners; ++k )
+    {
+        for( Int j=0; j<n; ++j )
+            winners.Set( k, j, C.Get(order[k],j) );
+        winnerRows[k] = rows[order[k]];
+    }
+    C = winners;
+    rows = winnerRows;
+}
+
+// The candidates are exchanged as a single message holding their number,
+// their indices (padded to a multiple of the size of F) and then their values
+template<typename F>
+inline Int PackedIndexSize( Int numRows )
+{
+    const Int indexSize = (numRows+1)*sizeof(Int);
+    return ((indexSize+sizeof(F)-1)/sizeof(F))*sizeof(F);
+}
+
+template<typename F>
+inline Int PackedSize( Int numRows, Int n )
+{ return PackedIndexSize<F>(numRows) + numRows*n*sizeof(F); }
+
+template<typename F>
+inline void
+Pack( const Matrix<F>& C, const std::vector<Int>& rows, std::vector<byte>& buf )
+{
+    DEBUG_ONLY(CallStackEntry cse("lu::tournament::Pack"))
+    const Int numRows = C.Height();
+    const Int n = C.Width();
+    buf.resize( PackedSize<F>(numRows,n) );
+    byte* head = buf.data();
+    *reinterpret_cast<Int*>(head) = numRows;
+    if( numRows == 0 )
+        return;
+    MemCopy( reinterpret_cast<Int*>(head)+1, rows.data(), numRows );
+    head += PackedIndexSize<F>(numRows);
+    F* values = reinterpret_cast<F*>(head);
+    for( Int j=0; j<n; ++j )
+        MemCopy( &values[j*numRows], C.LockedBuffer(0,j), numRows );
+}
+
+template<typename F>
+inline void
+Unpack
+( const std::vector<byte>& buf, Int n, Matrix<F>& C, std::vector<Int>& rows )
+{
+    DEBUG_ONLY(CallStackEntry cse("lu::tournament::Unpack"))
+    const byte* head = buf.data();
+    const Int numRows = *reinterpret_cast<const Int*>(head);
+    rows.resize( numRows );
+    C.Resize( numRows, n );
+    if( numRows == 0 )
+        return;
+    MemCopy( rows.data(), reinterpret_cast<const Int*>(head)+1, numRows );
+    head += PackedIndexSize<F>(numRows);
+    const F* values = reinterpret_cast<const F*>(head);
+    for( Int j=0; j<n; ++j )
+        MemCopy( C.Buffer(0,j), &values[j*numRows], numRows );
+}
+
+} // namespace tournament
+
+// The same interface as the partially-pivoted Panel: A holds the top nb x nb
+// block of the panel and B the remainder, and the pivots are relative to the
+// top of the panel
+template<typename F>
+void TournamentPanel
+( DistMatrix<F,  STAR,STAR>& A,
+  DistMatrix<F,  MC,  STAR>& B,
+  DistMatrix<Int,STAR,STAR>& pivots )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("lu::TournamentPanel");
+        AssertSameGrids( A, B, pivots );
+        if( A.Width() != B.Width() )
+            LogicError("A and B must be the same width");
+        if( A.Height() != A.Width() )
+            LogicError("A must be square");
+    )
+    const Int n = A.Width();
+    const Int mLocB = B.LocalHeight();
+    const mpi::Comm colComm = B.ColComm();
+    const Int rank = mpi::Rank( colComm );
+    pivots.Resize( n, 1 );
+
+    // Nominate the winners of the local rows, where the rows of A are treated
+    // as belonging to the root of the process column
+    const Int numTop = ( rank==0 ? n : 0 );
+    Matrix<F> C( numTop+mLocB, n );
+    std::vector<Int> rows( numTop+mLocB );
+    for( Int i=0; i<numTop; ++i )
+    {
+        for( Int j=0; j<n; ++j )
+            C.Set( i, j, A.GetLocal(i,j) );
+        rows[i] = i;
+    }
+    for( Int iLoc=0; iLoc<mLocB; ++iLoc )
+    {
+        for( Int j=0; j<n; ++j )
+            C.Set( numTop+iLoc, j, B.GetLocal(iLoc,j) );
+        rows[numTop+iLoc] = n + B.GlobalRow(iLoc);
+    }
+    tournament::Select( C, rows );
+
+    // Run the binary tree reduction, where each message holds the (at most n)
+    // candidate rows of a process and their indices
+    const Int maxSize = tournament::PackedSize<F>(n,n);
+    std::vector<byte> buf;
+    Matrix<F> Z;
+    std::vector<Int> ZRows;
+    auto combine = [&]( Int partner, Int )
+    {
+        buf.resize( maxSize );
+        mpi::Recv( buf.data(), maxSize, partner, colComm );
+        tournament::Unpack( buf, n, Z, ZRows );
+        const Int numOld = C.Height();
+        const Int numRecv = Z.Height();
+        Matrix<F> CStack( numOld+numRecv, n );
+        auto CStackT = CStack( IR(0,numOld), IR(0,n) );
+        auto CStackB = CStack( IR(numOld,numOld+numRecv), IR(0,n) );
+        CStackT = C;
+        CStackB = Z;
+        rows.insert( rows.end(), ZRows.begin(), ZRows.end() );
+        tournament::Select( CStack, rows );
+        C = CStack;
+    };
+    auto pass = [&]( Int partner, Int )
+    {
+        tournament::Pack( C, rows, buf );
+        mpi::Send( buf.data(), buf.size(), partner, colComm );
+    };
+    qr::ts::ReduceTree( colComm, combine, pass );
+
+    // Broadcast the winners (and their original values) from the root
+    if( rank == 0 )
+    {
+        if( C.Height() != n )
+            LogicError("The tournament produced ",C.Height()," of ",n," rows");
+        tournament::Pack( C, rows, buf );
+    }
+    buf.resize( maxSize );
+    mpi::Broadcast( buf.data(), maxSize, 0, colComm );
+    tournament::Unpack( buf, n, Z, ZRows );
+
+    // Convert the winners into a sequence of row swaps, tracking the
+    // (original) row at each position which has been moved
+    std::map<Int,Int> rowAtPos, posOfRow;
+    for( Int k=0; k<n; ++k )
+    {
+        const Int winner = ZRows[k];
+        auto posIt = posOfRow.find( winner );
+        const Int pos = ( posIt==posOfRow.end() ? winner : posIt->second );
+        auto rowIt = rowAtPos.find( k );
+        const Int rowK = ( rowIt==rowAtPos.end() ? k : rowIt->second );
+        pivots.SetLocal( k, 0, pos );
+
+        rowAtPos[pos] = rowK;
+        posOfRow[rowK] = pos;
+        rowAtPos[k] = winner;
+        posOfRow[winner] = k;
+    }
+
+    // Each row moved into B was originally in A, and every row moved into A
+    // is a winner, so the swaps require no further communication
+    for( const auto& entry : rowAtPos )
+    {
+        const Int pos = entry.first;
+        const Int row = entry.second;
+        if( pos < n )
+            continue;
+        DEBUG_ONLY(
+            if( row >= n )
+                LogicError("Moved a row of B into B");
+        )
+        if( B.IsLocalRow(pos-n) )
+        {
+            const Int iLoc = B.LocalRow(pos-n);
+            for( Int j=0; j<n; ++j )
+                B.SetLocal( iLoc, j, A.GetLocal(row,j) );
+        }
+    }
+    A.Matrix() = Z;
+
+    // Factor the panel without pivoting
+    LU( A.Matrix() );
+    LocalTrsm( RIGHT, UPPER, NORMAL, NON_UNIT, F(1), A, B );
+}
+
+} // namespace lu
+} // namespace El
+
+#endif // ifndef EL_LU_TOURNAMENT_HPP
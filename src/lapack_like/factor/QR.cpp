@@ -22,6 +22,7 @@ template<typename F>
 void QR( Matrix<F>& A, Matrix<F>& t, Matrix<Base<F>>& d )
 {
     DEBUG_ONLY(CallStackEntry cse("QR"))
+    ScopedTimer timer("QR");
     qr::Householder( A, t, d );
 }
 
@@ -31,6 +32,7 @@ void QR
   AbstractDistMatrix<Base<F>>& d )
 {
     DEBUG_ONLY(CallStackEntry cse("QR"))
+    ScopedTimer timer("QR");
     qr::Householder( A, t, d );
 }
 
@@ -43,6 +45,7 @@ void QR
   Matrix<Base<F>>& d, Matrix<Int>& p, const QRCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("QR"))
+    ScopedTimer timer("QR");
     qr::BusingerGolub( A, t, d, p, ctrl );
 }
 
@@ -53,6 +56,7 @@ void QR
   const QRCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("QR"))
+    ScopedTimer timer("QR");
     qr::BusingerGolub( A, t, d, p, ctrl );
 }
 
@@ -14,6 +14,36 @@ namespace El {
 namespace qr {
 namespace ts {
 
+// The binary reduction tree over a communicator: in each stage, every
+// remaining process whose rank has the stage's bit set passes its data to the
+// process whose rank differs only in that bit and then drops out, so that the
+// result is left on the root (rank zero) after ceil(log2(p)) stages. When p is
+// not a power of two, a process whose partner does not exist idles during that
+// stage. 'combine(partner,stage)' must receive and absorb the data of the
+// partner and 'pass(partner,stage)' must send this process's data to it.
+template<class CombineFunc,class PassFunc>
+inline void
+ReduceTree( mpi::Comm comm, CombineFunc combine, PassFunc pass )
+{
+    DEBUG_ONLY(CallStackEntry cse("qr::ts::ReduceTree"))
+    const Int p = mpi::Size( comm );
+    const Int rank = mpi::Rank( comm );
+    for( Int stage=0; (Int(1)<<stage)<p; ++stage )
+    {
+        const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
+        if( rank < partner )
+        {
+            if( partner < p )
+                combine( partner, stage );
+        }
+        else
+        {
+            pass( partner, stage );
+            break;
+        }
+    }
+}
+
 template<typename F>
 void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
 {
@@ -28,7 +58,6 @@ void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
     const Int p = mpi::Size( colComm );
     if( p == 1 )
         return;
-    const Int rank = mpi::Rank( colComm );
     if( m < p*n ) 
         LogicError("TSQR currently assumes height >= width*numProcesses");
     if( !PowerOfTwo(p) )
@@ -39,26 +68,13 @@ void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
     treeData.tList.resize( logp );
     treeData.dList.resize( logp );
 
-    // Run the binary tree reduction
+    // Run the binary tree reduction, where each message is an n x n matrix
     Matrix<F> ZTop(n,n,n), ZBot(n,n,n);
-    for( Int stage=0; stage<logp; ++stage )
+    auto combine = [&]( Int partner, Int stage )
     {
-        // Pack, then send and receive n x n matrices
-        const Int partner = Unsigned(rank) ^ (Unsigned(1)<<stage);
-        const bool top = rank < partner;
-        if( top )
-        {
-            ZTop = lastZ;
-            MakeTrapezoidal( UPPER, ZTop );
-            mpi::Recv( ZBot.Buffer(), n*n, partner, colComm );
-        }
-        else
-        {
-            ZBot = lastZ;
-            MakeTrapezoidal( UPPER, ZBot );
-            mpi::Send( ZBot.LockedBuffer(), n*n, partner, colComm );
-            break;
-        }
+        ZTop = lastZ;
+        MakeTrapezoidal( UPPER, ZTop );
+        mpi::Recv( ZBot.Buffer(), n*n, partner, colComm );
 
         auto& Q = treeData.QRList[stage];
         auto& t = treeData.tList[stage];
@@ -80,7 +96,14 @@ void Reduce( const AbstractDistMatrix<F>& A, TreeData<F>& treeData )
             QR( Q, t, d );
             lastZ = Q( IR(0,n), IR(0,n) );
         }
-    }
+    };
+    auto pass = [&]( Int partner, Int )
+    {
+        ZBot = lastZ;
+        MakeTrapezoidal( UPPER, ZBot );
+        mpi::Send( ZBot.LockedBuffer(), n*n, partner, colComm );
+    };
+    ReduceTree( colComm, combine, pass );
 }
 
 template<typename F>
@@ -56,10 +56,19 @@ ElError ElHermitianEigSubsetDefault_d( ElHermitianEigSubset_d* subset )
     return EL_SUCCESS;
 }
 
+/* HermitianTridiagEigCtrl */
+ElError ElHermitianTridiagEigCtrlDefault( ElHermitianTridiagEigCtrl* ctrl )
+{
+    ctrl->alg = EL_HERMITIAN_TRIDIAG_EIG_MRRR;
+    ctrl->dcCutoff = 64;
+    return EL_SUCCESS;
+}
+
 /* HermitianEigCtrl */
 ElError ElHermitianEigCtrlDefault_s( ElHermitianEigCtrl_s* ctrl )
 {
     ElHermitianTridiagCtrlDefault( &ctrl->tridiagCtrl );
+    ElHermitianTridiagEigCtrlDefault( &ctrl->tridiagEigCtrl );
     ElHermitianSDCCtrlDefault_s( &ctrl->sdcCtrl );
     ctrl->useSDC = false;
     return EL_SUCCESS;
@@ -67,6 +76,7 @@ ElError ElHermitianEigCtrlDefault_s( ElHermitianEigCtrl_s* ctrl )
 ElError ElHermitianEigCtrlDefault_d( ElHermitianEigCtrl_d* ctrl )
 {
     ElHermitianTridiagCtrlDefault( &ctrl->tridiagCtrl );
+    ElHermitianTridiagEigCtrlDefault( &ctrl->tridiagEigCtrl );
     ElHermitianSDCCtrlDefault_d( &ctrl->sdcCtrl );
     ctrl->useSDC = false;
     return EL_SUCCESS;
@@ -110,6 +120,10 @@ ElError ElHessQRCtrlDefault( ElHessQRCtrl* ctrl )
     ctrl->distAED = false;
     ctrl->blockHeight = DefaultBlockHeight();
     ctrl->blockWidth = DefaultBlockWidth();
+    ctrl->scalapack = true;
+    ctrl->numShifts = 0;
+    ctrl->deflationWindow = 0;
+    ctrl->sequentialCutoff = 256;
     return EL_SUCCESS;
 }
 
@@ -194,6 +208,9 @@ ElError ElPseudospecCtrlDefault_s( ElPseudospecCtrl_s* ctrl )
     ctrl->arnoldi = true;
     ctrl->basisSize = 10;
     ctrl->reorthog = true;
+    ctrl->adaptive = false;
+    ctrl->coarseLevels = 3;
+    ctrl->warmStart = true;
     ctrl->progress = false;
     ElSnapshotCtrlDefault( &ctrl->snapCtrl );
     return EL_SUCCESS;
@@ -219,6 +236,9 @@ ElError ElPseudospecCtrlDefault_d( ElPseudospecCtrl_d* ctrl )
     ctrl->arnoldi = true;
     ctrl->basisSize = 10;
     ctrl->reorthog = true;
+    ctrl->adaptive = false;
+    ctrl->coarseLevels = 3;
+    ctrl->warmStart = true;
     ctrl->progress = false;
     ElSnapshotCtrlDefault( &ctrl->snapCtrl );
     return EL_SUCCESS;
@@ -137,6 +137,7 @@ void HermitianEig
   const HermitianEigCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianEig"))
+    ScopedTimer timer("HermitianEig");
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
     if( ctrl.useSDC )
@@ -184,6 +185,7 @@ void HermitianEig
   const HermitianEigCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianEig"))
+    ScopedTimer timer("HermitianEig");
     const Int n = A.Height();
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
@@ -233,6 +235,7 @@ void HermitianEig
   const HermitianEigCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianEig"))
+    ScopedTimer timer("HermitianEig");
     if( APre.Height() != APre.Width() )
         LogicError("Hermitian matrices must be square");
 
@@ -284,6 +287,7 @@ void HermitianEig
   const HermitianEigCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianEig"))
+    ScopedTimer timer("HermitianEig");
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
     if( ctrl.useSDC )
@@ -341,6 +345,7 @@ void HermitianEig
   const HermitianEigCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianEig"))
+    ScopedTimer timer("HermitianEig");
     const Int n = A.Height();
     if( A.Height() != A.Width() )
         LogicError("Hermitian matrices must be square");
@@ -400,6 +405,7 @@ void HermitianEig
   const HermitianEigCtrl<Base<F>> ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianEig"))
+    ScopedTimer timer("HermitianEig");
     typedef Base<F> Real;
     const Int n = APre.Height();
     if( APre.Height() != APre.Width() )
@@ -440,6 +446,26 @@ void HermitianEig
     const Int subdiagonal = ( uplo==LOWER ? -1 : +1 );
     auto d = A.GetRealPartOfDiagonal();
     auto e = A.GetRealPartOfDiagonal( subdiagonal );
+
+    if( ctrl.tridiagEigCtrl.alg == HERMITIAN_TRIDIAG_EIG_DC )
+    {
+        // Divide and conquer directly produces the tridiagonal eigenvectors
+        // in the [MC,MR] distribution needed for the backtransformation
+        DistMatrix<Real> ZReal(g);
+        HermitianTridiagEig
+        ( d, e, w, ZReal, UNSORTED, subset, ctrl.tridiagEigCtrl );
+        auto ZPtr = WriteProxy<F,MC,MR>( &ZPre );
+        auto& Z = *ZPtr;
+        Copy( ZReal, Z );
+        ZReal.Empty();
+
+        herm_tridiag::ApplyQ( LEFT, uplo, NORMAL, A, t, Z );
+        if( needRescaling )
+            Scale( 1/scale, w );
+        herm_eig::Sort( w, Z, sort );
+        return;
+    }
+
     DistMatrix<Real,STAR,STAR> d_STAR_STAR( d );
     DistMatrix<Real,STAR,STAR> e_STAR_STAR( g );
     e_STAR_STAR.Resize( n-1, 1, n );
@@ -9,6 +9,7 @@
 #include "El.hpp"
 
 #include "./HermitianTridiagEig/Sort.hpp"
+#include "./HermitianTridiagEig/DivideAndConquer.hpp"
 
 // NOTE: dSubReal and ZReal could be packed into their complex counterparts
 
@@ -461,10 +462,15 @@ template<typename F>
 void HermitianTridiagEig
 ( const AbstractDistMatrix<Base<F>>& d, const AbstractDistMatrix<F>& dSub,
         AbstractDistMatrix<Base<F>>& w,       AbstractDistMatrix<F>& Z, 
-  SortType sort, const HermitianEigSubset<Base<F>>& subset )
+  SortType sort, const HermitianEigSubset<Base<F>>& subset,
+  const HermitianTridiagEigCtrl& ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianTridiagEig"))
-    herm_tridiag_eig::Helper( d, dSub, w, Z, sort, subset );
+    if( ctrl.alg == HERMITIAN_TRIDIAG_EIG_DC )
+        herm_tridiag_eig::DivideAndConquer
+        ( d, dSub, w, Z, sort, subset, ctrl.dcCutoff );
+    else
+        herm_tridiag_eig::Helper( d, dSub, w, Z, sort, subset );
 }
 
 template<typename Real>
@@ -548,7 +554,8 @@ void HermitianTridiagEigPostEstimate
   template void HermitianTridiagEig \
   ( const AbstractDistMatrix<Base<F>>& d, const AbstractDistMatrix<F>& dSub, \
           AbstractDistMatrix<Base<F>>& w,       AbstractDistMatrix<F>& Z, \
-    SortType sort, const HermitianEigSubset<Base<F>>& subset );
+    SortType sort, const HermitianEigSubset<Base<F>>& subset, \
+    const HermitianTridiagEigCtrl& ctrl );
 
 #define PROTO_REAL(Real) \
   PROTO(Real) \
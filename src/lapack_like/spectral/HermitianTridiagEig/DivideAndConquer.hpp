@@ -0,0 +1,507 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_HERMITIANTRIDIAGEIG_DIVIDEANDCONQUER_HPP
+#define EL_HERMITIANTRIDIAGEIG_DIVIDEANDCONQUER_HPP
+
+// Cuppen's divide and conquer for the real symmetric tridiagonal eigenproblem.
+// The tridiagonal matrix is torn in half with a rank-one modification,
+//
+//   T = | T1       |  + |beta| v v^T,   v = [e_m; sign(beta) e_1],
+//       |       T2 |
+//
+// so that, given T1 = Q1 D1 Q1^T and T2 = Q2 D2 Q2^T, the eigenvectors of T
+// are Q = diag(Q1,Q2) U, where U holds the eigenvectors of the diagonal plus
+// rank-one matrix D + rho z z^T.
+//
+// The diagonal plus rank-one problems are (redundantly) deflated and then
+// their secular equations are solved with the roots spread over the team,
+// so that the cost of each merge does not depend upon how clustered the
+// spectrum is. Each process then forms its columns of U, with the
+// eigenvector formula of Gu and Eisenstat, and the eigenvectors are updated
+// with two distributed Gemm's (one for each of the nonzero blocks of Q).
+
+namespace El {
+namespace herm_tridiag_eig {
+namespace dc {
+
+// Solve the diagonal blocks with (sequential) MRRR, redundantly
+template<typename Real>
+inline void Leaf
+( std::vector<Real>& d, const std::vector<Real>& e,
+  Int off, Int n, DistMatrix<Real>& Z )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag_eig::dc::Leaf"))
+    std::vector<Real> dLeaf(n), eLeaf(n), wLeaf(n);
+    for( Int i=0; i<n; ++i )
+        dLeaf[i] = d[off+i];
+    for( Int i=0; i<n-1; ++i )
+        eLeaf[i] = e[off+i];
+    Matrix<Real> ZLeaf( n, n );
+    lapack::SymmetricTridiagEig
+    ( int(n), dLeaf.data(), eLeaf.data(), wLeaf.data(),
+      ZLeaf.Buffer(), int(ZLeaf.LDim()) );
+    for( Int i=0; i<n; ++i )
+        d[off+i] = wLeaf[i];
+
+    auto ZBlock = View( Z, off, off, n, n );
+    for( Int jLoc=0; jLoc<ZBlock.LocalWidth(); ++jLoc )
+    {
+        const Int j = ZBlock.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<ZBlock.LocalHeight(); ++iLoc )
+            ZBlock.SetLocal( iLoc, jLoc, ZLeaf.Get(ZBlock.GlobalRow(iLoc),j) );
+    }
+}
+
+// Find the j'th root of the secular equation
+//
+//   f(lambda) = 1 + rho sum_i z_i^2 / (d_i - lambda) = 0,
+//
+// where d is strictly increasing and rho > 0. The root is returned as an
+// offset, tau, from the pole closest to it, d_origin, so that the
+// differences d_i - lambda = (d_i - d_origin) - tau can be formed accurately.
+//
+// The two sums on either side of the root are each approximated by a single
+// pole (matching their values and derivatives) and the resulting quadratic is
+// solved, with bisection as a safeguard (in the spirit of Bunch, Nielsen, and
+// Sorensen and of LAPACK's dlaed4).
+template<typename Real>
+inline Int SecularRoot
+( Int j, const std::vector<Real>& d, const std::vector<Real>& z, Real rho,
+  Real& tau )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag_eig::dc::SecularRoot"))
+    const Int k = d.size();
+    const Real eps = lapack::MachineEpsilon<Real>();
+    const bool last = ( j == k-1 );
+
+    Int origin = j;
+    Real lo, hi;
+    if( last )
+    {
+        Real zNormSquared = 0;
+        for( Int i=0; i<k; ++i )
+            zNormSquared += z[i]*z[i];
+        lo = 0;
+        hi = rho*zNormSquared;
+    }
+    else
+    {
+        // Decide which half of (d_j,d_{j+1}) the root lies in
+        const Real gap = d[j+1]-d[j];
+        Real f = 1;
+        for( Int i=0; i<k; ++i )
+            f += rho*z[i]*z[i] / ((d[i]-d[j])-gap/2);
+        if( f >= Real(0) )
+        {
+            lo = 0;
+            hi = gap/2;
+        }
+        else
+        {
+            origin = j+1;
+            lo = -gap/2;
+            hi = 0;
+        }
+    }
+    const Real leftPole = d[j]-d[origin];
+    const Real rightPole = ( last ? Real(0) : d[j+1]-d[origin] );
+
+    tau = (lo+hi)/2;
+    const Int maxIts = 100;
+    for( Int it=0; it<maxIts; ++it )
+    {
+        Real psi=0, psiDer=0, phi=0, phiDer=0;
+        for( Int i=0; i<k; ++i )
+        {
+            const Real delta = (d[i]-d[origin]) - tau;
+            const Real term = rho*z[i]*z[i] / delta;
+            if( i <= j )
+            {
+                psi += term;
+                psiDer += term / delta;
+            }
+            else
+            {
+                phi += term;
+                phiDer += term / delta;
+            }
+        }
+        const Real f = 1 + psi + phi;
+        if( f < Real(0) )
+            lo = tau;
+        else
+            hi = tau;
+        if( Abs(f) <= 8*eps*k*(1+Abs(psi)+Abs(phi)) ||
+            hi-lo <= 2*eps*Max(Abs(lo),Abs(hi)) )
+            break;
+
+        // Solve w + a/(leftGap-nu) + c/(rightGap-nu) = 0 for the step, nu
+        const Real leftGap = leftPole - tau;
+        const Real rightGap = rightPole - tau;
+        const Real a = psiDer*leftGap*leftGap;
+        const Real c = phiDer*rightGap*rightGap;
+        const Real w = 1 + (psi-psiDer*leftGap) + (phi-phiDer*rightGap);
+        Real tauNew = (lo+hi)/2;
+        if( last )
+        {
+            if( w > Real(0) )
+                tauNew = tau + leftGap + a/w;
+        }
+        else
+        {
+            const Real beta = w*(leftGap+rightGap) + a + c;
+            const Real gamma = leftGap*rightGap*f;
+            const Real disc = beta*beta - 4*w*gamma;
+            if( disc >= Real(0) )
+            {
+                const Real denom = ( beta >= Real(0) ? beta + Sqrt(disc)
+                                                     : beta - Sqrt(disc) );
+                if( denom != Real(0) )
+                    tauNew = tau + 2*gamma/denom;
+            }
+        }
+        if( !(tauNew > lo && tauNew < hi) )
+            tauNew = (lo+hi)/2;
+        if( tauNew == tau )
+            break;
+        tau = tauNew;
+    }
+    return origin;
+}
+
+// Merge the eigen-decompositions of the two halves of T(off:off+n,off:off+n),
+// which were torn apart after the first m rows with the subdiagonal entry
+// beta. On entry, d(off:off+m) and d(off+m:off+n) hold the (ascending)
+// eigenvalues of the two halves and the diagonal blocks of
+// Z(off:off+n,off:off+n) their eigenvectors; on exit, they hold the ascending
+// eigenvalues and the eigenvectors of the merged matrix.
+template<typename Real>
+inline void Merge
+( std::vector<Real>& d, Int off, Int m, Int n, Real beta, DistMatrix<Real>& Z )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag_eig::dc::Merge"))
+    const Grid& g = Z.Grid();
+    const Int p = g.Size();
+    const Int vrRank = g.VRRank();
+    const Real eps = lapack::MachineEpsilon<Real>();
+
+    // Form z = diag(Q1,Q2)^T v / sqrt(2) and rho = 2 |beta| (so that z has
+    // unit two-norm)
+    DistMatrix<Real,STAR,STAR> z1_STAR_STAR(g), z2_STAR_STAR(g);
+    Copy( LockedView( Z, off+m-1, off, 1, m ), z1_STAR_STAR );
+    Copy( LockedView( Z, off+m, off+m, 1, n-m ), z2_STAR_STAR );
+    const Real rho = 2*Abs(beta);
+    const Real sgn = ( beta >= Real(0) ? Real(1) : Real(-1) );
+    const Real invSqrtTwo = 1/Sqrt(Real(2));
+    std::vector<Real> z(n);
+    for( Int i=0; i<m; ++i )
+        z[i] = z1_STAR_STAR.GetLocal(0,i)*invSqrtTwo;
+    for( Int i=0; i<n-m; ++i )
+        z[m+i] = sgn*z2_STAR_STAR.GetLocal(0,i)*invSqrtTwo;
+
+    // Sort the poles
+    std::vector<Int> perm(n);
+    for( Int i=0; i<n; ++i )
+        perm[i] = i;
+    std::stable_sort
+    ( perm.begin(), perm.end(),
+      [&]( Int i, Int j ) { return d[off+i] < d[off+j]; } );
+    std::vector<Real> dSort(n), zSort(n);
+    Real dMax=0, zMax=0;
+    for( Int t=0; t<n; ++t )
+    {
+        dSort[t] = d[off+perm[t]];
+        zSort[t] = z[perm[t]];
+        dMax = Max( dMax, Abs(dSort[t]) );
+        zMax = Max( zMax, Abs(zSort[t]) );
+    }
+
+    // Deflate (as in LAPACK's dlaed2) both the components of z which are
+    // negligible and, with Givens rotations, one of each pair of poles which
+    // are too close together. The rotation (a,b,c,s) replaces q_a and q_b
+    // with c q_a - s q_b and s q_a + c q_b, which zeroes z_a.
+    const Real tol = 8*eps*Max(dMax,zMax);
+    std::vector<Int> nonDefl, defl, rotInds;
+    std::vector<Real> rotCosines, rotSines;
+    Int lastInd = -1;
+    for( Int t=0; t<n; ++t )
+    {
+        if( rho*Abs(zSort[t]) <= tol )
+        {
+            defl.push_back( t );
+            continue;
+        }
+        if( lastInd >= 0 )
+        {
+            const Real r = lapack::SafeNorm( zSort[lastInd], zSort[t] );
+            const Real c = zSort[t] / r;
+            const Real s = zSort[lastInd] / r;
+            if( Abs(c*s*(dSort[t]-dSort[lastInd])) <= tol )
+            {
+                const Real dLast = dSort[lastInd];
+                dSort[lastInd] = c*c*dLast + s*s*dSort[t];
+                dSort[t] = s*s*dLast + c*c*dSort[t];
+                zSort[lastInd] = 0;
+                zSort[t] = r;
+                rotInds.push_back( lastInd );
+                rotInds.push_back( t );
+                rotCosines.push_back( c );
+                rotSines.push_back( s );
+                defl.push_back( lastInd );
+            }
+            else
+                nonDefl.push_back( lastInd );
+        }
+        lastInd = t;
+    }
+    if( lastInd >= 0 )
+        nonDefl.push_back( lastInd );
+    const Int k = nonDefl.size();
+    const Int numDefl = defl.size();
+    std::vector<Real> dNon(k), zNon(k);
+    for( Int i=0; i<k; ++i )
+    {
+        dNon[i] = dSort[nonDefl[i]];
+        zNon[i] = zSort[nonDefl[i]];
+    }
+
+    // Solve the secular equation, with the roots spread over the team, and
+    // share the (origin,offset) representations of the roots
+    std::vector<Int> origins(k,0);
+    std::vector<Real> taus(k,0);
+    for( Int j=vrRank; j<k; j+=p )
+        origins[j] = SecularRoot( j, dNon, zNon, rho, taus[j] );
+    mpi::AllReduce( origins.data(), k, g.VRComm() );
+    mpi::AllReduce( taus.data(), k, g.VRComm() );
+
+    // Recompute z so that the computed roots are the exact eigenvalues of a
+    // nearby diagonal plus rank-one matrix (Gu and Eisenstat):
+    //
+    //   zHat_i^2 = prod_j (lambda_j - d_i) / (rho prod_{j != i} (d_j - d_i)),
+    //
+    // where each process contributes the factors from its roots
+    std::vector<Real> zHat(k,1);
+    for( Int j=vrRank; j<k; j+=p )
+    {
+        const Real shift = dNon[origins[j]];
+        for( Int i=0; i<k; ++i )
+        {
+            const Real lambdaMinusD = taus[j] - (dNon[i]-shift);
+            if( i == j )
+                zHat[i] *= lambdaMinusD;
+            else
+                zHat[i] *= lambdaMinusD / (dNon[j]-dNon[i]);
+        }
+    }
+    mpi::AllReduce( zHat.data(), k, mpi::PROD, g.VRComm() );
+    for( Int i=0; i<k; ++i )
+    {
+        zHat[i] = Sqrt(Abs(zHat[i])/rho);
+        if( zNon[i] < Real(0) )
+            zHat[i] = -zHat[i];
+    }
+
+    // Order the eigenvalues of the merged matrix, where indices less than k
+    // refer to roots and the rest to deflated poles
+    std::vector<ValueInt<Real>> order(n);
+    for( Int j=0; j<k; ++j )
+    {
+        order[j].value = dNon[origins[j]] + taus[j];
+        order[j].index = j;
+    }
+    for( Int l=0; l<numDefl; ++l )
+    {
+        order[k+l].value = dSort[defl[l]];
+        order[k+l].index = k+l;
+    }
+    std::stable_sort( order.begin(), order.end(), ValueInt<Real>::Lesser );
+    for( Int r=0; r<n; ++r )
+        d[off+r] = order[r].value;
+
+    // Form our columns of the orthogonal matrix, U, which maps the
+    // eigenvectors of the two halves to those of the merged matrix
+    DistMatrix<Real,STAR,VR> U(g);
+    U.Resize( n, n );
+    std::vector<Real> y(n);
+    const Int numRots = rotCosines.size();
+    for( Int jLoc=0; jLoc<U.LocalWidth(); ++jLoc )
+    {
+        const Int src = order[U.GlobalCol(jLoc)].index;
+        MemZero( y.data(), n );
+        if( src < k )
+        {
+            const Real shift = dNon[origins[src]];
+            Real normSquared = 0;
+            for( Int i=0; i<k; ++i )
+            {
+                const Real delta = (dNon[i]-shift) - taus[src];
+                const Real upsilon = zHat[i] / delta;
+                y[nonDefl[i]] = upsilon;
+                normSquared += upsilon*upsilon;
+            }
+            const Real invNorm = 1/Sqrt(normSquared);
+            for( Int i=0; i<k; ++i )
+                y[nonDefl[i]] *= invNorm;
+        }
+        else
+            y[defl[src-k]] = 1;
+
+        // Undo the deflating rotations (in reverse order) and the sort
+        for( Int l=numRots-1; l>=0; --l )
+        {
+            const Int a = rotInds[2*l];
+            const Int b = rotInds[2*l+1];
+            const Real c = rotCosines[l];
+            const Real s = rotSines[l];
+            const Real ya = y[a];
+            const Real yb = y[b];
+            y[a] =  c*ya + s*yb;
+            y[b] = -s*ya + c*yb;
+        }
+        for( Int t=0; t<n; ++t )
+            U.SetLocal( perm[t], jLoc, y[t] );
+    }
+
+    // Q := diag(Q1,Q2) U
+    auto Q1 = LockedView( Z, off,   off,   m,   m   );
+    auto Q2 = LockedView( Z, off+m, off+m, n-m, n-m );
+    auto U1 = LockedView( U, 0, 0, m,   n );
+    auto U2 = LockedView( U, m, 0, n-m, n );
+    auto ZTop    = View( Z, off,   off, m,   n );
+    auto ZBottom = View( Z, off+m, off, n-m, n );
+    DistMatrix<Real> QU1(g), QU2(g);
+    QU1.AlignWith( ZTop );
+    QU2.AlignWith( ZBottom );
+    Zeros( QU1, m, n );
+    Zeros( QU2, n-m, n );
+    Gemm( NORMAL, NORMAL, Real(1), Q1, U1, Real(0), QU1 );
+    Gemm( NORMAL, NORMAL, Real(1), Q2, U2, Real(0), QU2 );
+    ZTop = QU1;
+    ZBottom = QU2;
+}
+
+template<typename Real>
+inline void Recurse
+( std::vector<Real>& d, const std::vector<Real>& e,
+  Int off, Int n, DistMatrix<Real>& Z, Int cutoff )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag_eig::dc::Recurse"))
+    if( n <= cutoff )
+    {
+        Leaf( d, e, off, n, Z );
+        return;
+    }
+    const Int m = n/2;
+    const Real beta = e[off+m-1];
+    d[off+m-1] -= Abs(beta);
+    d[off+m]   -= Abs(beta);
+    Recurse( d, e, off,   m,   Z, cutoff );
+    Recurse( d, e, off+m, n-m, Z, cutoff );
+    Merge( d, off, m, n, beta, Z );
+}
+
+} // namespace dc
+
+// Compute the eigenpairs of the Hermitian tridiagonal matrix with diagonal d
+// and subdiagonal dSub via divide and conquer. The entire spectrum is always
+// computed, and the requested subset is extracted afterwards.
+template<typename F>
+inline void DivideAndConquer
+( const AbstractDistMatrix<Base<F>>& d,
+  const AbstractDistMatrix<F>& dSub,
+        AbstractDistMatrix<Base<F>>& w,
+        AbstractDistMatrix<F>& ZPre,
+  SortType sort, const HermitianEigSubset<Base<F>>& subset, Int cutoff )
+{
+    DEBUG_ONLY(CallStackEntry cse("herm_tridiag_eig::DivideAndConquer"))
+    typedef Base<F> Real;
+    const Int n = d.Height();
+    const Grid& g = d.Grid();
+
+    DistMatrix<Real,STAR,STAR> d_STAR_STAR(g);
+    DistMatrix<F,STAR,STAR> dSub_STAR_STAR(g);
+    Copy( d, d_STAR_STAR );
+    dSub_STAR_STAR.Resize( n-1, 1, n );
+    Copy( dSub, dSub_STAR_STAR );
+
+    // Move to the real symmetric tridiagonal matrix Y^H T Y, with the unitary
+    // diagonal matrix Y chosen so that the subdiagonal is nonnegative
+    std::vector<Real> dVec(n), e(n);
+    DistMatrix<F,STAR,STAR> y(n,1,g);
+    Real maxAbs = 0;
+    for( Int i=0; i<n; ++i )
+    {
+        dVec[i] = d_STAR_STAR.GetLocal(i,0);
+        maxAbs = Max( maxAbs, Abs(dVec[i]) );
+    }
+    if( n > 0 )
+        y.SetLocal( 0, 0, F(1) );
+    for( Int i=0; i<n-1; ++i )
+    {
+        const F psi = dSub_STAR_STAR.GetLocal(i,0);
+        const Real psiAbs = Abs(psi);
+        e[i] = psiAbs;
+        maxAbs = Max( maxAbs, psiAbs );
+        if( psiAbs == Real(0) )
+            y.SetLocal( i+1, 0, F(1) );
+        else
+            y.SetLocal( i+1, 0, psi*y.GetLocal(i,0)/psiAbs );
+    }
+
+    // Solve the scaled problem
+    DistMatrix<Real> ZReal(g);
+    if( maxAbs == Real(0) )
+        Identity( ZReal, n, n );
+    else
+    {
+        for( Int i=0; i<n; ++i )
+        {
+            dVec[i] /= maxAbs;
+            e[i] /= maxAbs;
+        }
+        Zeros( ZReal, n, n );
+        dc::Recurse( dVec, e, Int(0), n, ZReal, Max(cutoff,Int(1)) );
+        for( Int i=0; i<n; ++i )
+            dVec[i] *= maxAbs;
+    }
+
+    // Extract the requested subset of the (ascending) eigenpairs
+    Int jBeg=0, jEnd=n;
+    if( subset.indexSubset )
+    {
+        jBeg = Min( subset.lowerIndex, n );
+        jEnd = Min( subset.upperIndex+1, n );
+    }
+    else if( subset.rangeSubset )
+    {
+        while( jBeg < n && dVec[jBeg] <= subset.lowerBound )
+            ++jBeg;
+        jEnd = jBeg;
+        while( jEnd < n && dVec[jEnd] <= subset.upperBound )
+            ++jEnd;
+    }
+    const Int k = jEnd-jBeg;
+    DistMatrix<Real,STAR,STAR> w_STAR_STAR(k,1,g);
+    for( Int j=0; j<k; ++j )
+        w_STAR_STAR.SetLocal( j, 0, dVec[jBeg+j] );
+    Copy( w_STAR_STAR, w );
+
+    auto ZPtr = WriteProxy<F,MC,MR>( &ZPre );
+    auto& Z = *ZPtr;
+    Copy( LockedView( ZReal, 0, jBeg, n, k ), Z );
+    DiagonalScale( LEFT, NORMAL, y, Z );
+
+    herm_eig::Sort( w, Z, sort );
+}
+
+} // namespace herm_tridiag_eig
+} // namespace El
+
+#endif // ifndef EL_HERMITIANTRIDIAGEIG_DIVIDEANDCONQUER_HPP
@@ -14,6 +14,7 @@
 #include "./Pseudospectra/IRA.hpp"
 #include "./Pseudospectra/IRL.hpp"
 #include "./Pseudospectra/Analytic.hpp"
+#include "./Pseudospectra/Adaptive.hpp"
 
 // For one-norm pseudospectra. An adaptation of the more robust algorithm of
 // Higham and Tisseur will hopefully be implemented soon.
@@ -21,12 +22,15 @@
 
 namespace El {
 
+namespace pspec {
+
 template<typename F>
-Matrix<Int> TriangularSpectralCloud
+Matrix<Int> TriangularCloud
 ( const Matrix<F>& UPre, const Matrix<Complex<Base<F>>>& shifts, 
-  Matrix<Base<F>>& invNorms, PseudospecCtrl<Base<F>> psCtrl )
+  Matrix<Base<F>>& invNorms, PseudospecCtrl<Base<F>> psCtrl,
+  Matrix<Complex<Base<F>>>* warmVecs )
 {
-    DEBUG_ONLY(CallStackEntry cse("TriangularSpectralCloud"))
+    DEBUG_ONLY(CallStackEntry cse("pspec::TriangularCloud"))
     typedef Base<F> Real;
     typedef Complex<Real> C;
 
@@ -59,18 +63,29 @@ Matrix<Int> TriangularSpectralCloud
         if( psCtrl.arnoldi )
         {
             if( psCtrl.basisSize > 1 )
-                return pspec::IRA( U, shifts, invNorms, psCtrl );
+                return pspec::IRA( U, shifts, invNorms, psCtrl, warmVecs );
             else
-                return pspec::Lanczos( U, shifts, invNorms, psCtrl );
+                return pspec::Lanczos( U, shifts, invNorms, psCtrl, warmVecs );
         }
         else
-            return pspec::Power( U, shifts, invNorms, psCtrl );
+            return pspec::Power( U, shifts, invNorms, psCtrl, warmVecs );
     }
     else
         return pspec::HagerHigham( U, shifts, invNorms, psCtrl ); 
         // Q is assumed to be the identity
 }
 
+} // namespace pspec
+
+template<typename F>
+Matrix<Int> TriangularSpectralCloud
+( const Matrix<F>& U, const Matrix<Complex<Base<F>>>& shifts, 
+  Matrix<Base<F>>& invNorms, PseudospecCtrl<Base<F>> psCtrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("TriangularSpectralCloud"))
+    return pspec::TriangularCloud( U, shifts, invNorms, psCtrl, nullptr );
+}
+
 template<typename F>
 Matrix<Int> TriangularSpectralCloud
 ( const Matrix<F>& UPre, const Matrix<F>& QPre, 
@@ -191,12 +206,15 @@ Matrix<Int> QuasiTriangularSpectralCloud
     return pspec::IRA( U, shifts, invNorms, psCtrl );
 }
 
+namespace pspec {
+
 template<typename F>
-Matrix<Int> HessenbergSpectralCloud
+Matrix<Int> HessenbergCloud
 ( const Matrix<F>& HPre, const Matrix<Complex<Base<F>>>& shifts, 
-  Matrix<Base<F>>& invNorms, PseudospecCtrl<Base<F>> psCtrl )
+  Matrix<Base<F>>& invNorms, PseudospecCtrl<Base<F>> psCtrl,
+  Matrix<Complex<Base<F>>>* warmVecs )
 {
-    DEBUG_ONLY(CallStackEntry cse("pspec::HessenbergHelper"))
+    DEBUG_ONLY(CallStackEntry cse("pspec::HessenbergCloud"))
     typedef Base<F> Real;
     typedef Complex<Real> C;
 
@@ -212,18 +230,29 @@ Matrix<Int> HessenbergSpectralCloud
         if( psCtrl.arnoldi )
         {
             if( psCtrl.basisSize > 1 )
-                return pspec::IRA( H, shifts, invNorms, psCtrl );
+                return pspec::IRA( H, shifts, invNorms, psCtrl, warmVecs );
             else
-                return pspec::Lanczos( H, shifts, invNorms, psCtrl );
+                return pspec::Lanczos( H, shifts, invNorms, psCtrl, warmVecs );
         }
         else
-            return pspec::Power( H, shifts, invNorms, psCtrl );
+            return pspec::Power( H, shifts, invNorms, psCtrl, warmVecs );
     }
     else
         return pspec::HagerHigham( H, shifts, invNorms, psCtrl ); 
         // Q is assumed to be the identity
 }
 
+} // namespace pspec
+
+template<typename F>
+Matrix<Int> HessenbergSpectralCloud
+( const Matrix<F>& H, const Matrix<Complex<Base<F>>>& shifts, 
+  Matrix<Base<F>>& invNorms, PseudospecCtrl<Base<F>> psCtrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("HessenbergSpectralCloud"))
+    return pspec::HessenbergCloud( H, shifts, invNorms, psCtrl, nullptr );
+}
+
 template<typename F>
 Matrix<Int> HessenbergSpectralCloud
 ( const Matrix<F>& HPre, const Matrix<F>& QPre,
@@ -261,13 +290,16 @@ Matrix<Int> HessenbergSpectralCloud
     }
 }
 
+namespace pspec {
+
 template<typename F>
-DistMatrix<Int,VR,STAR> TriangularSpectralCloud
+DistMatrix<Int,VR,STAR> TriangularCloud
 ( const AbstractDistMatrix<F>& UPre, 
   const AbstractDistMatrix<Complex<Base<F>>>& shiftsPre,
-        AbstractDistMatrix<Base<F>>& invNorms, PseudospecCtrl<Base<F>> psCtrl )
+        AbstractDistMatrix<Base<F>>& invNorms, PseudospecCtrl<Base<F>> psCtrl,
+        AbstractDistMatrix<Complex<Base<F>>>* warmVecs )
 {
-    DEBUG_ONLY(CallStackEntry cse("TriangularSpectralCloud"))
+    DEBUG_ONLY(CallStackEntry cse("pspec::TriangularCloud"))
     typedef Base<F> Real;
     typedef Complex<Real> C;
     const Grid& g = UPre.Grid();
@@ -306,17 +338,29 @@ DistMatrix<Int,VR,STAR> TriangularSpectralCloud
         if( psCtrl.arnoldi )
         {
             if( psCtrl.basisSize > 1 )
-                return pspec::IRA( U, shifts, invNorms, psCtrl );
+                return pspec::IRA( U, shifts, invNorms, psCtrl, warmVecs );
             else
-                return pspec::Lanczos( U, shifts, invNorms, psCtrl );
+                return pspec::Lanczos( U, shifts, invNorms, psCtrl, warmVecs );
         }
         else
-            return pspec::Power( U, shifts, invNorms, psCtrl );
+            return pspec::Power( U, shifts, invNorms, psCtrl, warmVecs );
     }
     else
         return pspec::HagerHigham( U, shifts, invNorms, psCtrl );
 }
 
+} // namespace pspec
+
+template<typename F>
+DistMatrix<Int,VR,STAR> TriangularSpectralCloud
+( const AbstractDistMatrix<F>& U, 
+  const AbstractDistMatrix<Complex<Base<F>>>& shifts,
+        AbstractDistMatrix<Base<F>>& invNorms, PseudospecCtrl<Base<F>> psCtrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("TriangularSpectralCloud"))
+    return pspec::TriangularCloud( U, shifts, invNorms, psCtrl, nullptr );
+}
+
 template<typename F>
 DistMatrix<Int,VR,STAR> TriangularSpectralCloud
 ( const AbstractDistMatrix<F>& UPre, const AbstractDistMatrix<F>& QPre,
@@ -464,13 +508,16 @@ DistMatrix<Int,VR,STAR> QuasiTriangularSpectralCloud
     return pspec::IRA( U, shifts, invNorms, psCtrl );
 }
 
+namespace pspec {
+
 template<typename F>
-DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
+DistMatrix<Int,VR,STAR> HessenbergCloud
 ( const AbstractDistMatrix<F>& HPre, 
   const AbstractDistMatrix<Complex<Base<F>>>& shiftsPre,
-        AbstractDistMatrix<Base<F>>& invNorms, PseudospecCtrl<Base<F>> psCtrl )
+        AbstractDistMatrix<Base<F>>& invNorms, PseudospecCtrl<Base<F>> psCtrl,
+        AbstractDistMatrix<Complex<Base<F>>>* warmVecs )
 {
-    DEBUG_ONLY(CallStackEntry cse("HessenbergSpectralCloud"))
+    DEBUG_ONLY(CallStackEntry cse("pspec::HessenbergCloud"))
     typedef Base<F> Real;
     typedef Complex<Real> C;
 
@@ -490,17 +537,29 @@ DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
         if( psCtrl.arnoldi )
         {
             if( psCtrl.basisSize > 1 )
-                return pspec::IRA( H, shifts, invNorms, psCtrl );
+                return pspec::IRA( H, shifts, invNorms, psCtrl, warmVecs );
             else
-                return pspec::Lanczos( H, shifts, invNorms, psCtrl );
+                return pspec::Lanczos( H, shifts, invNorms, psCtrl, warmVecs );
         }
         else
-            return pspec::Power( H, shifts, invNorms, psCtrl );
+            return pspec::Power( H, shifts, invNorms, psCtrl, warmVecs );
     }
     else
         return pspec::HagerHigham( H, shifts, invNorms, psCtrl );
 }
 
+} // namespace pspec
+
+template<typename F>
+DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
+( const AbstractDistMatrix<F>& H, 
+  const AbstractDistMatrix<Complex<Base<F>>>& shifts,
+        AbstractDistMatrix<Base<F>>& invNorms, PseudospecCtrl<Base<F>> psCtrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("HessenbergSpectralCloud"))
+    return pspec::HessenbergCloud( H, shifts, invNorms, psCtrl, nullptr );
+}
+
 template<typename F>
 DistMatrix<Int,VR,STAR> HessenbergSpectralCloud
 ( const AbstractDistMatrix<F>& HPre, const AbstractDistMatrix<F>& QPre,
@@ -774,6 +833,21 @@ Matrix<Int> TriangularSpectralWindow
     psCtrl.snapCtrl.realSize = realSize;
     psCtrl.snapCtrl.imagSize = imagSize;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& ctrl, Matrix<C>* warmVecs )
+          {
+              return pspec::TriangularCloud
+                     ( U, shifts, invNorms, ctrl, warmVecs );
+          };
+        return pspec::AdaptiveWindow
+               ( invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl,
+                 pspec::TriangularEigenvalues( U ), cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -809,6 +883,26 @@ Matrix<Int> TriangularSpectralWindow
     psCtrl.snapCtrl.realSize = realSize;
     psCtrl.snapCtrl.imagSize = imagSize;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& ctrl, Matrix<C>* warmVecs )
+          {
+              // Q is only used by the one-norm, which is never warm-started
+              if( warmVecs == nullptr )
+                  return TriangularSpectralCloud
+                         ( U, Q, shifts, invNorms, ctrl );
+              else
+                  return pspec::TriangularCloud
+                         ( U, shifts, invNorms, ctrl, warmVecs );
+          };
+        return pspec::AdaptiveWindow
+               ( invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl,
+                 pspec::TriangularEigenvalues( U ), cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -843,6 +937,21 @@ Matrix<Int> QuasiTriangularSpectralWindow
     psCtrl.snapCtrl.realSize = realSize;
     psCtrl.snapCtrl.imagSize = imagSize;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& ctrl, Matrix<C>* )
+          {
+              return QuasiTriangularSpectralCloud
+                     ( U, shifts, invNorms, ctrl );
+          };
+        return pspec::AdaptiveWindow
+               ( invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl,
+                 pspec::QuasiTriangularEigenvalues( U ), cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -877,6 +986,21 @@ Matrix<Int> QuasiTriangularSpectralWindow
     psCtrl.snapCtrl.realSize = realSize;
     psCtrl.snapCtrl.imagSize = imagSize;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& ctrl, Matrix<C>* )
+          {
+              return QuasiTriangularSpectralCloud
+                     ( U, Q, shifts, invNorms, ctrl );
+          };
+        return pspec::AdaptiveWindow
+               ( invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl,
+                 pspec::QuasiTriangularEigenvalues( U ), cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -913,6 +1037,20 @@ Matrix<Int> HessenbergSpectralWindow
     psCtrl.snapCtrl.realSize = realSize;
     psCtrl.snapCtrl.imagSize = imagSize;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& ctrl, Matrix<C>* warmVecs )
+          {
+              return pspec::HessenbergCloud
+                     ( H, shifts, invNorms, ctrl, warmVecs );
+          };
+        return pspec::AdaptiveWindow
+               ( invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl, Matrix<C>(), cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -948,6 +1086,25 @@ Matrix<Int> HessenbergSpectralWindow
     psCtrl.snapCtrl.realSize = realSize;
     psCtrl.snapCtrl.imagSize = imagSize;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const Matrix<C>& shifts, Matrix<Real>& invNorms,
+               const PseudospecCtrl<Real>& ctrl, Matrix<C>* warmVecs )
+          {
+              // Q is only used by the one-norm, which is never warm-started
+              if( warmVecs == nullptr )
+                  return HessenbergSpectralCloud
+                         ( H, Q, shifts, invNorms, ctrl );
+              else
+                  return pspec::HessenbergCloud
+                         ( H, shifts, invNorms, ctrl, warmVecs );
+          };
+        return pspec::AdaptiveWindow
+               ( invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl, Matrix<C>(), cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -984,6 +1141,23 @@ DistMatrix<Int> TriangularSpectralWindow
     psCtrl.snapCtrl.realSize = realSize;
     psCtrl.snapCtrl.imagSize = imagSize;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shifts,
+                     DistMatrix<Real,VR,STAR>& invNorms,
+               const PseudospecCtrl<Real>& ctrl,
+                     AbstractDistMatrix<C>* warmVecs )
+          {
+              return pspec::TriangularCloud
+                     ( U, shifts, invNorms, ctrl, warmVecs );
+          };
+        return pspec::AdaptiveWindow
+               ( g, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl,
+                 pspec::TriangularEigenvalues( U ), cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -1024,6 +1198,28 @@ DistMatrix<Int> TriangularSpectralWindow
     psCtrl.snapCtrl.realSize = realSize;
     psCtrl.snapCtrl.imagSize = imagSize;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shifts,
+                     DistMatrix<Real,VR,STAR>& invNorms,
+               const PseudospecCtrl<Real>& ctrl,
+                     AbstractDistMatrix<C>* warmVecs )
+          {
+              // Q is only used by the one-norm, which is never warm-started
+              if( warmVecs == nullptr )
+                  return TriangularSpectralCloud
+                         ( U, Q, shifts, invNorms, ctrl );
+              else
+                  return pspec::TriangularCloud
+                         ( U, shifts, invNorms, ctrl, warmVecs );
+          };
+        return pspec::AdaptiveWindow
+               ( g, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl,
+                 pspec::TriangularEigenvalues( U ), cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -1062,6 +1258,23 @@ DistMatrix<Int> QuasiTriangularSpectralWindow
     psCtrl.snapCtrl.realSize = realSize;
     psCtrl.snapCtrl.imagSize = imagSize;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shifts,
+                     DistMatrix<Real,VR,STAR>& invNorms,
+               const PseudospecCtrl<Real>& ctrl,
+                     AbstractDistMatrix<C>* )
+          {
+              return QuasiTriangularSpectralCloud
+                     ( U, shifts, invNorms, ctrl );
+          };
+        return pspec::AdaptiveWindow
+               ( g, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl,
+                 pspec::QuasiTriangularEigenvalues( U ), cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -1101,6 +1314,23 @@ DistMatrix<Int> QuasiTriangularSpectralWindow
     psCtrl.snapCtrl.realSize = realSize;
     psCtrl.snapCtrl.imagSize = imagSize;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shifts,
+                     DistMatrix<Real,VR,STAR>& invNorms,
+               const PseudospecCtrl<Real>& ctrl,
+                     AbstractDistMatrix<C>* )
+          {
+              return QuasiTriangularSpectralCloud
+                     ( U, Q, shifts, invNorms, ctrl );
+          };
+        return pspec::AdaptiveWindow
+               ( g, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl,
+                 pspec::QuasiTriangularEigenvalues( U ), cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -1141,6 +1371,22 @@ DistMatrix<Int> HessenbergSpectralWindow
     psCtrl.snapCtrl.realSize = realSize;
     psCtrl.snapCtrl.imagSize = imagSize;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shifts,
+                     DistMatrix<Real,VR,STAR>& invNorms,
+               const PseudospecCtrl<Real>& ctrl,
+                     AbstractDistMatrix<C>* warmVecs )
+          {
+              return pspec::HessenbergCloud
+                     ( H, shifts, invNorms, ctrl, warmVecs );
+          };
+        return pspec::AdaptiveWindow
+               ( g, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl, Matrix<C>(), cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -1181,6 +1427,27 @@ DistMatrix<Int> HessenbergSpectralWindow
     psCtrl.snapCtrl.realSize = realSize;
     psCtrl.snapCtrl.imagSize = imagSize;
 
+    if( psCtrl.adaptive )
+    {
+        auto cloud =
+          [&]( const DistMatrix<C,VR,STAR>& shifts,
+                     DistMatrix<Real,VR,STAR>& invNorms,
+               const PseudospecCtrl<Real>& ctrl,
+                     AbstractDistMatrix<C>* warmVecs )
+          {
+              // Q is only used by the one-norm, which is never warm-started
+              if( warmVecs == nullptr )
+                  return HessenbergSpectralCloud
+                         ( H, Q, shifts, invNorms, ctrl );
+              else
+                  return pspec::HessenbergCloud
+                         ( H, shifts, invNorms, ctrl, warmVecs );
+          };
+        return pspec::AdaptiveWindow
+               ( g, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl, Matrix<C>(), cloud );
+    }
+
     const Real realStep = realWidth/realSize;
     const Real imagStep = imagWidth/imagSize;
     const C corner = center + C(-realWidth/2,imagWidth/2);
@@ -1206,78 +1473,305 @@ DistMatrix<Int> HessenbergSpectralWindow
     return itCountMap;
 }
 
-template<typename F>
-Matrix<Int> SpectralWindow
-( const Matrix<F>& A, Matrix<Base<F>>& invNormMap, 
-  Complex<Base<F>> center, Base<F> realWidth, Base<F> imagWidth,
-  Int realSize, Int imagSize, PseudospecCtrl<Base<F>> psCtrl )
+namespace pspec {
+
+// The forms into which a general matrix is reduced before its pseudospectra
+// are evaluated
+struct TriangularForm { };
+struct HessenbergForm { };
+struct QuasiTriangularForm { };
+
+// Reduce A to the (quasi-)triangular or Hessenberg form requested by psCtrl
+// and hand it to 'evaluate', along with the accumulated similarity
+// transformation Q if the norm is not the two-norm. 'evaluate' is called as
+// either evaluate(form,U,psCtrl) or evaluate(form,U,Q,psCtrl), where 'form'
+// is one of the above tags.
+template<typename Real,class Evaluator>
+typename Evaluator::result_type
+Reduce
+( const Matrix<Complex<Real>>& A, PseudospecCtrl<Real> psCtrl,
+  Evaluator evaluate )
 {
-    DEBUG_ONLY(CallStackEntry cse("SpectralWindow"))
-    typedef Base<F> Real;
+    DEBUG_ONLY(CallStackEntry cse("pspec::Reduce"))
     typedef Complex<Real> C;
 
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
+    Matrix<C> B( A );
+    if( psCtrl.norm == PS_TWO_NORM )
+    {
+        if( psCtrl.schur )
+        {
+            Matrix<C> w;
+            const bool fullTriangle = true;
+            Schur( B, w, fullTriangle, psCtrl.schurCtrl );
+            return evaluate( TriangularForm(), B, psCtrl );
+        }
+        else
+        {
+            hessenberg::ExplicitCondensed( UPPER, B );
+            return evaluate( HessenbergForm(), B, psCtrl );
+        }
+    }
+    else
+    {
+        Matrix<C> Q;
+        if( psCtrl.schur )
+        {
+            Matrix<C> w;
+            const bool fullTriangle = true;
+            Schur( B, w, Q, fullTriangle, psCtrl.schurCtrl );
+            return evaluate( TriangularForm(), B, Q, psCtrl );
+        }
+        else
+        {
+            Matrix<C> t;
+            Hessenberg( UPPER, B, t );
+            Identity( Q, B.Height(), B.Height() );
+            hessenberg::ApplyQ( LEFT, UPPER, NORMAL, B, t, Q );
+            return evaluate( HessenbergForm(), B, Q, psCtrl );
+        }
+    }
+}
 
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    Matrix<C> shifts( realSize*imagSize, 1 );
-    for( Int j=0; j<realSize*imagSize; ++j )
+template<typename Real,class Evaluator>
+typename Evaluator::result_type
+Reduce
+( const AbstractDistMatrix<Complex<Real>>& A, PseudospecCtrl<Real> psCtrl,
+  Evaluator evaluate )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::Reduce"))
+    typedef Complex<Real> C;
+    const Grid& g = A.Grid();
+    DistMatrix<C> B( A );
+
+    if( psCtrl.norm == PS_TWO_NORM )
     {
-        const Int x = j / imagSize;
-        const Int y = j % imagSize;
-        shifts.Set( j, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
+        if( psCtrl.schur )
+        {
+            DistMatrix<C,VR,STAR> w(g);
+            const bool fullTriangle = true;
+            Schur( B, w, fullTriangle, psCtrl.schurCtrl );
+            return evaluate( TriangularForm(), B, psCtrl );
+        }
+        else
+        {
+            hessenberg::ExplicitCondensed( UPPER, B );
+            return evaluate( HessenbergForm(), B, psCtrl );
+        }
     }
+    else
+    {
+        DistMatrix<C> Q(g);
+        if( psCtrl.schur )
+        {
+            DistMatrix<C,VR,STAR> w(g);
+            const bool fullTriangle = true;
+            Schur( B, w, Q, fullTriangle, psCtrl.schurCtrl );
+            return evaluate( TriangularForm(), B, Q, psCtrl );
+        }
+        else
+        {
+            DistMatrix<C,STAR,STAR> t(g);
+            Hessenberg( UPPER, B, t );
+            Identity( Q, B.Height(), B.Height() );
+            hessenberg::ApplyQ( LEFT, UPPER, NORMAL, B, t, Q );
+            return evaluate( HessenbergForm(), B, Q, psCtrl );
+        }
+    }
+}
 
-    // Form the vector of invNorms
-    Matrix<Real> invNorms;
-    auto itCounts = SpectralCloud( A, shifts, invNorms, psCtrl );
+template<typename Real,class Evaluator>
+typename Evaluator::result_type
+Reduce
+( const Matrix<Real>& A, PseudospecCtrl<Real> psCtrl, Evaluator evaluate )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::Reduce"))
+    typedef Complex<Real> C;
 
-    // Rearrange the vectors into grids
-    Matrix<Int> itCountMap; 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    if( psCtrl.forceComplexSchur )
+    {
+        Matrix<C> ACpx;
+        Copy( A, ACpx );
+        return Reduce( ACpx, psCtrl, evaluate );
+    }
+
+    if( !psCtrl.schur )
+        LogicError("Real Hessenberg algorithm not yet supported");
+    Matrix<Real> B( A );
+    Matrix<C> w;
+    const bool fullTriangle = true;
+    if( psCtrl.norm == PS_TWO_NORM )
+    {
+        Schur( B, w, fullTriangle, psCtrl.schurCtrl );
+        if( psCtrl.forceComplexPs )
+        {
+            Matrix<C> BCpx;
+            schur::RealToComplex( B, BCpx );
+            return evaluate( TriangularForm(), BCpx, psCtrl );
+        }
+        return evaluate( QuasiTriangularForm(), B, psCtrl );
+    }
+    else
+    {
+        Matrix<Real> Q;
+        Schur( B, w, Q, fullTriangle, psCtrl.schurCtrl );
+        if( psCtrl.forceComplexPs )
+        {
+            LogicError("Real to complex full Schur not yet supported");
+            /*
+            Matrix<C> BCpx, QCpx;
+            schur::RealToComplex( B, Q, BCpx, QCpx );
+            return evaluate( TriangularForm(), BCpx, QCpx, psCtrl );
+            */
+        }
+        return evaluate( QuasiTriangularForm(), B, Q, psCtrl );
+    }
 }
 
-template<typename F>
-DistMatrix<Int> SpectralWindow
-( const AbstractDistMatrix<F>& A, AbstractDistMatrix<Base<F>>& invNormMap, 
-  Complex<Base<F>> center, Base<F> realWidth, Base<F> imagWidth, 
-  Int realSize, Int imagSize, PseudospecCtrl<Base<F>> psCtrl )
+template<typename Real,class Evaluator>
+typename Evaluator::result_type
+Reduce
+( const AbstractDistMatrix<Real>& A, PseudospecCtrl<Real> psCtrl,
+  Evaluator evaluate )
 {
-    DEBUG_ONLY(CallStackEntry cse("SpectralWindow"))
-    typedef Base<F> Real;
+    DEBUG_ONLY(CallStackEntry cse("pspec::Reduce"))
     typedef Complex<Real> C;
     const Grid& g = A.Grid();
 
-    psCtrl.snapCtrl.realSize = realSize;
-    psCtrl.snapCtrl.imagSize = imagSize;
+    if( psCtrl.forceComplexSchur )
+    {
+        DistMatrix<C> ACpx(g);
+        Copy( A, ACpx );
+        return Reduce( ACpx, psCtrl, evaluate );
+    }
 
-    const Real realStep = realWidth/realSize;
-    const Real imagStep = imagWidth/imagSize;
-    const C corner = center + C(-realWidth/2,imagWidth/2);
-    DistMatrix<C,VR,STAR> shifts( realSize*imagSize, 1, g );
-    const Int numLocShifts = shifts.LocalHeight();
-    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
+    if( !psCtrl.schur )
+        LogicError("Real Hessenberg algorithm not yet supported");
+    DistMatrix<Real> B( A );
+
+    DistMatrix<C,VR,STAR> w(g);
+    const bool fullTriangle = true;
+    if( psCtrl.norm == PS_TWO_NORM )
     {
-        const Int i = shifts.GlobalRow(iLoc);
-        const Int x = i / imagSize;
-        const Int y = i % imagSize;
-        shifts.SetLocal
-        ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
+        Schur( B, w, fullTriangle, psCtrl.schurCtrl );
+        if( psCtrl.forceComplexPs )
+        {
+            DistMatrix<C> BCpx(g);
+            schur::RealToComplex( B, BCpx );
+            return evaluate( TriangularForm(), BCpx, psCtrl );
+        }
+        return evaluate( QuasiTriangularForm(), B, psCtrl );
+    }
+    else
+    {
+        DistMatrix<Real> Q(g);
+        Schur( B, w, Q, fullTriangle, psCtrl.schurCtrl );
+        if( psCtrl.forceComplexPs )
+        {
+            LogicError("Real to complex full Schur not yet supported");
+            /*
+            DistMatrix<C> BCpx(g), QCpx(g);
+            schur::RealToComplex( B, Q, BCpx, QCpx );
+            return evaluate( TriangularForm(), BCpx, QCpx, psCtrl );
+            */
+        }
+        return evaluate( QuasiTriangularForm(), B, Q, psCtrl );
     }
+}
 
-    // Form the vector of invNorms
-    DistMatrix<Real,VR,STAR> invNorms(g);
-    auto itCounts = SpectralCloud( A, shifts, invNorms, psCtrl );
+// Evaluate a spectral window of the reduced matrix
+template<typename Real,class MapType,class ItCountType>
+struct WindowEvaluator
+{
+    typedef ItCountType result_type;
+    MapType& invNormMap;
+    Complex<Real> center;
+    Real realWidth, imagWidth;
+    Int realSize, imagSize;
 
-    // Rearrange the vectors into grids
-    DistMatrix<Int> itCountMap(g); 
-    pspec::ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
-    pspec::ReshapeIntoGrid( realSize, imagSize, itCounts, itCountMap );
-    return itCountMap;
+    template<class UType>
+    result_type operator()
+    ( TriangularForm, const UType& U, PseudospecCtrl<Real> psCtrl )
+    {
+        return TriangularSpectralWindow
+               ( U, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl );
+    }
+
+    template<class UType,class QType>
+    result_type operator()
+    ( TriangularForm, const UType& U, const QType& Q,
+      PseudospecCtrl<Real> psCtrl )
+    {
+        return TriangularSpectralWindow
+               ( U, Q, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl );
+    }
+
+    template<class HType>
+    result_type operator()
+    ( HessenbergForm, const HType& H, PseudospecCtrl<Real> psCtrl )
+    {
+        return HessenbergSpectralWindow
+               ( H, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl );
+    }
+
+    template<class HType,class QType>
+    result_type operator()
+    ( HessenbergForm, const HType& H, const QType& Q,
+      PseudospecCtrl<Real> psCtrl )
+    {
+        return HessenbergSpectralWindow
+               ( H, Q, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl );
+    }
+
+    template<class UType>
+    result_type operator()
+    ( QuasiTriangularForm, const UType& U, PseudospecCtrl<Real> psCtrl )
+    {
+        return QuasiTriangularSpectralWindow
+               ( U, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl );
+    }
+
+    template<class UType,class QType>
+    result_type operator()
+    ( QuasiTriangularForm, const UType& U, const QType& Q,
+      PseudospecCtrl<Real> psCtrl )
+    {
+        return QuasiTriangularSpectralWindow
+               ( U, Q, invNormMap, center, realWidth, imagWidth,
+                 realSize, imagSize, psCtrl );
+    }
+};
+
+} // namespace pspec
+
+template<typename F>
+Matrix<Int> SpectralWindow
+( const Matrix<F>& A, Matrix<Base<F>>& invNormMap, 
+  Complex<Base<F>> center, Base<F> realWidth, Base<F> imagWidth,
+  Int realSize, Int imagSize, PseudospecCtrl<Base<F>> psCtrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("SpectralWindow"))
+    typedef Base<F> Real;
+    pspec::WindowEvaluator<Real,Matrix<Real>,Matrix<Int>>
+      evaluate{ invNormMap, center, realWidth, imagWidth, realSize, imagSize };
+    return pspec::Reduce( A, psCtrl, evaluate );
+}
+
+template<typename F>
+DistMatrix<Int> SpectralWindow
+( const AbstractDistMatrix<F>& A, AbstractDistMatrix<Base<F>>& invNormMap, 
+  Complex<Base<F>> center, Base<F> realWidth, Base<F> imagWidth, 
+  Int realSize, Int imagSize, PseudospecCtrl<Base<F>> psCtrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("SpectralWindow"))
+    typedef Base<F> Real;
+    pspec::WindowEvaluator<Real,AbstractDistMatrix<Real>,DistMatrix<Int>>
+      evaluate{ invNormMap, center, realWidth, imagWidth, realSize, imagSize };
+    return pspec::Reduce( A, psCtrl, evaluate );
 }
 
 template<typename F>
@@ -1790,211 +2284,65 @@ DistMatrix<Int> HessenbergSpectralPortrait
 
 namespace pspec {
 
-template<typename Real>
-Matrix<Int> Helper
-( const Matrix<Complex<Real>>& A, Matrix<Real>& invNormMap, 
-  Int realSize, Int imagSize, PseudospecCtrl<Real> psCtrl )
-{
-    DEBUG_ONLY(CallStackEntry cse("pspec::Helper"))
-    typedef Complex<Real> C;
-
-    Matrix<C> B( A );
-    if( psCtrl.norm == PS_TWO_NORM )
-    {
-        if( psCtrl.schur )
-        {
-            Matrix<C> w;
-            const bool fullTriangle = true;
-            Schur( B, w, fullTriangle, psCtrl.schurCtrl );
-            return TriangularSpectralPortrait
-                   ( B, invNormMap, realSize, imagSize, psCtrl );
-        }
-        else
-        {
-            hessenberg::ExplicitCondensed( UPPER, B );
-            return HessenbergSpectralPortrait
-                   ( B, invNormMap, realSize, imagSize, psCtrl );
-        }
-    }
-    else
-    {
-        Matrix<C> Q;
-        if( psCtrl.schur )
-        {
-            Matrix<C> w;
-            const bool fullTriangle = true;
-            Schur( B, w, Q, fullTriangle, psCtrl.schurCtrl );
-            return TriangularSpectralPortrait
-                   ( B, Q, invNormMap, realSize, imagSize, psCtrl );
-        }
-        else
-        {
-            Matrix<C> t;
-            Hessenberg( UPPER, B, t );
-            Identity( Q, B.Height(), B.Height() );
-            hessenberg::ApplyQ( LEFT, UPPER, NORMAL, B, t, Q );
-            return HessenbergSpectralPortrait
-                   ( B, Q, invNormMap, realSize, imagSize, psCtrl );
-        }
-    }
-}
-
-template<typename Real>
-DistMatrix<Int> Helper
-( const AbstractDistMatrix<Complex<Real>>& A, 
-        AbstractDistMatrix<Real>& invNormMap, 
-  Int realSize, Int imagSize, PseudospecCtrl<Real> psCtrl )
+// Evaluate a spectral portrait of the reduced matrix
+template<typename Real,class MapType,class ItCountType>
+struct PortraitEvaluator
 {
-    DEBUG_ONLY(CallStackEntry cse("pspec::Helper"))
-    typedef Complex<Real> C;
-    const Grid& g = A.Grid();
-    DistMatrix<C> B( A );
+    typedef ItCountType result_type;
+    MapType& invNormMap;
+    Int realSize, imagSize;
 
-    if( psCtrl.norm == PS_TWO_NORM )
-    {
-        if( psCtrl.schur )
-        {
-            DistMatrix<C,VR,STAR> w(g);
-            const bool fullTriangle = true;
-            Schur( B, w, fullTriangle, psCtrl.schurCtrl );
-            return TriangularSpectralPortrait
-                   ( B, invNormMap, realSize, imagSize, psCtrl );
-        }
-        else
-        {
-            hessenberg::ExplicitCondensed( UPPER, B );
-            return HessenbergSpectralPortrait
-                   ( B, invNormMap, realSize, imagSize, psCtrl );
-        }
-    }
-    else
+    template<class UType>
+    result_type operator()
+    ( TriangularForm, const UType& U, PseudospecCtrl<Real> psCtrl )
     {
-        DistMatrix<C> Q(g);
-        if( psCtrl.schur )
-        {
-            DistMatrix<C,VR,STAR> w(g);
-            const bool fullTriangle = true;
-            Schur( B, w, Q, fullTriangle, psCtrl.schurCtrl );
-            return TriangularSpectralPortrait
-                   ( B, Q, invNormMap, realSize, imagSize, psCtrl );
-        }
-        else
-        {
-            DistMatrix<C,STAR,STAR> t(g);
-            Hessenberg( UPPER, B, t );
-            Identity( Q, B.Height(), B.Height() );
-            hessenberg::ApplyQ( LEFT, UPPER, NORMAL, B, t, Q );
-            return HessenbergSpectralPortrait
-                   ( B, Q, invNormMap, realSize, imagSize, psCtrl );
-        }
+        return TriangularSpectralPortrait
+               ( U, invNormMap, realSize, imagSize, psCtrl );
     }
-}
-
-template<typename Real>
-Matrix<Int> Helper
-( const Matrix<Real>& A, Matrix<Real>& invNormMap, 
-  Int realSize, Int imagSize, PseudospecCtrl<Real> psCtrl )
-{
-    DEBUG_ONLY(CallStackEntry cse("pspec::Helper"))
-    typedef Complex<Real> C;
 
-    if( psCtrl.forceComplexSchur )
+    template<class UType,class QType>
+    result_type operator()
+    ( TriangularForm, const UType& U, const QType& Q,
+      PseudospecCtrl<Real> psCtrl )
     {
-        Matrix<C> ACpx;
-        Copy( A, ACpx );
-        return Helper( ACpx, invNormMap, realSize, imagSize, psCtrl );
+        return TriangularSpectralPortrait
+               ( U, Q, invNormMap, realSize, imagSize, psCtrl );
     }
 
-    if( !psCtrl.schur )
-        LogicError("Real Hessenberg algorithm not yet supported");
-    Matrix<Real> B( A );
-    Matrix<C> w;
-    const bool fullTriangle = true;
-    if( psCtrl.norm == PS_TWO_NORM )
+    template<class HType>
+    result_type operator()
+    ( HessenbergForm, const HType& H, PseudospecCtrl<Real> psCtrl )
     {
-        Schur( B, w, fullTriangle, psCtrl.schurCtrl );
-        if( psCtrl.forceComplexPs )
-        {
-            Matrix<C> BCpx;
-            schur::RealToComplex( B, BCpx );
-            return TriangularSpectralPortrait
-                   ( BCpx, invNormMap, realSize, imagSize, psCtrl );
-        }
-        return QuasiTriangularSpectralPortrait
-               ( B, invNormMap, realSize, imagSize, psCtrl );
-    }
-    else
-    {
-        Matrix<Real> Q;
-        Schur( B, w, Q, fullTriangle, psCtrl.schurCtrl );
-        if( psCtrl.forceComplexPs )
-        {
-            LogicError("Real to complex full Schur not yet supported");
-            /*
-            Matrix<C> BCpx, QCpx;
-            schur::RealToComplex( B, Q, BCpx, QCpx );
-            return TriangularSpectralPortrait
-                   ( BCpx, invNormMap, realSize, imagSize, psCtrl );
-            */
-        }
-        return QuasiTriangularSpectralPortrait
-               ( B, Q, invNormMap, realSize, imagSize, psCtrl );
+        return HessenbergSpectralPortrait
+               ( H, invNormMap, realSize, imagSize, psCtrl );
     }
-}
 
-template<typename Real>
-DistMatrix<Int> Helper
-( const AbstractDistMatrix<Real>& A, AbstractDistMatrix<Real>& invNormMap, 
-  Int realSize, Int imagSize, PseudospecCtrl<Real> psCtrl )
-{
-    DEBUG_ONLY(CallStackEntry cse("pspec::Helper"))
-    typedef Complex<Real> C;
-    const Grid& g = A.Grid();
-
-    if( psCtrl.forceComplexSchur )
+    template<class HType,class QType>
+    result_type operator()
+    ( HessenbergForm, const HType& H, const QType& Q,
+      PseudospecCtrl<Real> psCtrl )
     {
-        DistMatrix<C> ACpx(g);
-        Copy( A, ACpx );
-        return SpectralPortrait( ACpx, invNormMap, realSize, imagSize, psCtrl );
+        return HessenbergSpectralPortrait
+               ( H, Q, invNormMap, realSize, imagSize, psCtrl );
     }
 
-    if( !psCtrl.schur )
-        LogicError("Real Hessenberg algorithm not yet supported");
-    DistMatrix<Real> B( A );
-
-    DistMatrix<C,VR,STAR> w(g);
-    const bool fullTriangle = true;
-    if( psCtrl.norm == PS_TWO_NORM )
+    template<class UType>
+    result_type operator()
+    ( QuasiTriangularForm, const UType& U, PseudospecCtrl<Real> psCtrl )
     {
-        Schur( B, w, fullTriangle, psCtrl.schurCtrl );
-        if( psCtrl.forceComplexPs ) 
-        {
-            DistMatrix<C> BCpx(g);
-            schur::RealToComplex( B, BCpx );
-            return TriangularSpectralPortrait
-                   ( BCpx, invNormMap, realSize, imagSize, psCtrl );
-        }
         return QuasiTriangularSpectralPortrait
-               ( B, invNormMap, realSize, imagSize, psCtrl );
+               ( U, invNormMap, realSize, imagSize, psCtrl );
     }
-    else
+
+    template<class UType,class QType>
+    result_type operator()
+    ( QuasiTriangularForm, const UType& U, const QType& Q,
+      PseudospecCtrl<Real> psCtrl )
     {
-        DistMatrix<Real> Q(g); 
-        Schur( B, w, Q, fullTriangle, psCtrl.schurCtrl );
-        if( psCtrl.forceComplexPs ) 
-        {
-            LogicError("Real to complex full Schur not yet supported");
-            /*
-            DistMatrix<C> BCpx(g), QCpx(g);
-            schur::RealToComplex( B, Q, BCpx, QCpx );
-            return TriangularSpectralPortrait
-                   ( BCpx, QCpx, invNormMap, realSize, imagSize, psCtrl );
-            */
-        }
         return QuasiTriangularSpectralPortrait
-               ( B, Q, invNormMap, realSize, imagSize, psCtrl );
+               ( U, Q, invNormMap, realSize, imagSize, psCtrl );
     }
-}
+};
 
 } // namespace pspec
 
@@ -2004,7 +2352,10 @@ Matrix<Int> SpectralPortrait
   Int realSize, Int imagSize, PseudospecCtrl<Base<F>> psCtrl )
 {
     DEBUG_ONLY(CallStackEntry cse("SpectralPortrait"))
-    return pspec::Helper( A, invNormMap, realSize, imagSize, psCtrl );
+    typedef Base<F> Real;
+    pspec::PortraitEvaluator<Real,Matrix<Real>,Matrix<Int>>
+      evaluate{ invNormMap, realSize, imagSize };
+    return pspec::Reduce( A, psCtrl, evaluate );
 }
 
 template<typename F>
@@ -2013,7 +2364,10 @@ DistMatrix<Int> SpectralPortrait
   Int realSize, Int imagSize, PseudospecCtrl<Base<F>> psCtrl )
 {
     DEBUG_ONLY(CallStackEntry cse("SpectralPortrait"))
-    return pspec::Helper( A, invNormMap, realSize, imagSize, psCtrl );
+    typedef Base<F> Real;
+    pspec::PortraitEvaluator<Real,AbstractDistMatrix<Real>,DistMatrix<Int>>
+      evaluate{ invNormMap, realSize, imagSize };
+    return pspec::Reduce( A, psCtrl, evaluate );
 }
 
 #define PROTO(F) \
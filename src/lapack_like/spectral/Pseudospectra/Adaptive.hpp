@@ -0,0 +1,692 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_PSEUDOSPECTRA_ADAPTIVE_HPP
+#define EL_PSEUDOSPECTRA_ADAPTIVE_HPP
+
+namespace El {
+namespace pspec {
+
+// Adaptive refinement of a spectral window
+// ========================================
+// Rather than evaluating the resolvent norm at every shift of a
+// realSize x imagSize window, the shifts are first sampled on a lattice with
+// a stride of 2^coarseLevels in each direction (the last row and column are
+// always included). Each cell of the lattice is only split in half (in each
+// direction) if one of the requested contours passes between the estimates
+// at its corners; otherwise its interior is filled by bilinear interpolation
+// of the logarithms of the corner estimates. Since the resolvent norm is
+// unbounded at the eigenvalues, any cell containing a known eigenvalue is also
+// split, as its corners need not reveal the contours surrounding it. All of
+// the new shifts of each level are evaluated as a single batch so that the
+// multi-shift solves remain efficient.
+
+struct AdaptiveCell
+{
+    Int x0, x1, y0, y1;
+};
+
+// The samples of {0,1,...,size-1} which are multiples of the stride, along
+// with the last index
+inline std::vector<Int> AdaptiveLattice( Int size, Int stride )
+{
+    std::vector<Int> lattice;
+    for( Int x=0; x<size; x+=stride )
+        lattice.push_back( x );
+    if( lattice.back() != size-1 )
+        lattice.push_back( size-1 );
+    return lattice;
+}
+
+// The intervals between consecutive lattice points (a single point is
+// treated as a degenerate interval)
+inline std::vector<std::pair<Int,Int>>
+AdaptiveIntervals( const std::vector<Int>& lattice )
+{
+    std::vector<std::pair<Int,Int>> intervals;
+    if( lattice.size() == 1 )
+        intervals.push_back( std::make_pair(lattice[0],lattice[0]) );
+    for( Int k=0; k<Int(lattice.size())-1; ++k )
+        intervals.push_back( std::make_pair(lattice[k],lattice[k+1]) );
+    return intervals;
+}
+
+// Whether or not one of the contours separates the smallest and largest
+// resolvent norm estimates of a cell. Contours are specified by the value of
+// epsilon (the norm of the resolvent is 1/epsilon along them); if none are
+// given, every integer power of ten is used.
+template<typename Real>
+inline bool CrossesContour
+( Real minEst, Real maxEst, const std::vector<Real>& contourLevels )
+{
+    if( std::isnan(minEst) || std::isnan(maxEst) || minEst <= Real(0) )
+        return true;
+    if( contourLevels.size() == 0 )
+        return std::floor(std::log10(minEst)) !=
+               std::floor(std::log10(maxEst));
+    for( auto epsilon : contourLevels )
+    {
+        const Real level = Real(1)/epsilon;
+        if( minEst < level && level <= maxEst )
+            return true;
+    }
+    return false;
+}
+
+// Count the eigenvalues lying within each unit cell of the window (the cell
+// with lower-left shift index (x,y) spans to (x+1,y+1)) and return the
+// two-dimensional prefix sums, so that the number of eigenvalues within any
+// cell may be queried in constant time
+template<typename Real>
+inline std::vector<Int>
+EigenvalueCounts
+( const Matrix<Complex<Real>>& w, Complex<Real> corner,
+  Real realStep, Real imagStep, Int realSize, Int imagSize )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::EigenvalueCounts"))
+    std::vector<Int> counts( (realSize+1)*(imagSize+1), 0 );
+    for( Int k=0; k<w.Height(); ++k )
+    {
+        const Complex<Real> lambda = w.Get(k,0);
+        const Real x = (RealPart(lambda)-RealPart(corner))/realStep - Real(0.5);
+        const Real y = (ImagPart(corner)-ImagPart(lambda))/imagStep - Real(0.5);
+        if( !(x >= Real(-0.5) && x <= realSize-Real(0.5) &&
+              y >= Real(-0.5) && y <= imagSize-Real(0.5)) )
+            continue;
+        const Int xCell =
+          Min(Max(Int(std::floor(x)),Int(0)),Max(realSize-2,Int(0)));
+        const Int yCell =
+          Min(Max(Int(std::floor(y)),Int(0)),Max(imagSize-2,Int(0)));
+        ++counts[(xCell+1)*(imagSize+1)+(yCell+1)];
+    }
+    for( Int x=1; x<=realSize; ++x )
+        for( Int y=1; y<=imagSize; ++y )
+            counts[x*(imagSize+1)+y] += counts[(x-1)*(imagSize+1)+y] +
+                                        counts[x*(imagSize+1)+(y-1)] -
+                                        counts[(x-1)*(imagSize+1)+(y-1)];
+    return counts;
+}
+
+inline bool ContainsEigenvalue
+( const AdaptiveCell& cell, const std::vector<Int>& eigCounts, Int imagSize )
+{
+    if( eigCounts.size() == 0 )
+        return false;
+    const Int xEnd = Max(cell.x0,cell.x1-1)+1;
+    const Int yEnd = Max(cell.y0,cell.y1-1)+1;
+    const Int stride = imagSize+1;
+    return eigCounts[xEnd*stride+yEnd] - eigCounts[cell.x0*stride+yEnd] -
+           eigCounts[xEnd*stride+cell.y0] +
+           eigCounts[cell.x0*stride+cell.y0] > 0;
+}
+
+// 'evaluate' is called with a list of shift indices (x*imagSize+y) and, for
+// each, the index of an already evaluated neighbor (or -1); it must fill in
+// the estimates and iteration counts of the new shifts on every process.
+// Since neighbors are always corners of an active cell which is still to be
+// split, 'retire' is called after each level with the evaluated shifts which
+// are no longer such a corner, so that any vectors kept for warm starts may be
+// released.
+template<typename Real,class Evaluator,class Retirer>
+inline void
+AdaptiveRefinement
+( Int realSize, Int imagSize, const PseudospecCtrl<Real>& psCtrl,
+  const std::vector<Int>& eigCounts,
+  std::vector<Real>& estimates, std::vector<Int>& itCounts,
+  Evaluator evaluate, Retirer retire, bool print )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::AdaptiveRefinement"))
+    const Int numShifts = realSize*imagSize;
+    const Int coarseLevels = Min(Max(psCtrl.coarseLevels,Int(0)),Int(30));
+    Int stride = Int(1) << coarseLevels;
+    while( stride > 1 && stride/2 >= Max(realSize,imagSize) )
+        stride /= 2;
+
+    estimates.resize( numShifts );
+    itCounts.resize( numShifts );
+    std::vector<bool> evaluated( numShifts, false );
+    Int numEvaluated = 0;
+    Timer timer, levelTimer;
+    timer.Start();
+
+    // Evaluate the coarsest lattice from scratch
+    const auto xLattice = AdaptiveLattice( realSize, stride );
+    const auto yLattice = AdaptiveLattice( imagSize, stride );
+    std::vector<Int> indices, sources;
+    for( auto x : xLattice )
+        for( auto y : yLattice )
+        {
+            indices.push_back( x*imagSize+y );
+            sources.push_back( -1 );
+        }
+    levelTimer.Start();
+    evaluate( indices, sources );
+    const double coarseTime = levelTimer.Stop();
+    const Int numCoarse = indices.size();
+    for( auto i : indices )
+        evaluated[i] = true;
+    numEvaluated += numCoarse;
+    if( print )
+        std::cout << "  stride " << stride << ": " << numCoarse
+                  << " shifts in " << coarseTime << " seconds" << std::endl;
+
+    std::vector<AdaptiveCell> active, finished;
+    for( auto xInt : AdaptiveIntervals(xLattice) )
+        for( auto yInt : AdaptiveIntervals(yLattice) )
+            active.push_back
+            ( AdaptiveCell{xInt.first,xInt.second,yInt.first,yInt.second} );
+
+    // The evaluated shifts which may still warm-start a neighbor
+    std::vector<Int> live( indices );
+    std::vector<bool> isCorner( numShifts, false );
+
+    std::vector<bool> queued( numShifts, false );
+    while( active.size() != 0 )
+    {
+        const Int halfStride = stride/2;
+        std::vector<AdaptiveCell> children;
+        indices.resize( 0 );
+        sources.resize( 0 );
+        for( const auto& cell : active )
+        {
+            const Int corners[4] =
+            { cell.x0*imagSize+cell.y0, cell.x0*imagSize+cell.y1,
+              cell.x1*imagSize+cell.y0, cell.x1*imagSize+cell.y1 };
+            Real minEst=estimates[corners[0]], maxEst=estimates[corners[0]];
+            for( Int k=1; k<4; ++k )
+            {
+                minEst = Min( minEst, estimates[corners[k]] );
+                maxEst = Max( maxEst, estimates[corners[k]] );
+            }
+            if( !CrossesContour( minEst, maxEst, psCtrl.contourLevels ) &&
+                !ContainsEigenvalue( cell, eigCounts, imagSize ) )
+            {
+                finished.push_back( cell );
+                continue;
+            }
+            if( halfStride == 0 )
+                continue;
+
+            // Split the crossing cell at the next finer lattice
+            std::vector<Int> xs(1,cell.x0), ys(1,cell.y0);
+            if( cell.x0+halfStride < cell.x1 )
+                xs.push_back( cell.x0+halfStride );
+            if( cell.x1 != cell.x0 )
+                xs.push_back( cell.x1 );
+            if( cell.y0+halfStride < cell.y1 )
+                ys.push_back( cell.y0+halfStride );
+            if( cell.y1 != cell.y0 )
+                ys.push_back( cell.y1 );
+            for( auto x : xs )
+            {
+                for( auto y : ys )
+                {
+                    const Int i = x*imagSize + y;
+                    if( evaluated[i] || queued[i] )
+                        continue;
+                    queued[i] = true;
+                    indices.push_back( i );
+                    // Warm-start from the nearest corner of the parent cell
+                    const Int xNear =
+                      ( x-cell.x0 <= cell.x1-x ? cell.x0 : cell.x1 );
+                    const Int yNear =
+                      ( y-cell.y0 <= cell.y1-y ? cell.y0 : cell.y1 );
+                    sources.push_back( xNear*imagSize+yNear );
+                }
+            }
+            for( Int kx=0; kx<Max(Int(xs.size())-1,Int(1)); ++kx )
+            {
+                const Int x0 = xs[kx];
+                const Int x1 = ( xs.size() > 1 ? xs[kx+1] : x0 );
+                for( Int ky=0; ky<Max(Int(ys.size())-1,Int(1)); ++ky )
+                {
+                    const Int y0 = ys[ky];
+                    const Int y1 = ( ys.size() > 1 ? ys[ky+1] : y0 );
+                    children.push_back( AdaptiveCell{x0,x1,y0,y1} );
+                }
+            }
+        }
+        if( halfStride == 0 )
+            break;
+
+        if( indices.size() != 0 )
+        {
+            levelTimer.Start();
+            evaluate( indices, sources );
+            const double levelTime = levelTimer.Stop();
+            for( auto i : indices )
+                evaluated[i] = true;
+            numEvaluated += indices.size();
+            live.insert( live.end(), indices.begin(), indices.end() );
+            if( print )
+                std::cout << "  stride " << halfStride << ": "
+                          << indices.size() << " shifts in " << levelTime
+                          << " seconds" << std::endl;
+        }
+        active = children;
+        stride = halfStride;
+
+        // Cells of unit stride are never split, and so their corners will
+        // not warm-start any further shifts
+        const Int numParents = ( stride > 1 ? active.size() : 0 );
+        for( Int c=0; c<numParents; ++c )
+        {
+            const auto& cell = active[c];
+            isCorner[cell.x0*imagSize+cell.y0] = true;
+            isCorner[cell.x0*imagSize+cell.y1] = true;
+            isCorner[cell.x1*imagSize+cell.y0] = true;
+            isCorner[cell.x1*imagSize+cell.y1] = true;
+        }
+        std::vector<Int> stillLive, retired;
+        for( auto i : live )
+        {
+            if( isCorner[i] )
+                stillLive.push_back( i );
+            else
+                retired.push_back( i );
+        }
+        for( Int c=0; c<numParents; ++c )
+        {
+            const auto& cell = active[c];
+            isCorner[cell.x0*imagSize+cell.y0] = false;
+            isCorner[cell.x0*imagSize+cell.y1] = false;
+            isCorner[cell.x1*imagSize+cell.y0] = false;
+            isCorner[cell.x1*imagSize+cell.y1] = false;
+        }
+        live.swap( stillLive );
+        if( retired.size() != 0 )
+            retire( retired );
+    }
+
+    // Interpolate the remaining shifts from the corners of the finest cell
+    // which contains them
+    for( Int c=finished.size()-1; c>=0; --c )
+    {
+        const auto& cell = finished[c];
+        const Real est00 = Log(estimates[cell.x0*imagSize+cell.y0]);
+        const Real est01 = Log(estimates[cell.x0*imagSize+cell.y1]);
+        const Real est10 = Log(estimates[cell.x1*imagSize+cell.y0]);
+        const Real est11 = Log(estimates[cell.x1*imagSize+cell.y1]);
+        for( Int x=cell.x0; x<=cell.x1; ++x )
+        {
+            const Real s =
+              ( cell.x1 > cell.x0 ? Real(x-cell.x0)/(cell.x1-cell.x0) : 0 );
+            for( Int y=cell.y0; y<=cell.y1; ++y )
+            {
+                const Int i = x*imagSize + y;
+                if( evaluated[i] )
+                    continue;
+                const Real t =
+                  ( cell.y1 > cell.y0 ? Real(y-cell.y0)/(cell.y1-cell.y0) : 0 );
+                const Real logEst = (1-s)*((1-t)*est00+t*est01) +
+                                       s *((1-t)*est10+t*est11);
+                estimates[i] = Exp(logEst);
+                itCounts[i] = 0;
+                evaluated[i] = true;
+            }
+        }
+    }
+
+    const double totalTime = timer.Stop();
+    if( print )
+    {
+        // The coarse lattice was evaluated from scratch, and so its cost per
+        // shift is used to estimate that of the uniform grid
+        const double uniformTime = coarseTime*numShifts/numCoarse;
+        std::cout << "Adaptive refinement evaluated " << numEvaluated
+                  << " of " << numShifts << " shifts (saving "
+                  << numShifts-numEvaluated << ") in " << totalTime
+                  << " seconds; the uniform grid would take roughly "
+                  << uniformTime << " seconds (saving about "
+                  << uniformTime-totalTime << " seconds)" << std::endl;
+    }
+}
+
+// Copy the given columns of a batch of warm-start vectors into a new batch
+template<typename F>
+inline Matrix<F>
+CompactColumns( const Matrix<F>& A, const std::vector<Int>& cols )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::CompactColumns"))
+    const Int height = A.Height();
+    const Int width = cols.size();
+    Matrix<F> B( height, width );
+    for( Int k=0; k<width; ++k )
+        MemCopy( B.Buffer(0,k), A.LockedBuffer(0,cols[k]), height );
+    return B;
+}
+
+template<typename F>
+inline DistMatrix<F,MC,STAR>
+CompactColumns( const DistMatrix<F,MC,STAR>& A, const std::vector<Int>& cols )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::CompactColumns"))
+    const Int localHeight = A.LocalHeight();
+    const Int width = cols.size();
+    DistMatrix<F,MC,STAR> B( A.Grid() );
+    B.AlignWith( A );
+    B.Resize( A.Height(), width );
+    for( Int k=0; k<width; ++k )
+        MemCopy
+        ( B.Buffer(0,k), A.LockedBuffer(0,cols[k]), localHeight );
+    return B;
+}
+
+// Release the warm-start vectors of the retired shifts. Each batch which lost
+// columns is compacted to those which are still referenced (or emptied), and
+// the locations of the surviving vectors are updated.
+template<class BatchMatrix>
+inline void
+RetireVectors
+( const std::vector<Int>& retired,
+  std::vector<BatchMatrix>& batchVecs,
+  std::vector<std::vector<Int>>& batchShifts,
+  std::vector<Int>& vecBatch, std::vector<Int>& vecCol )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::RetireVectors"))
+    std::vector<Int> touched;
+    for( auto i : retired )
+    {
+        const Int b = vecBatch[i];
+        if( b < 0 )
+            continue;
+        touched.push_back( b );
+        vecBatch[i] = -1;
+        vecCol[i] = -1;
+    }
+    std::sort( touched.begin(), touched.end() );
+    touched.erase
+    ( std::unique(touched.begin(),touched.end()), touched.end() );
+    for( auto b : touched )
+    {
+        std::vector<Int> keptShifts, keptCols;
+        for( auto i : batchShifts[b] )
+        {
+            if( vecBatch[i] == b )
+            {
+                keptShifts.push_back( i );
+                keptCols.push_back( vecCol[i] );
+            }
+        }
+        if( keptShifts.size() == 0 )
+            batchVecs[b].Empty();
+        else
+            batchVecs[b] = CompactColumns( batchVecs[b], keptCols );
+        for( Int k=0; k<Int(keptShifts.size()); ++k )
+            vecCol[keptShifts[k]] = k;
+        batchShifts[b].swap( keptShifts );
+    }
+}
+
+// The (redundantly stored) eigenvalues of a triangular or quasi-triangular
+// matrix, which are used to guide the refinement
+template<typename F>
+inline Matrix<Complex<Base<F>>> TriangularEigenvalues( const Matrix<F>& U )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::TriangularEigenvalues"))
+    const auto d = U.GetDiagonal();
+    Matrix<Complex<Base<F>>> w( d.Height(), 1 );
+    for( Int k=0; k<d.Height(); ++k )
+        w.Set( k, 0, d.Get(k,0) );
+    return w;
+}
+
+template<typename F>
+inline Matrix<Complex<Base<F>>>
+TriangularEigenvalues( const AbstractDistMatrix<F>& UPre )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::TriangularEigenvalues"))
+    auto UPtr = ReadProxy<F,MC,MR>( &UPre );
+    auto& U = *UPtr;
+    DistMatrix<F,STAR,STAR> d( U.GetDiagonal() );
+    return TriangularEigenvalues( d.Matrix() );
+}
+
+template<typename Real>
+inline Matrix<Complex<Real>> QuasiTriangularEigenvalues( const Matrix<Real>& U )
+{ return schur::QuasiTriangEig( U ); }
+
+template<typename Real>
+inline Matrix<Complex<Real>>
+QuasiTriangularEigenvalues( const AbstractDistMatrix<Real>& U )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::QuasiTriangularEigenvalues"))
+    DistMatrix<Complex<Real>,STAR,STAR> w( schur::QuasiTriangEig( U ) );
+    return w.Matrix();
+}
+
+// Evaluate a spectral window through adaptive refinement; 'w' should contain
+// any known eigenvalues (it may be empty), and 'cloud' is used to evaluate
+// each batch of shifts, optionally warm-starting from the given vectors
+template<typename Real,class CloudFunc>
+inline Matrix<Int>
+AdaptiveWindow
+( Matrix<Real>& invNormMap,
+  Complex<Real> center, Real realWidth, Real imagWidth,
+  Int realSize, Int imagSize, PseudospecCtrl<Real> psCtrl,
+  const Matrix<Complex<Real>>& w, CloudFunc cloud )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::AdaptiveWindow"))
+    typedef Complex<Real> C;
+    const Int numShifts = realSize*imagSize;
+    const Real realStep = realWidth/realSize;
+    const Real imagStep = imagWidth/imagSize;
+    const C corner = center + C(-realWidth/2,imagWidth/2);
+
+    // Only the final estimates are snapshotted
+    SnapshotCtrl snapCtrl = psCtrl.snapCtrl;
+    snapCtrl.realSize = realSize;
+    snapCtrl.imagSize = imagSize;
+    psCtrl.snapCtrl = SnapshotCtrl();
+    const bool warmStart = psCtrl.warmStart && psCtrl.norm == PS_TWO_NORM;
+
+    // The final vectors of each batch of shifts, the shifts whose vectors are
+    // still kept in each batch, and the location of the vector of each shift.
+    // Vectors are released once their shifts can no longer warm-start another.
+    std::vector<Matrix<C>> batchVecs;
+    std::vector<std::vector<Int>> batchShifts;
+    std::vector<Int> vecBatch( numShifts, -1 ), vecCol( numShifts, -1 );
+    Int vecHeight = -1;
+
+    std::vector<Real> estimates( numShifts );
+    std::vector<Int> itCounts( numShifts );
+
+    auto evaluate =
+      [&]( const std::vector<Int>& indices, const std::vector<Int>& sources )
+      {
+          const Int numNew = indices.size();
+          Matrix<C> shifts( numNew, 1 );
+          for( Int k=0; k<numNew; ++k )
+          {
+              const Int x = indices[k] / imagSize;
+              const Int y = indices[k] % imagSize;
+              shifts.Set
+              ( k, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
+          }
+
+          // Zero columns are replaced with random vectors
+          Matrix<C> X;
+          if( warmStart && vecHeight >= 0 )
+          {
+              Zeros( X, vecHeight, numNew );
+              for( Int k=0; k<numNew; ++k )
+              {
+                  const Int source = sources[k];
+                  if( source >= 0 && vecBatch[source] >= 0 )
+                      MemCopy
+                      ( X.Buffer(0,k),
+                        batchVecs[vecBatch[source]].LockedBuffer
+                        (0,vecCol[source]), vecHeight );
+              }
+          }
+
+          Matrix<Real> invNorms;
+          auto batchItCounts =
+            cloud( shifts, invNorms, psCtrl, ( warmStart ? &X : nullptr ) );
+          for( Int k=0; k<numNew; ++k )
+          {
+              estimates[indices[k]] = invNorms.Get(k,0);
+              itCounts[indices[k]] = batchItCounts.Get(k,0);
+          }
+          if( warmStart && X.Width() == numNew && X.Height() != 0 )
+          {
+              for( Int k=0; k<numNew; ++k )
+              {
+                  vecBatch[indices[k]] = batchVecs.size();
+                  vecCol[indices[k]] = k;
+              }
+              vecHeight = X.Height();
+              batchVecs.push_back( X );
+              batchShifts.push_back( indices );
+          }
+      };
+    auto retire =
+      [&]( const std::vector<Int>& retired )
+      { RetireVectors( retired, batchVecs, batchShifts, vecBatch, vecCol ); };
+    const auto eigCounts =
+      EigenvalueCounts( w, corner, realStep, imagStep, realSize, imagSize );
+    AdaptiveRefinement
+    ( realSize, imagSize, psCtrl, eigCounts, estimates, itCounts, evaluate,
+      retire, psCtrl.progress );
+
+    Matrix<Real> invNorms( numShifts, 1 );
+    Matrix<Int> itCountVec( numShifts, 1 );
+    for( Int i=0; i<numShifts; ++i )
+    {
+        invNorms.Set( i, 0, estimates[i] );
+        itCountVec.Set( i, 0, itCounts[i] );
+    }
+    FinalSnapshot( invNorms, itCountVec, snapCtrl );
+
+    Matrix<Int> itCountMap;
+    ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
+    ReshapeIntoGrid( realSize, imagSize, itCountVec, itCountMap );
+    return itCountMap;
+}
+
+template<typename Real,class CloudFunc>
+inline DistMatrix<Int>
+AdaptiveWindow
+( const Grid& g, AbstractDistMatrix<Real>& invNormMap,
+  Complex<Real> center, Real realWidth, Real imagWidth,
+  Int realSize, Int imagSize, PseudospecCtrl<Real> psCtrl,
+  const Matrix<Complex<Real>>& w, CloudFunc cloud )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::AdaptiveWindow"))
+    typedef Complex<Real> C;
+    const Int numShifts = realSize*imagSize;
+    const Real realStep = realWidth/realSize;
+    const Real imagStep = imagWidth/imagSize;
+    const C corner = center + C(-realWidth/2,imagWidth/2);
+
+    // Only the final estimates are snapshotted
+    SnapshotCtrl snapCtrl = psCtrl.snapCtrl;
+    snapCtrl.realSize = realSize;
+    snapCtrl.imagSize = imagSize;
+    psCtrl.snapCtrl = SnapshotCtrl();
+    const bool warmStart = psCtrl.warmStart && psCtrl.norm == PS_TWO_NORM;
+
+    // The final vectors of each batch of shifts (with their rows distributed
+    // like those of the iterates), the shifts whose vectors are still kept in
+    // each batch, and the location of the vector of each shift. Vectors are
+    // released once their shifts can no longer warm-start another.
+    std::vector<DistMatrix<C,MC,STAR>> batchVecs;
+    std::vector<std::vector<Int>> batchShifts;
+    std::vector<Int> vecBatch( numShifts, -1 ), vecCol( numShifts, -1 );
+    Int vecHeight = -1, vecAlign = 0;
+
+    std::vector<Real> estimates( numShifts );
+    std::vector<Int> itCounts( numShifts );
+
+    auto evaluate =
+      [&]( const std::vector<Int>& indices, const std::vector<Int>& sources )
+      {
+          const Int numNew = indices.size();
+          DistMatrix<C,VR,STAR> shifts( numNew, 1, g );
+          const Int numLocShifts = shifts.LocalHeight();
+          for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
+          {
+              const Int i = indices[shifts.GlobalRow(iLoc)];
+              const Int x = i / imagSize;
+              const Int y = i % imagSize;
+              shifts.SetLocal
+              ( iLoc, 0, corner+C((x+0.5)*realStep,-(y+0.5)*imagStep) );
+          }
+
+          // Zero columns are replaced with random vectors
+          DistMatrix<C,MC,STAR> X(g);
+          if( warmStart && vecHeight >= 0 )
+          {
+              X.AlignCols( vecAlign );
+              Zeros( X, vecHeight, numNew );
+              const Int localHeight = X.LocalHeight();
+              for( Int k=0; k<numNew; ++k )
+              {
+                  const Int source = sources[k];
+                  if( source >= 0 && vecBatch[source] >= 0 )
+                      MemCopy
+                      ( X.Buffer(0,k),
+                        batchVecs[vecBatch[source]].LockedBuffer
+                        (0,vecCol[source]), localHeight );
+              }
+          }
+
+          DistMatrix<Real,VR,STAR> invNorms(g);
+          auto batchItCounts =
+            cloud( shifts, invNorms, psCtrl, ( warmStart ? &X : nullptr ) );
+          DistMatrix<Real,STAR,STAR> invNorms_STAR_STAR( invNorms );
+          DistMatrix<Int,STAR,STAR> itCounts_STAR_STAR( batchItCounts );
+          for( Int k=0; k<numNew; ++k )
+          {
+              estimates[indices[k]] = invNorms_STAR_STAR.GetLocal(k,0);
+              itCounts[indices[k]] = itCounts_STAR_STAR.GetLocal(k,0);
+          }
+          if( warmStart && X.Width() == numNew && X.Height() != 0 )
+          {
+              for( Int k=0; k<numNew; ++k )
+              {
+                  vecBatch[indices[k]] = batchVecs.size();
+                  vecCol[indices[k]] = k;
+              }
+              vecHeight = X.Height();
+              vecAlign = X.ColAlign();
+              batchVecs.push_back( X );
+              batchShifts.push_back( indices );
+          }
+      };
+    auto retire =
+      [&]( const std::vector<Int>& retired )
+      { RetireVectors( retired, batchVecs, batchShifts, vecBatch, vecCol ); };
+    const auto eigCounts =
+      EigenvalueCounts( w, corner, realStep, imagStep, realSize, imagSize );
+    AdaptiveRefinement
+    ( realSize, imagSize, psCtrl, eigCounts, estimates, itCounts, evaluate,
+      retire, psCtrl.progress && g.Rank() == 0 );
+
+    DistMatrix<Real,VR,STAR> invNorms( numShifts, 1, g );
+    DistMatrix<Int,VR,STAR> itCountVec( numShifts, 1, g );
+    const Int numLocShifts = invNorms.LocalHeight();
+    for( Int iLoc=0; iLoc<numLocShifts; ++iLoc )
+    {
+        const Int i = invNorms.GlobalRow(iLoc);
+        invNorms.SetLocal( iLoc, 0, estimates[i] );
+        itCountVec.SetLocal( iLoc, 0, itCounts[i] );
+    }
+    FinalSnapshot( invNorms, itCountVec, snapCtrl );
+
+    DistMatrix<Int> itCountMap(g);
+    ReshapeIntoGrid( realSize, imagSize, invNorms, invNormMap );
+    ReshapeIntoGrid( realSize, imagSize, itCountVec, itCountMap );
+    return itCountMap;
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_ADAPTIVE_HPP
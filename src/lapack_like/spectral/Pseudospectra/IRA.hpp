@@ -227,7 +227,8 @@ template<typename Real>
 inline Matrix<Int>
 IRA
 ( const Matrix<Complex<Real>>& U, const Matrix<Complex<Real>>& shifts, 
-  Matrix<Real>& invNorms, PseudospecCtrl<Real> psCtrl=PseudospecCtrl<Real>() )
+  Matrix<Real>& invNorms, PseudospecCtrl<Real> psCtrl=PseudospecCtrl<Real>(),
+  Matrix<Complex<Real>>* warmVecs=nullptr )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::IRA"))
     using namespace pspec;
@@ -266,7 +267,7 @@ IRA
     std::vector<Matrix<C>> VList(basisSize+1), activeVList(basisSize+1);
     for( Int j=0; j<basisSize+1; ++j )
         Zeros( VList[j], n, numShifts );
-    Gaussian( VList[0], n, numShifts );
+    StartingVectors( VList[0], n, numShifts, warmVecs );
     std::vector<Matrix<Complex<Real>>> HList(numShifts);
     Matrix<Real> realComponents;
     Matrix<Complex<Real>> components;
@@ -441,6 +442,7 @@ IRA
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
     } 
 
+    SaveFinalVectors( preimage, deflate, VList[0], warmVecs );
     invNorms = estimates;
     if( deflate )
         RestoreOrdering( preimage, invNorms, itCounts );
@@ -669,7 +671,8 @@ IRA
 ( const AbstractDistMatrix<Complex<Real>>& UPre, 
   const AbstractDistMatrix<Complex<Real>>& shiftsPre, 
         AbstractDistMatrix<Real>& invNormsPre, 
-  PseudospecCtrl<Real> psCtrl=PseudospecCtrl<Real>() )
+  PseudospecCtrl<Real> psCtrl=PseudospecCtrl<Real>(),
+  AbstractDistMatrix<Complex<Real>>* warmVecs=nullptr )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::IRA"))
     using namespace pspec;
@@ -727,7 +730,7 @@ IRA
         VList[j].SetGrid( g );
         Zeros( VList[j], n, numShifts );
     }
-    Gaussian( VList[0], n, numShifts );
+    StartingVectors( VList[0], n, numShifts, warmVecs );
     const Int numMRShifts = VList[0].LocalWidth();
     std::vector<Matrix<Complex<Real>>> HList(numMRShifts);
     Matrix<Real> realComponents;
@@ -938,6 +941,7 @@ IRA
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
     } 
 
+    SaveFinalVectors( preimage, deflate, VList[0], warmVecs );
     invNorms = estimates;
     if( deflate )
         RestoreOrdering( preimage, invNorms, itCounts );
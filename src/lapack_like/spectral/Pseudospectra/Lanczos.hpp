@@ -223,7 +223,8 @@ template<typename Real>
 inline Matrix<Int>
 Lanczos
 ( const Matrix<Complex<Real>>& U, const Matrix<Complex<Real>>& shifts, 
-  Matrix<Real>& invNorms, PseudospecCtrl<Real> psCtrl=PseudospecCtrl<Real>() )
+  Matrix<Real>& invNorms, PseudospecCtrl<Real> psCtrl=PseudospecCtrl<Real>(),
+  Matrix<Complex<Real>>* warmVecs=nullptr )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::Lanczos"))
     using namespace pspec;
@@ -260,7 +261,7 @@ Lanczos
     // Simultaneously run Lanczos for various shifts
     Matrix<C> XOld, X, XNew;
     Zeros( XOld, n, numShifts );
-    Gaussian( X, n, numShifts );
+    StartingVectors( X, n, numShifts, warmVecs );
     FixColumns( X );
     Zeros( XNew, n, numShifts );
     std::vector<Matrix<Real>> HDiagList( numShifts ),
@@ -395,6 +396,7 @@ Lanczos
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
     } 
 
+    SaveFinalVectors( preimage, deflate, X, warmVecs );
     invNorms = estimates;
     if( deflate )
         RestoreOrdering( preimage, invNorms, itCounts );
@@ -409,7 +411,8 @@ Lanczos
 ( const AbstractDistMatrix<Complex<Real>>& UPre, 
   const AbstractDistMatrix<Complex<Real>>& shiftsPre, 
         AbstractDistMatrix<Real>& invNormsPre, 
-  PseudospecCtrl<Real> psCtrl=PseudospecCtrl<Real>() )
+  PseudospecCtrl<Real> psCtrl=PseudospecCtrl<Real>(),
+  AbstractDistMatrix<Complex<Real>>* warmVecs=nullptr )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::Lanczos"))
     using namespace pspec;
@@ -465,7 +468,7 @@ Lanczos
     // Simultaneously run Lanczos for various shifts
     DistMatrix<C> XOld(g), X(g), XNew(g);
     Zeros( XOld, n, numShifts );
-    Gaussian( X, n, numShifts );
+    StartingVectors( X, n, numShifts, warmVecs );
     FixColumns( X );
     Zeros( XNew, n, numShifts );
     std::vector<Matrix<Real>> HDiagList( X.LocalWidth() ),
@@ -642,6 +645,7 @@ Lanczos
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
     } 
 
+    SaveFinalVectors( preimage, deflate, X, warmVecs );
     invNorms = estimates;
     if( deflate )
         RestoreOrdering( preimage, invNorms, itCounts );
@@ -211,7 +211,8 @@ template<typename Real>
 inline Matrix<Int>
 Power
 ( const Matrix<Complex<Real>>& U, const Matrix<Complex<Real>>& shifts, 
-  Matrix<Real>& invNorms, PseudospecCtrl<Real> psCtrl=PseudospecCtrl<Real>() )
+  Matrix<Real>& invNorms, PseudospecCtrl<Real> psCtrl=PseudospecCtrl<Real>(),
+  Matrix<Complex<Real>>* warmVecs=nullptr )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::Power"))
     using namespace pspec;
@@ -250,7 +251,7 @@ Power
     // Simultaneously run inverse iteration for various shifts
     Timer timer;
     Matrix<C> X;
-    Gaussian( X, n, numShifts );
+    StartingVectors( X, n, numShifts, warmVecs );
     FixColumns( X );
     Int numIts=0, numDone=0;
     Matrix<Real> estimates(numShifts,1);
@@ -327,6 +328,7 @@ Power
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
     } 
 
+    SaveFinalVectors( preimage, deflate, X, warmVecs );
     invNorms = estimates;
     if( deflate )
         RestoreOrdering( preimage, invNorms, itCounts );
@@ -341,7 +343,8 @@ Power
 ( const AbstractDistMatrix<Complex<Real>>& UPre, 
   const AbstractDistMatrix<Complex<Real>>& shiftsPre, 
         AbstractDistMatrix<Real>& invNormsPre, 
-  PseudospecCtrl<Real> psCtrl=PseudospecCtrl<Real>() )
+  PseudospecCtrl<Real> psCtrl=PseudospecCtrl<Real>(),
+  AbstractDistMatrix<Complex<Real>>* warmVecs=nullptr )
 {
     DEBUG_ONLY(CallStackEntry cse("pspec::Power"))
     using namespace pspec;
@@ -396,7 +399,7 @@ Power
     // Simultaneously run inverse iteration for various shifts
     Timer timer;
     DistMatrix<C> X(g);
-    Gaussian( X, n, numShifts );
+    StartingVectors( X, n, numShifts, warmVecs );
     FixColumns( X );
     Int numIts=0, numDone=0;
     DistMatrix<Real,MR,STAR> estimates(g);
@@ -476,6 +479,7 @@ Power
         ( preimage, estimates, itCounts, numIts, deflate, psCtrl.snapCtrl );
     } 
 
+    SaveFinalVectors( preimage, deflate, X, warmVecs );
     invNorms = estimates;
     if( deflate )
         RestoreOrdering( preimage, invNorms, itCounts );
@@ -370,6 +370,26 @@ FixColumns( Matrix<F>& X )
     }
 }
 
+// Replace the given columns of X with Gaussian vectors. The columns are drawn
+// as a single block over the whole grid, so every process must call this
+// routine with the same list of columns.
+template<typename F,Dist U,Dist V>
+inline void
+RedrawColumns( DistMatrix<F,U,V>& X, const std::vector<Int>& cols )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::RedrawColumns"))
+    const Int m = X.Height();
+    const Int numCols = cols.size();
+    DistMatrix<F,U,V> G( X.Grid() );
+    Gaussian( G, m, numCols );
+    for( Int k=0; k<numCols; ++k )
+    {
+        auto g = G( IR(0,m), IR(k,k+1) );
+        auto x = X( IR(0,m), IR(cols[k],cols[k]+1) );
+        Copy( g, x );
+    }
+}
+
 template<typename F,Dist U,Dist V>
 inline void
 FixColumns( DistMatrix<F,U,V>& X )
@@ -378,18 +398,26 @@ FixColumns( DistMatrix<F,U,V>& X )
     typedef Base<F> Real;
     DistMatrix<Real,V,STAR> norms( X.Grid() );
     ColumnNorms( X, norms );
+
+    // Every process must agree on the zero columns to redraw them
+    DistMatrix<Real,STAR,STAR> norms_STAR_STAR( norms );
+    std::vector<Int> zeroCols;
+    for( Int j=0; j<X.Width(); ++j )
+        if( norms_STAR_STAR.GetLocal(j,0) == Real(0) )
+            zeroCols.push_back( j );
+    if( zeroCols.size() != 0 )
+    {
+        RedrawColumns( X, zeroCols );
+        ColumnNorms( X, norms );
+    }
+
     const Int m = X.Height();
     const Int nLocal = X.LocalWidth();
     for( Int jLoc=0; jLoc<nLocal; ++jLoc )
     {
         const Int j = X.GlobalCol(jLoc);
         auto x = X( IR(0,m), IR(j,j+1) );
-        Real norm = norms.GetLocal(jLoc,0);
-        if( norm == Real(0) )
-        {
-            MakeGaussian( x );
-            norm = FrobeniusNorm( x );
-        }
+        const Real norm = norms.GetLocal(jLoc,0);
         Scale( Real(1)/norm, x );
     }
 }
@@ -0,0 +1,110 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_PSEUDOSPECTRA_UTIL_WARMSTART_HPP
+#define EL_PSEUDOSPECTRA_UTIL_WARMSTART_HPP
+
+namespace El {
+namespace pspec {
+
+// The iterative estimators begin from Gaussian vectors unless a full set of
+// warm-start vectors (one per shift) is provided, in which case any columns
+// which are zero or not finite are redrawn
+template<typename F>
+inline void
+StartingVectors( Matrix<F>& X, Int n, Int numShifts, const Matrix<F>* warmVecs )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::StartingVectors"))
+    typedef Base<F> Real;
+    if( warmVecs == nullptr ||
+        warmVecs->Height() != n || warmVecs->Width() != numShifts )
+    {
+        Gaussian( X, n, numShifts );
+        return;
+    }
+    X = *warmVecs;
+    Matrix<Real> norms;
+    ColumnNorms( X, norms );
+    for( Int j=0; j<numShifts; ++j )
+    {
+        const Real norm = norms.Get(j,0);
+        if( norm == Real(0) || std::isnan(norm) || std::isinf(norm) )
+        {
+            auto x = X( IR(0,n), IR(j,j+1) );
+            MakeGaussian( x );
+        }
+    }
+}
+
+template<typename F>
+inline void
+StartingVectors
+( DistMatrix<F>& X, Int n, Int numShifts,
+  const AbstractDistMatrix<F>* warmVecs )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::StartingVectors"))
+    typedef Base<F> Real;
+    if( warmVecs == nullptr ||
+        warmVecs->Height() != n || warmVecs->Width() != numShifts )
+    {
+        Gaussian( X, n, numShifts );
+        return;
+    }
+    Copy( *warmVecs, X );
+    DistMatrix<Real,MR,STAR> norms( X.Grid() );
+    ColumnNorms( X, norms );
+
+    // Every process must agree on which columns are redrawn so that the
+    // Gaussian draw (and the random stream it consumes) is collective
+    DistMatrix<Real,STAR,STAR> norms_STAR_STAR( norms );
+    std::vector<Int> badCols;
+    for( Int j=0; j<numShifts; ++j )
+    {
+        const Real norm = norms_STAR_STAR.GetLocal(j,0);
+        if( norm == Real(0) || std::isnan(norm) || std::isinf(norm) )
+            badCols.push_back( j );
+    }
+    if( badCols.size() != 0 )
+        RedrawColumns( X, badCols );
+}
+
+// Return the final vectors in the original ordering of the shifts so that
+// they may be used to warm-start nearby shifts
+template<typename F>
+inline void
+SaveFinalVectors
+( const Matrix<Int>& preimage, bool deflate,
+  const Matrix<F>& X, Matrix<F>* warmVecs )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::SaveFinalVectors"))
+    if( warmVecs == nullptr )
+        return;
+    *warmVecs = X;
+    if( deflate )
+        InversePermuteCols( *warmVecs, preimage );
+}
+
+template<typename F>
+inline void
+SaveFinalVectors
+( const AbstractDistMatrix<Int>& preimage, bool deflate,
+  const DistMatrix<F>& X, AbstractDistMatrix<F>* warmVecs )
+{
+    DEBUG_ONLY(CallStackEntry cse("pspec::SaveFinalVectors"))
+    if( warmVecs == nullptr )
+        return;
+    Copy( X, *warmVecs );
+    if( deflate )
+        InversePermuteCols( *warmVecs, preimage );
+}
+
+} // namespace pspec
+} // namespace El
+
+#endif // ifndef EL_PSEUDOSPECTRA_UTIL_WARMSTART_HPP
@@ -22,6 +22,7 @@ void SVD
 ( Matrix<F>& A, Matrix<Base<F>>& s, Matrix<F>& V, const SVDCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("SVD"))
+    ScopedTimer timer("SVD");
     if( ctrl.thresholded )
     {
         svd::Thresholded( A, s, V, ctrl.tol, ctrl.relative );
@@ -41,6 +42,7 @@ void SVD
   AbstractDistMatrix<F>& V, const SVDCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("SVD"))
+    ScopedTimer timer("SVD");
     if( ctrl.thresholded )
     {
         if( A.ColDist() == VC && A.RowDist() == STAR )
@@ -62,6 +64,7 @@ template<typename F>
 void SVD( Matrix<F>& A, Matrix<Base<F>>& s )
 {
     DEBUG_ONLY(CallStackEntry cse("SVD"))
+    ScopedTimer timer("SVD");
     const Int m = A.Height();
     const Int n = A.Width();
     s.Resize( Min(m,n), 1 );
@@ -74,6 +77,7 @@ void SVD
   const SVDCtrl<Base<F>>& ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("SVD"))
+    ScopedTimer timer("SVD");
     // TODO: Add more options
     svd::Chan( A, s, ctrl.valChanRatio );
 }
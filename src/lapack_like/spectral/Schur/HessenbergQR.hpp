@@ -0,0 +1,599 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SCHUR_HESSENBERGQR_HPP
+#define EL_SCHUR_HESSENBERGQR_HPP
+
+// A native implementation of the small-bulge multishift Hessenberg QR
+// algorithm with aggressive early deflation, loosely following the approach
+// of LAPACK's xLAQR0 and ScaLAPACK's PxLAQR0. Each operation on the
+// distributed upper Hessenberg matrix is organized around a diagonal window
+// which is small enough to be redundantly stored on every process:
+//
+//  1. Aggressive early deflation computes the Schur decomposition of the
+//     trailing window and deflates the eigenvalues whose component of the
+//     'spike' (the window's subdiagonal entry, after transformation) is
+//     negligible. The remaining eigenvalues of the window are used as shifts.
+//  2. Each sweep introduces a tightly-packed chain of 3x3 (or, in the complex
+//     case, 2x2) bulges at the top of the active block and chases them down
+//     the diagonal in windows, accumulating the reflections of each window
+//     into an orthogonal matrix.
+//
+// In both cases the rows and columns outside of the window (as well as the
+// Schur vectors) are then updated with distributed matrix-matrix
+// multiplications against the accumulated transformation.
+//
+// Unlike LAPACK, the deflation window is not reordered: eigenvalues are only
+// deflated from the bottom of the window up to the first one which cannot be.
+
+namespace El {
+namespace schur {
+
+namespace hess_qr {
+
+inline Int NumShifts( Int n, const HessQRCtrl& ctrl )
+{
+    if( ctrl.numShifts > 0 )
+        return ctrl.numShifts;
+    // The defaults of LAPACK's IPARMQ
+    if( n < 30 )
+        return 2;
+    else if( n < 60 )
+        return 4;
+    else if( n < 150 )
+        return 10;
+    else if( n < 590 )
+        return Max( Int(10), 2*(n/(2*Int(Log2(Unsigned(n))))) );
+    else if( n < 3000 )
+        return 64;
+    else if( n < 6000 )
+        return 128;
+    else
+        return 256;
+}
+
+inline Int DeflationWindow( Int n, Int numShifts, const HessQRCtrl& ctrl )
+{
+    if( ctrl.deflationWindow > 0 )
+        return ctrl.deflationWindow;
+    return ( n <= 500 ? numShifts : 3*numShifts/2 );
+}
+
+// C := C V, where V is redundantly stored
+template<typename F>
+inline void ApplyRight( DistMatrix<F>& C, const DistMatrix<F,STAR,STAR>& V )
+{
+    DEBUG_ONLY(CallStackEntry cse("hess_qr::ApplyRight"))
+    if( C.Height() == 0 || C.Width() == 0 )
+        return;
+    const Grid& g = C.Grid();
+    DistMatrix<F,MC,STAR> C_MC_STAR(g);
+    DistMatrix<F,STAR,MR> V_STAR_MR(g);
+    C_MC_STAR.AlignWith( C );
+    V_STAR_MR.AlignWith( C );
+    C_MC_STAR = C;
+    V_STAR_MR = V;
+    LocalGemm( NORMAL, NORMAL, F(1), C_MC_STAR, V_STAR_MR, F(0), C );
+}
+
+// C := V^H C, where V is redundantly stored
+template<typename F>
+inline void ApplyLeftAdjoint
+( const DistMatrix<F,STAR,STAR>& V, DistMatrix<F>& C )
+{
+    DEBUG_ONLY(CallStackEntry cse("hess_qr::ApplyLeftAdjoint"))
+    if( C.Height() == 0 || C.Width() == 0 )
+        return;
+    const Grid& g = C.Grid();
+    DistMatrix<F,STAR,MC> V_STAR_MC(g);
+    DistMatrix<F,STAR,MR> C_STAR_MR(g);
+    V_STAR_MC.AlignWith( C );
+    C_STAR_MR.AlignWith( C );
+    V_STAR_MC = V;
+    C_STAR_MR = C;
+    LocalGemm( ADJOINT, NORMAL, F(1), V_STAR_MC, C_STAR_MR, F(0), C );
+}
+
+// Apply the similarity transformation V, which was computed for the diagonal
+// window [wBeg,wEnd), to the rows above and the columns to the right of the
+// window (limited to [rowBeg,colEnd)) as well as to the Schur vectors
+template<typename F>
+inline void UpdateOffWindow
+( DistMatrix<F>& H, DistMatrix<F>* Q, const DistMatrix<F,STAR,STAR>& V,
+  Int wBeg, Int wEnd, Int rowBeg, Int colEnd )
+{
+    DEBUG_ONLY(CallStackEntry cse("hess_qr::UpdateOffWindow"))
+    const Int wSize = wEnd-wBeg;
+    DistMatrix<F> C(H.Grid());
+    View( C, H, rowBeg, wBeg, wBeg-rowBeg, wSize );
+    ApplyRight( C, V );
+    View( C, H, wBeg, wEnd, wSize, colEnd-wEnd );
+    ApplyLeftAdjoint( V, C );
+    if( Q != nullptr )
+    {
+        View( C, *Q, 0, wBeg, Q->Height(), wSize );
+        ApplyRight( C, V );
+    }
+}
+
+// Apply the reflector I - tau v v^H from the left to the rows [off,off+len) of
+// the columns [firstCol,n) of the window W, and its adjoint from the right to
+// the columns [off,off+len) of the rows [0,lastRow] of W and of all of U
+template<typename F>
+inline void ApplyReflector
+( Matrix<F>& W, Matrix<F>& U, const std::vector<F>& v, F tau,
+  Int off, Int firstCol, Int lastRow )
+{
+    const Int len = v.size();
+    const Int wSize = W.Height();
+    const Int WLDim = W.LDim();
+    const Int ULDim = U.LDim();
+    F* WBuf = W.Buffer();
+    F* UBuf = U.Buffer();
+    for( Int j=firstCol; j<wSize; ++j )
+    {
+        F* w = &WBuf[off+j*WLDim];
+        F gamma = 0;
+        for( Int i=0; i<len; ++i )
+            gamma += Conj(v[i])*w[i];
+        gamma *= tau;
+        for( Int i=0; i<len; ++i )
+            w[i] -= gamma*v[i];
+    }
+    const F tauConj = Conj(tau);
+    for( Int i=0; i<=lastRow; ++i )
+    {
+        F* w = &WBuf[i+off*WLDim];
+        F gamma = 0;
+        for( Int l=0; l<len; ++l )
+            gamma += w[l*WLDim]*v[l];
+        gamma *= tauConj;
+        for( Int l=0; l<len; ++l )
+            w[l*WLDim] -= gamma*Conj(v[l]);
+    }
+    for( Int i=0; i<wSize; ++i )
+    {
+        F* u = &UBuf[i+off*ULDim];
+        F gamma = 0;
+        for( Int l=0; l<len; ++l )
+            gamma += u[l*ULDim]*v[l];
+        gamma *= tauConj;
+        for( Int l=0; l<len; ++l )
+            u[l*ULDim] -= gamma*Conj(v[l]);
+    }
+}
+
+// Overwrite x with the Householder vector which maps it to a multiple of e0,
+// returning the corresponding tau (and the multiple in 'beta')
+template<typename F>
+inline F MakeReflector( std::vector<F>& x, F& beta )
+{
+    const Int len = x.size();
+    beta = x[0];
+    Matrix<F> xTail( len-1, 1 );
+    for( Int i=1; i<len; ++i )
+        xTail.Set( i-1, 0, x[i] );
+    const F tau = LeftReflector( beta, xTail );
+    x[0] = 1;
+    for( Int i=1; i<len; ++i )
+        x[i] = xTail.Get(i-1,0);
+    return tau;
+}
+
+// The first column of (H - s0 I)(H - s1 I) for the real double-shift bulges
+template<typename Real>
+inline void BulgeColumn
+( const Matrix<Real>& W, Int t, const Complex<Real>* shifts,
+  std::vector<Real>& x )
+{
+    const Real h00 = W.Get(t,  t  ), h01 = W.Get(t,  t+1),
+               h10 = W.Get(t+1,t  ), h11 = W.Get(t+1,t+1),
+               h21 = W.Get(t+2,t+1);
+    const Real sum = RealPart(shifts[0]+shifts[1]);
+    const Real prod = RealPart(shifts[0]*shifts[1]);
+    x.resize( 3 );
+    x[0] = h00*h00 + h01*h10 - sum*h00 + prod;
+    x[1] = h10*(h00+h11-sum);
+    x[2] = h10*h21;
+}
+
+// The first column of H - s0 I for the complex single-shift bulges
+template<typename Real>
+inline void BulgeColumn
+( const Matrix<Complex<Real>>& W, Int t, const Complex<Real>* shifts,
+  std::vector<Complex<Real>>& x )
+{
+    x.resize( 2 );
+    x[0] = W.Get(t,t) - shifts[0];
+    x[1] = W.Get(t+1,t);
+}
+
+// Chase a chain of bulges, each using the next 'bulgeSize'-1 shifts, from the
+// top to the bottom of the active block [ilo,ihi)
+template<typename F>
+inline void Sweep
+( DistMatrix<F>& H, DistMatrix<F>* Q, Int ilo, Int ihi,
+  const std::vector<Complex<Base<F>>>& shifts, Int rowBeg, Int colEnd )
+{
+    DEBUG_ONLY(CallStackEntry cse("hess_qr::Sweep"))
+    typedef Base<F> Real;
+    const Grid& g = H.Grid();
+    const Int bulgeSize = ( IsComplex<F>::val ? 2 : 3 );
+    const Int numBulges = shifts.size() / (bulgeSize-1);
+    // Leave room to chase the entire chain by its own length in each window
+    const Int winSize = 2*(numBulges+1)*bulgeSize + 2;
+
+    // The (global) column containing the nonzeros of each bulge, where the
+    // bulges in [numFinished,numIntroduced) are in flight
+    std::vector<Int> pos( numBulges );
+    Int numIntroduced=0, numFinished=0;
+
+    DistMatrix<F> HWin(g);
+    DistMatrix<F,STAR,STAR> W_STAR_STAR(g), U_STAR_STAR(g);
+    std::vector<F> v;
+    while( numFinished < numBulges )
+    {
+        const Int wBeg =
+            ( numIntroduced < numBulges ? ilo : pos[numIntroduced-1] );
+        const Int wEnd = Min( ihi, wBeg+winSize );
+        const Int wSize = wEnd-wBeg;
+        View( HWin, H, wBeg, wBeg, wSize, wSize );
+        W_STAR_STAR = HWin;
+        Identity( U_STAR_STAR, wSize, wSize );
+        Matrix<F>& W = W_STAR_STAR.Matrix();
+        Matrix<F>& U = U_STAR_STAR.Matrix();
+
+        // Move each bulge down by one step per round, starting with the lowest
+        // and keeping them 'bulgeSize' apart, until none can move within the
+        // window
+        bool moved = true, movedAny = false;
+        while( moved )
+        {
+            moved = false;
+            for( Int b=numFinished; b<numIntroduced; ++b )
+            {
+                const Int k = pos[b];
+                const Int len = Min( bulgeSize, ihi-1-k );
+                if( len <= 1 )
+                {
+                    // This bulge has been chased off of the bottom
+                    ++numFinished;
+                    moved = true;
+                    continue;
+                }
+                const Int lastRow = Min( k+bulgeSize+1, ihi-1 );
+                if( lastRow >= wEnd )
+                    continue;
+                if( b > numFinished && k+1+bulgeSize > pos[b-1] )
+                    continue;
+
+                const Int kLoc = k - wBeg;
+                v.resize( len );
+                for( Int i=0; i<len; ++i )
+                    v[i] = W.Get(kLoc+1+i,kLoc);
+                F beta;
+                const F tau = MakeReflector( v, beta );
+                W.Set( kLoc+1, kLoc, beta );
+                for( Int i=1; i<len; ++i )
+                    W.Set( kLoc+1+i, kLoc, 0 );
+                ApplyReflector( W, U, v, tau, kLoc+1, kLoc+1, lastRow-wBeg );
+                ++pos[b];
+                moved = true;
+            }
+            if( numIntroduced < numBulges && wBeg == ilo )
+            {
+                const bool roomAbove =
+                    ( numIntroduced == numFinished ||
+                      pos[numIntroduced-1] >= ilo+bulgeSize );
+                const Int lastRow = Min( ilo+bulgeSize, ihi-1 );
+                if( roomAbove && lastRow < wEnd )
+                {
+                    BulgeColumn
+                    ( W, 0, &shifts[numIntroduced*(bulgeSize-1)], v );
+                    Real scale = 0;
+                    for( const F& nu : v )
+                        scale += Abs(nu);
+                    if( scale != Real(0) )
+                        for( F& nu : v )
+                            nu /= scale;
+                    F beta;
+                    const F tau = MakeReflector( v, beta );
+                    ApplyReflector( W, U, v, tau, 0, 0, lastRow-wBeg );
+                    pos[numIntroduced++] = ilo;
+                    moved = true;
+                }
+            }
+            movedAny = movedAny || moved;
+        }
+        if( !movedAny )
+            LogicError("Bulge chase stalled");
+
+        HWin = W_STAR_STAR;
+        UpdateOffWindow( H, Q, U_STAR_STAR, wBeg, wEnd, rowBeg, colEnd );
+    }
+}
+
+// Redundantly compute the Schur decomposition of the diagonal window
+// [wBeg,wEnd) and apply it to the rest of the matrix
+template<typename F>
+inline void WindowSchur
+( DistMatrix<F>& H, DistMatrix<F>* Q, Int wBeg, Int wEnd,
+  Int rowBeg, Int colEnd, Matrix<Complex<Base<F>>>& w )
+{
+    DEBUG_ONLY(CallStackEntry cse("hess_qr::WindowSchur"))
+    const Grid& g = H.Grid();
+    const Int wSize = wEnd-wBeg;
+    DistMatrix<F> HWin(g);
+    View( HWin, H, wBeg, wBeg, wSize, wSize );
+    DistMatrix<F,STAR,STAR> T_STAR_STAR( HWin ), V_STAR_STAR( wSize, wSize, g );
+    Matrix<F>& T = T_STAR_STAR.Matrix();
+    Matrix<F>& V = V_STAR_STAR.Matrix();
+    auto wWin = w( IR(wBeg,wEnd), IR(0,1) );
+    lapack::HessenbergSchur
+    ( wSize, T.Buffer(), T.LDim(), wWin.Buffer(), V.Buffer(), V.LDim(),
+      true, false );
+    HWin = T_STAR_STAR;
+    UpdateOffWindow( H, Q, V_STAR_STAR, wBeg, wEnd, rowBeg, colEnd );
+}
+
+// Aggressive early deflation over the trailing window of size 'winSize' of the
+// active block [ilo,ihi). The number of deflated eigenvalues (which are
+// stored into w) is returned, and the undeflated eigenvalues of the window are
+// returned as candidate shifts.
+template<typename F>
+inline Int AggressiveDeflation
+( DistMatrix<F>& H, DistMatrix<F>* Q, Int ilo, Int ihi, Int winSize,
+  Int rowBeg, Int colEnd, Matrix<Complex<Base<F>>>& w,
+  std::vector<Complex<Base<F>>>& shifts )
+{
+    DEBUG_ONLY(CallStackEntry cse("hess_qr::AggressiveDeflation"))
+    typedef Base<F> Real;
+    const Grid& g = H.Grid();
+    const Real ulp = lapack::MachinePrecision<Real>();
+    const Real smallNum = lapack::MachineSafeMin<Real>()*(Real(ihi-ilo)/ulp);
+    const Int kwtop = ihi-winSize;
+    const F spike = ( kwtop > ilo ? H.Get(kwtop,kwtop-1) : F(0) );
+
+    DistMatrix<F> HWin(g);
+    View( HWin, H, kwtop, kwtop, winSize, winSize );
+    DistMatrix<F,STAR,STAR> T_STAR_STAR( HWin ),
+                            V_STAR_STAR( winSize, winSize, g );
+    Matrix<F>& T = T_STAR_STAR.Matrix();
+    Matrix<F>& V = V_STAR_STAR.Matrix();
+    Matrix<Complex<Real>> wWin( winSize, 1 );
+    lapack::HessenbergSchur
+    ( winSize, T.Buffer(), T.LDim(), wWin.Buffer(), V.Buffer(), V.LDim(),
+      true, false );
+
+    // The subdiagonal entry of the window becomes the spike s = V^H e0 spike
+    std::vector<F> s( winSize );
+    for( Int j=0; j<winSize; ++j )
+        s[j] = spike*Conj(V.Get(0,j));
+
+    // Deflate from the bottom of the window
+    Int numUndeflated = winSize;
+    while( numUndeflated > 0 )
+    {
+        const Int j = numUndeflated-1;
+        const bool pair =
+            !IsComplex<F>::val && j > 0 && T.Get(j,j-1) != F(0);
+        Real scale = Abs(T.Get(j,j));
+        if( pair )
+            scale += Sqrt(Abs(T.Get(j,j-1)))*Sqrt(Abs(T.Get(j-1,j)));
+        if( scale == Real(0) )
+            scale = Abs(spike);
+        const Real tol = Max( smallNum, ulp*scale );
+        if( Abs(s[j]) > tol || (pair && Abs(s[j-1]) > tol) )
+            break;
+        numUndeflated -= ( pair ? 2 : 1 );
+    }
+    const Int numDeflated = winSize-numUndeflated;
+
+    shifts.resize( numUndeflated );
+    for( Int j=0; j<numUndeflated; ++j )
+        shifts[j] = wWin.Get(j,0);
+    // As in LAPACK, the window is left untouched if nothing deflated
+    if( numDeflated == 0 )
+        return 0;
+    for( Int j=numUndeflated; j<winSize; ++j )
+        w.Set( kwtop+j, 0, wWin.Get(j,0) );
+
+    // Return the undeflated portion of the window to Hessenberg form by first
+    // reflecting the spike onto e0 and then reducing the remaining block
+    if( numUndeflated > 1 )
+    {
+        std::vector<F> v( s.begin(), s.begin()+numUndeflated );
+        F beta;
+        const F tau = MakeReflector( v, beta );
+        ApplyReflector( T, V, v, tau, 0, 0, winSize-1 );
+        s[0] = beta;
+
+        auto T11 = T( IR(0,numUndeflated), IR(0,numUndeflated) );
+        auto T12 = T( IR(0,numUndeflated), IR(numUndeflated,winSize) );
+        auto V1 = V( IR(0,winSize), IR(0,numUndeflated) );
+        Matrix<F> t;
+        Hessenberg( UPPER, T11, t );
+        hessenberg::ApplyQ( LEFT, UPPER, ADJOINT, T11, t, T12 );
+        hessenberg::ApplyQ( RIGHT, UPPER, NORMAL, T11, t, V1 );
+        MakeTrapezoidal( UPPER, T11, -1 );
+    }
+    if( numUndeflated == 0 )
+        s[0] = 0;
+    for( Int j=1; j<winSize; ++j )
+        s[j] = 0;
+
+    HWin = T_STAR_STAR;
+    if( kwtop > ilo )
+        H.Set( kwtop, kwtop-1, s[0] );
+    UpdateOffWindow( H, Q, V_STAR_STAR, kwtop, ihi, rowBeg, colEnd );
+    return numDeflated;
+}
+
+// Group the shifts so that each bulge of a real matrix uses either a pair of
+// real shifts or a complex-conjugate pair
+template<typename Real>
+inline void PairShifts( std::vector<Complex<Real>>& shifts, Real )
+{
+    std::vector<Complex<Real>> paired, reals;
+    const Int numShifts = shifts.size();
+    for( Int j=0; j<numShifts; ++j )
+    {
+        if( ImagPart(shifts[j]) != Real(0) )
+        {
+            paired.push_back( shifts[j] );
+            paired.push_back( Conj(shifts[j]) );
+            if( j+1 < numShifts && shifts[j+1] == Conj(shifts[j]) )
+                ++j;
+        }
+        else
+            reals.push_back( shifts[j] );
+    }
+    // A leftover real shift is simply paired with itself
+    if( reals.size() % 2 == 1 )
+        reals.push_back( reals.back() );
+    paired.insert( paired.end(), reals.begin(), reals.end() );
+    shifts.swap( paired );
+}
+
+template<typename Real>
+inline void PairShifts( std::vector<Complex<Real>>& shifts, Complex<Real> )
+{ }
+
+template<typename F>
+inline void Run
+( DistMatrix<F>& H, AbstractDistMatrix<Complex<Base<F>>>& w,
+  DistMatrix<F>* Q, bool fullTriangle, const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("hess_qr::Run"))
+    typedef Base<F> Real;
+    const Grid& g = H.Grid();
+    const Int n = H.Height();
+    const Real ulp = lapack::MachinePrecision<Real>();
+    const Real smallNum = lapack::MachineSafeMin<Real>()*(Real(n)/ulp);
+    // The bulges need some room to be introduced and chased
+    const Int cutoff = Max( ctrl.sequentialCutoff, Int(12) );
+    const Int maxIts = 30*Max(Int(10),n);
+
+    // Unless the full triangle (or the Schur vectors) are desired, only the
+    // active block needs to be kept up to date
+    const bool wantFull = fullTriangle || Q != nullptr;
+
+    DistMatrix<Complex<Real>,STAR,STAR> w_STAR_STAR( n, 1, g );
+    Matrix<Complex<Real>>& wLoc = w_STAR_STAR.Matrix();
+    DistMatrix<F,STAR,STAR> diag(g), subdiag(g);
+    std::vector<Complex<Real>> shifts;
+
+    Int ihi=n, numIts=0, itsSinceDeflation=0;
+    while( ihi > 0 )
+    {
+        // Find the top of the unreduced block at the bottom of [0,ihi)
+        auto HAct = LockedView( H, 0, 0, ihi, ihi );
+        HAct.GetDiagonal( diag );
+        HAct.GetDiagonal( subdiag, -1 );
+        Int ilo = ihi-1;
+        for( ; ilo>0; --ilo )
+        {
+            const Real tst =
+                Abs(diag.GetLocal(ilo-1,0)) + Abs(diag.GetLocal(ilo,0));
+            if( Abs(subdiag.GetLocal(ilo-1,0)) <= Max(smallNum,ulp*tst) )
+            {
+                H.Set( ilo, ilo-1, 0 );
+                break;
+            }
+        }
+        const Int rowBeg = ( wantFull ? 0 : ilo );
+        const Int colEnd = ( wantFull ? n : ihi );
+        const Int blockSize = ihi-ilo;
+
+        if( blockSize <= cutoff )
+        {
+            WindowSchur( H, Q, ilo, ihi, rowBeg, colEnd, wLoc );
+            ihi = ilo;
+            itsSinceDeflation = 0;
+            continue;
+        }
+        if( numIts++ == maxIts )
+            RuntimeError("Hessenberg QR did not converge");
+
+        const Int numShiftsMax =
+            Min( NumShifts(blockSize,ctrl), Max(Int(2),blockSize/4) );
+        const Int winSize =
+            Min( DeflationWindow(blockSize,numShiftsMax,ctrl), blockSize-1 );
+        const Int numDeflated =
+            AggressiveDeflation
+            ( H, Q, ilo, ihi, winSize, rowBeg, colEnd, wLoc, shifts );
+        ihi -= numDeflated;
+        if( numDeflated > 0 )
+            itsSinceDeflation = 0;
+        else
+            ++itsSinceDeflation;
+
+        // Skip the sweep if the deflation was sufficiently successful
+        if( 100*numDeflated > 14*winSize || ihi-ilo <= cutoff )
+            continue;
+
+        if( itsSinceDeflation > 0 && itsSinceDeflation % 6 == 0 )
+        {
+            // Exceptional shifts built from the bottom of the active block
+            shifts.resize( numShiftsMax );
+            for( Int j=0; j<numShiftsMax; j+=2 )
+            {
+                const Int i = Max( ilo+2, ihi-1-j );
+                const Real ss =
+                  Abs(subdiag.GetLocal(i-1,0)) + Abs(subdiag.GetLocal(i-2,0));
+                const Complex<Real> center =
+                  diag.GetLocal(i,0) + Real(3)/Real(4)*ss;
+                const Real gamma = ( IsComplex<F>::val ? 0 : Sqrt(0.4375)*ss );
+                shifts[j] = center + Complex<Real>(0,gamma);
+                if( j+1 < numShiftsMax )
+                    shifts[j+1] = center - Complex<Real>(0,gamma);
+            }
+        }
+        else
+        {
+            // Use the undeflated eigenvalues nearest the bottom of the window
+            const Int numShifts = Min( numShiftsMax, Int(shifts.size()) );
+            shifts.erase( shifts.begin(), shifts.end()-numShifts );
+        }
+        PairShifts( shifts, F(0) );
+        if( shifts.empty() )
+            continue;
+        Sweep( H, Q, ilo, ihi, shifts, rowBeg, colEnd );
+    }
+    Copy( w_STAR_STAR, w );
+}
+
+} // namespace hess_qr
+
+// Compute the Schur decomposition of the upper Hessenberg matrix H
+template<typename F>
+inline void
+HessenbergQR
+( DistMatrix<F>& H, AbstractDistMatrix<Complex<Base<F>>>& w,
+  bool fullTriangle, const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::HessenbergQR"))
+    hess_qr::Run( H, w, (DistMatrix<F>*)nullptr, fullTriangle, ctrl );
+}
+
+// The reflections are accumulated into Q from the right
+template<typename F>
+inline void
+HessenbergQR
+( DistMatrix<F>& H, AbstractDistMatrix<Complex<Base<F>>>& w,
+  DistMatrix<F>& Q, bool fullTriangle, const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::HessenbergQR"))
+    hess_qr::Run( H, w, &Q, fullTriangle, ctrl );
+}
+
+} // namespace schur
+} // namespace El
+
+#endif // ifndef EL_SCHUR_HESSENBERGQR_HPP
@@ -51,14 +51,14 @@ QR
     }
 }
 
+#ifdef EL_HAVE_SCALAPACK
 template<typename F>
 inline void
-QR
+ScaLAPACKQR
 ( BlockDistMatrix<F>& A, AbstractDistMatrix<Complex<Base<F>>>& w,
   bool fullTriangle, const HessQRCtrl& ctrl )
 {
-    DEBUG_ONLY(CallStackEntry cse("schur::qr"))
-#ifdef EL_HAVE_SCALAPACK
+    DEBUG_ONLY(CallStackEntry cse("schur::ScaLAPACKQR"))
     const Int n = A.Height();
     const int bhandle = blacs::Handle( A.DistComm().comm );
     const int context =
@@ -100,9 +100,6 @@ QR
     blacs::FreeGrid( context );
     blacs::FreeHandle( bhandle );
     blacs::Exit();
-#else
-    LogicError("Distributed schur::QR currently requires ScaLAPACK support");
-#endif
     if( IsComplex<F>::val )
         MakeTrapezoidal( UPPER, A );
     else
@@ -115,12 +112,11 @@ QR
 
 template<typename F>
 inline void
-QR
+ScaLAPACKQR
 ( BlockDistMatrix<F>& A, AbstractDistMatrix<Complex<Base<F>>>& w,
   BlockDistMatrix<F>& Q, bool fullTriangle, const HessQRCtrl& ctrl )
 {
-    DEBUG_ONLY(CallStackEntry cse("schur::qr"))
-#ifdef EL_HAVE_SCALAPACK
+    DEBUG_ONLY(CallStackEntry cse("schur::ScaLAPACKQR"))
     const Int n = A.Height();
     const int bhandle = blacs::Handle( A.DistComm().comm );
     const int context =
@@ -180,9 +176,6 @@ QR
     blacs::FreeGrid( context );
     blacs::FreeHandle( bhandle );
     blacs::Exit();
-#else
-    LogicError("Distributed schur::QR currently requires ScaLAPACK support");
-#endif
     if( IsComplex<F>::val )
         MakeTrapezoidal( UPPER, A );
     else
@@ -195,14 +188,13 @@ QR
 
 template<typename F>
 inline void
-QR
+ScaLAPACKQR
 ( AbstractDistMatrix<F>& APre, AbstractDistMatrix<Complex<Base<F>>>& w, 
   bool fullTriangle, const HessQRCtrl& ctrl )
 {
-    DEBUG_ONLY(CallStackEntry cse("schur::qr"))
+    DEBUG_ONLY(CallStackEntry cse("schur::ScaLAPACKQR"))
     auto APtr = ReadWriteProxy<F,MC,MR>( &APre );
     auto& A = *APtr;
-#ifdef EL_HAVE_SCALAPACK
     // Reduce the matrix to upper-Hessenberg form in an elemental form
     DistMatrix<F,STAR,STAR> t( A.Grid() );
     Hessenberg( UPPER, A, t );
@@ -239,9 +231,6 @@ QR
     blacs::FreeGrid( context );
     blacs::FreeHandle( bhandle );
     blacs::Exit();
-#else
-    LogicError("Distributed schur::QR currently requires ScaLAPACK support");
-#endif
     if( IsComplex<F>::val )
         MakeTrapezoidal( UPPER, A );
     else
@@ -253,14 +242,13 @@ QR
 
 template<typename F>
 inline void
-QR
+ScaLAPACKQR
 ( AbstractDistMatrix<F>& APre, AbstractDistMatrix<Complex<Base<F>>>& w, 
   AbstractDistMatrix<F>& QPre, bool fullTriangle, const HessQRCtrl& ctrl )
 {
-    DEBUG_ONLY(CallStackEntry cse("schur::qr"))
+    DEBUG_ONLY(CallStackEntry cse("schur::ScaLAPACKQR"))
     auto APtr = ReadWriteProxy<F,MC,MR>( &APre ); auto& A = *APtr;
     auto QPtr = WriteProxy<F,MC,MR>( &QPre );     auto& Q = *QPtr;
-#ifdef EL_HAVE_SCALAPACK
     const Int n = A.Height();
     // Reduce A to upper-Hessenberg form in an element-wise distribution
     // and form the explicit reflector matrix
@@ -312,9 +300,38 @@ QR
     blacs::FreeGrid( context );
     blacs::FreeHandle( bhandle );
     blacs::Exit();
-#else
-    LogicError("Distributed schur::QR currently requires ScaLAPACK support");
+    if( IsComplex<F>::val )
+        MakeTrapezoidal( UPPER, A );
+    else
+    {
+        MakeTrapezoidal( UPPER, A, -1 );
+        DEBUG_ONLY(CheckRealSchur(A))
+    }
+}
+#endif // ifdef EL_HAVE_SCALAPACK
+
+template<typename F>
+inline void
+QR
+( AbstractDistMatrix<F>& APre, AbstractDistMatrix<Complex<Base<F>>>& w, 
+  bool fullTriangle, const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::qr"))
+#ifdef EL_HAVE_SCALAPACK
+    if( ctrl.scalapack )
+    {
+        ScaLAPACKQR( APre, w, fullTriangle, ctrl );
+        return;
+    }
 #endif
+    auto APtr = ReadWriteProxy<F,MC,MR>( &APre );
+    auto& A = *APtr;
+
+    DistMatrix<F,STAR,STAR> t( A.Grid() );
+    Hessenberg( UPPER, A, t );
+    MakeTrapezoidal( UPPER, A, -1 );
+    HessenbergQR( A, w, fullTriangle, ctrl );
+
     if( IsComplex<F>::val )
         MakeTrapezoidal( UPPER, A );
     else
@@ -324,6 +341,81 @@ QR
     }
 }
 
+template<typename F>
+inline void
+QR
+( AbstractDistMatrix<F>& APre, AbstractDistMatrix<Complex<Base<F>>>& w, 
+  AbstractDistMatrix<F>& QPre, bool fullTriangle, const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::qr"))
+#ifdef EL_HAVE_SCALAPACK
+    if( ctrl.scalapack )
+    {
+        ScaLAPACKQR( APre, w, QPre, fullTriangle, ctrl );
+        return;
+    }
+#endif
+    auto APtr = ReadWriteProxy<F,MC,MR>( &APre ); auto& A = *APtr;
+    auto QPtr = WriteProxy<F,MC,MR>( &QPre );     auto& Q = *QPtr;
+
+    // Reduce A to upper-Hessenberg form and form the explicit reflector matrix
+    const Int n = A.Height();
+    DistMatrix<F,STAR,STAR> t( A.Grid() );
+    Hessenberg( UPPER, A, t );
+    Identity( Q, n, n ); 
+    hessenberg::ApplyQ( LEFT, UPPER, NORMAL, A, t, Q );
+    MakeTrapezoidal( UPPER, A, -1 );
+    HessenbergQR( A, w, Q, fullTriangle, ctrl );
+
+    if( IsComplex<F>::val )
+        MakeTrapezoidal( UPPER, A );
+    else
+    {
+        MakeTrapezoidal( UPPER, A, -1 );
+        DEBUG_ONLY(CheckRealSchur(A))
+    }
+}
+
+// The native implementation works with an elemental distribution
+template<typename F>
+inline void
+QR
+( BlockDistMatrix<F>& A, AbstractDistMatrix<Complex<Base<F>>>& w,
+  bool fullTriangle, const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::qr"))
+#ifdef EL_HAVE_SCALAPACK
+    if( ctrl.scalapack )
+    {
+        ScaLAPACKQR( A, w, fullTriangle, ctrl );
+        return;
+    }
+#endif
+    DistMatrix<F> AElem( A );
+    QR( AElem, w, fullTriangle, ctrl );
+    A = AElem;
+}
+
+template<typename F>
+inline void
+QR
+( BlockDistMatrix<F>& A, AbstractDistMatrix<Complex<Base<F>>>& w,
+  BlockDistMatrix<F>& Q, bool fullTriangle, const HessQRCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("schur::qr"))
+#ifdef EL_HAVE_SCALAPACK
+    if( ctrl.scalapack )
+    {
+        ScaLAPACKQR( A, w, Q, fullTriangle, ctrl );
+        return;
+    }
+#endif
+    DistMatrix<F> AElem( A ), QElem( A.Grid() );
+    QR( AElem, w, QElem, fullTriangle, ctrl );
+    A = AElem;
+    Q = QElem;
+}
+
 } // namespace schur
 } // namespace El
 
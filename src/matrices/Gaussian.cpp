@@ -19,22 +19,43 @@ void MakeGaussian( Matrix<F>& A, F mean, Base<F> stddev )
     EntrywiseFill( A, std::function<F()>(sampleNormal) );
 }
 
+// As in MakeUniform, every owner of an entry samples it independently from
+// the counter-based generator at its global (i,j) index
+template<typename F,class DistMatType>
+void MakeGaussianByIndex( DistMatType& A, F mean, Base<F> stddev )
+{
+    const PhiloxKey key =
+        CounterKey( RandomSeed(), NextRandomStream(A.Grid().ViewingComm()) );
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    std::vector<Int> globalRows( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    F* buffer = A.Buffer();
+    const Int ldim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        F* col = &buffer[jLoc*ldim];
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            col[iLoc] =
+                CounterSampleNormal( key, globalRows[iLoc], j, mean, stddev );
+    }
+}
+
 template<typename F>
 void MakeGaussian( AbstractDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     DEBUG_ONLY(CallStackEntry cse("MakeGaussian"))
-    if( A.RedundantRank() == 0 )
-        MakeGaussian( A.Matrix(), mean, stddev );
-    A.BroadcastOver( A.RedundantComm(), 0 );
+    MakeGaussianByIndex( A, mean, stddev );
 }
 
 template<typename F>
 void MakeGaussian( AbstractBlockDistMatrix<F>& A, F mean, Base<F> stddev )
 {
     DEBUG_ONLY(CallStackEntry cse("MakeGaussian"))
-    if( A.RedundantRank() == 0 )
-        MakeGaussian( A.Matrix(), mean, stddev );
-    A.BroadcastOver( A.RedundantComm(), 0 );
+    MakeGaussianByIndex( A, mean, stddev );
 }
 
 template<typename F>
@@ -28,22 +28,45 @@ void Uniform( Matrix<T>& A, Int m, Int n, T center, Base<T> radius )
     MakeUniform( A, center, radius );
 }
 
+// Each process (redundant copies included) draws its own entries from a
+// counter-based generator indexed by their global coordinates, so the result
+// does not depend upon the distribution. The only communication is agreeing
+// upon the stream over the whole grid.
+template<typename T,class DistMatType>
+void MakeUniformByIndex( DistMatType& A, T center, Base<T> radius )
+{
+    const PhiloxKey key =
+        CounterKey( RandomSeed(), NextRandomStream(A.Grid().ViewingComm()) );
+    const Int localHeight = A.LocalHeight();
+    const Int localWidth = A.LocalWidth();
+    std::vector<Int> globalRows( localHeight );
+    for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+        globalRows[iLoc] = A.GlobalRow(iLoc);
+    T* buffer = A.Buffer();
+    const Int ldim = A.LDim();
+    EL_PARALLEL_FOR
+    for( Int jLoc=0; jLoc<localWidth; ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        T* col = &buffer[jLoc*ldim];
+        for( Int iLoc=0; iLoc<localHeight; ++iLoc )
+            col[iLoc] =
+                CounterSampleBall( key, globalRows[iLoc], j, center, radius );
+    }
+}
+
 template<typename T>
 void MakeUniform( AbstractDistMatrix<T>& A, T center, Base<T> radius )
 {
     DEBUG_ONLY(CallStackEntry cse("MakeUniform"))
-    if( A.RedundantRank() == 0 )
-        MakeUniform( A.Matrix(), center, radius );
-    A.BroadcastOver( A.RedundantComm(), 0 );
+    MakeUniformByIndex( A, center, radius );
 }
 
 template<typename T>
 void MakeUniform( AbstractBlockDistMatrix<T>& A, T center, Base<T> radius )
 {
     DEBUG_ONLY(CallStackEntry cse("MakeUniform"))
-    if( A.RedundantRank() == 0 )
-        MakeUniform( A.Matrix(), center, radius );
-    A.BroadcastOver( A.RedundantComm(), 0 );
+    MakeUniformByIndex( A, center, radius );
 }
 
 template<typename T>
@@ -67,11 +90,17 @@ template<typename T>
 void MakeUniform( DistMultiVec<T>& X, T center, Base<T> radius )
 {
     DEBUG_ONLY(CallStackEntry cse("MakeUniform"))
-    const int localHeight = X.LocalHeight();
-    const int width = X.Width();
-    for( int j=0; j<width; ++j )
-        for( int iLocal=0; iLocal<localHeight; ++iLocal )
-            X.SetLocal( iLocal, j, SampleBall(center,radius) );
+    const PhiloxKey key =
+        CounterKey( RandomSeed(), NextRandomStream(X.Comm()) );
+    const Int firstLocalRow = X.FirstLocalRow();
+    const Int localHeight = X.LocalHeight();
+    const Int width = X.Width();
+    for( Int j=0; j<width; ++j )
+        for( Int iLocal=0; iLocal<localHeight; ++iLocal )
+        {
+            const Int i = firstLocalRow + iLocal;
+            X.SetLocal( iLocal, j, CounterSampleBall(key,i,j,center,radius) );
+        }
 }
 
 template<typename T>
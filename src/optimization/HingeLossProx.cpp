@@ -18,7 +18,7 @@ void HingeLossProx( Matrix<Real>& A, Real tau )
       [=]( Real alpha ) -> Real
       { if( alpha < 1 ) { return Min(alpha+1/tau,Real(1)); }
         else            { return alpha;                    } };
-    EntrywiseMap( A, std::function<Real(Real)>(hingeProx) );
+    EntrywiseMap( A, hingeProx );
 }
 
 template<typename Real>
@@ -29,7 +29,7 @@ void HingeLossProx( AbstractDistMatrix<Real>& A, Real tau )
       [=]( Real alpha ) -> Real
       { if( alpha < 1 ) { return Min(alpha+1/tau,Real(1)); }
         else            { return alpha;                    } };
-    EntrywiseMap( A, std::function<Real(Real)>(hingeProx) );
+    EntrywiseMap( A, hingeProx );
 }
 
 #define PROTO(Real) \
@@ -23,7 +23,7 @@ inline void NormalizeEntries( Matrix<F>& A )
 { 
     auto unitMap = []( F alpha ) 
                    { return alpha==F(0) ? F(1) : alpha/Abs(alpha); };
-    EntrywiseMap( A, std::function<F(F)>(unitMap) );
+    EntrywiseMap( A, unitMap );
 }
 
 template<typename F>
@@ -31,7 +31,7 @@ inline void NormalizeEntries( AbstractDistMatrix<F>& A )
 { 
     auto unitMap = []( F alpha ) 
                    { return alpha==F(0) ? F(1) : alpha/Abs(alpha); };
-    EntrywiseMap( A, std::function<F(F)>(unitMap) );
+    EntrywiseMap( A, unitMap );
 }
 
 // NOTE: If 'tau' is passed in as zero, it is set to 1/sqrt(max(m,n))
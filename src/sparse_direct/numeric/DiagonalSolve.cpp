@@ -18,6 +18,7 @@ inline void LocalDiagonalSolve
   DistNodalMultiVec<F>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("LocalDiagonalSolve"))
+    ScopedTimer timer("LocalDiagonalSolve");
     const Int numLocalNodes = info.localNodes.size();
     if( PivotedFactorization(L.frontType) )
     {
@@ -40,6 +41,7 @@ inline void LocalDiagonalSolve
   DistNodalMatrix<F>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("LocalDiagonalSolve"))
+    ScopedTimer timer("LocalDiagonalSolve");
     const Int numLocalNodes = info.localNodes.size();
     if( PivotedFactorization(L.frontType) )
     {
@@ -62,6 +64,7 @@ inline void DistDiagonalSolve
   DistNodalMultiVec<F>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("DistDiagonalSolve"))
+    ScopedTimer timer("DistDiagonalSolve");
     const Int numDistNodes = info.distNodes.size();
 
     if( PivotedFactorization(L.frontType) )
@@ -90,6 +93,7 @@ inline void DistDiagonalSolve
   DistNodalMatrix<F>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("DistDiagonalSolve"))
+    ScopedTimer timer("DistDiagonalSolve");
     const Int numDistNodes = info.distNodes.size();
 
     if( PivotedFactorization(L.frontType) )
@@ -118,6 +122,7 @@ void DiagonalSolve
   DistNodalMultiVec<F>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("DiagonalSolve"))
+    ScopedTimer timer("DiagonalSolve");
     LocalDiagonalSolve( info, L, X );
     DistDiagonalSolve( info, L, X );
 }
@@ -128,6 +133,7 @@ void DiagonalSolve
   DistNodalMatrix<F>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("DiagonalSolve"))
+    ScopedTimer timer("DiagonalSolve");
     LocalDiagonalSolve( info, L, X );
     DistDiagonalSolve( info, L, X );
 }
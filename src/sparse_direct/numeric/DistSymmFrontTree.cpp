@@ -10,6 +10,8 @@
 */
 #include "El.hpp"
 
+#include "./FrontStore.hpp"
+
 namespace El {
 
 template<typename T>
@@ -544,8 +546,12 @@ void DistSymmFrontTree<T>::FactorizationWork
     for( int s=0; s<numLocalFronts; ++s )
     {
         const SymmFront<T>& front = localFronts[s];
-        const double m = front.frontL.Height();
-        const double n = front.frontL.Width();
+        // The fronts which were written out of core have been freed
+        const bool onDisk = ( outOfCore && outOfCore->OnDisk(s) );
+        const double m = 
+          ( onDisk ? outOfCore->Height(s) : front.frontL.Height() );
+        const double n = 
+          ( onDisk ? outOfCore->Width(s) : front.frontL.Width() );
         numLocalFlops += (1./3.)*n*n*n; // n x n LDL
         numLocalFlops += (m-n)*n*n; // n x n trsv, m-n r.h.s.
         numLocalFlops += (m-n)*(m-n)*n; // (m-n) x (m-n), rank-n
@@ -595,8 +601,12 @@ void DistSymmFrontTree<T>::SolveWork
     for( int s=0; s<numLocalFronts; ++s )
     {
         const SymmFront<T>& front = localFronts[s];
-        const double m = front.frontL.Height();
-        const double n = front.frontL.Width();
+        // The fronts which were written out of core have been freed
+        const bool onDisk = ( outOfCore && outOfCore->OnDisk(s) );
+        const double m = 
+          ( onDisk ? outOfCore->Height(s) : front.frontL.Height() );
+        const double n = 
+          ( onDisk ? outOfCore->Width(s) : front.frontL.Width() );
         numLocalFlops += n*n;
         numLocalFlops += 2*(m-n)*n;
     }
@@ -626,6 +636,68 @@ void DistSymmFrontTree<T>::SolveWork
     numGlobalFlops = mpi::AllReduce( numLocalFlops, mpi::SUM, comm );
 }
 
+template<typename T>
+void DistSymmFrontTree<T>::EnableOutOfCore( const OutOfCoreCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSymmFrontTree::EnableOutOfCore"))
+    const bool frontsAre1d = FrontsAre1d( frontType );
+    const Grid& grid = ( frontsAre1d ? distFronts.back().front1dL.Grid() 
+                                     : distFronts.back().front2dL.Grid() );
+    outOfCore = std::make_shared<FrontStore<T>>( ctrl, grid.Comm() );
+}
+
+template<typename T>
+void DistSymmFrontTree<T>::DisableOutOfCore()
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSymmFrontTree::DisableOutOfCore"))
+    outOfCore.reset();
+}
+
+template<typename T>
+void DistSymmFrontTree<T>::IOStats( std::vector<FrontIOStats>& stats ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSymmFrontTree::IOStats"))
+    if( outOfCore )
+        stats = outOfCore->Stats();
+    else
+        stats.assign( localFronts.size(), FrontIOStats() );
+}
+
+template<typename T>
+void DistSymmFrontTree<T>::PrintIOStats
+( mpi::Comm comm, std::ostream& os ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSymmFrontTree::PrintIOStats"))
+    std::vector<FrontIOStats> stats;
+    IOStats( stats );
+    double local[7] = { 0, 0, 0, 0, 0, 0, 0 };
+    for( const FrontIOStats& front : stats )
+    {
+        local[0] += front.bytes;
+        local[1] += front.numWrites;
+        local[2] += front.numReads;
+        local[3] += front.numPrefetches;
+        local[4] += front.writeTime;
+        local[5] += front.readTime;
+        local[6] += front.waitTime;
+    }
+    double sums[7], maxs[7];
+    mpi::AllReduce( local, sums, 7, mpi::SUM, comm );
+    mpi::AllReduce( local, maxs, 7, mpi::MAX, comm );
+    if( mpi::Rank(comm) == 0 )
+    {
+        os << "Out-of-core fronts (total / max over processes):\n"
+           << "  bytes written: " << sums[0] << " / " << maxs[0] << "\n"
+           << "  writes: " << sums[1] << " / " << maxs[1] << "\n"
+           << "  reads: " << sums[2] << " / " << maxs[2] 
+           << " (" << sums[3] << " prefetched)\n"
+           << "  write time: " << sums[4] << " / " << maxs[4] << " secs\n"
+           << "  read time: " << sums[5] << " / " << maxs[5] << " secs\n"
+           << "  prefetch wait time: " << sums[6] << " / " << maxs[6] 
+           << " secs" << std::endl;
+    }
+}
+
 #define PROTO(T) template class DistSymmFrontTree<T>;
 #include "El/macros/Instantiate.h"
 
@@ -0,0 +1,298 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+#include <atomic>
+
+#include "./FrontStore.hpp"
+
+namespace {
+// Stores may be created from several threads at once
+std::atomic<int> numStores(0);
+} // anonymous namespace
+
+namespace El {
+
+template<typename T>
+FrontStore<T>::FrontStore( const OutOfCoreCtrl& ctrl, mpi::Comm comm )
+: ctrl_(ctrl), fileSize_(0), residentBytes_(0), nextAlloc_(0),
+  numAhead_(0), stopping_(false)
+{
+    DEBUG_ONLY(CallStackEntry cse("FrontStore::FrontStore"))
+    std::ostringstream os;
+    os << ctrl.directory << "/El-fronts-" << mpi::Rank(comm) << "-"
+       << ::numStores++ << ".bin";
+    filename_ = os.str();
+    file_.open
+    ( filename_.c_str(),
+      std::ios::in | std::ios::out | std::ios::binary | std::ios::trunc );
+    if( !file_.is_open() )
+        RuntimeError("Could not open ",filename_);
+}
+
+template<typename T>
+FrontStore<T>::~FrontStore()
+{
+    StopPrefetch();
+    file_.close();
+    std::remove( filename_.c_str() );
+}
+
+template<typename T>
+void FrontStore<T>::Reset( int numFronts )
+{
+    DEBUG_ONLY(CallStackEntry cse("FrontStore::Reset"))
+    StopPrefetch();
+    fileSize_ = 0;
+    residentBytes_ = 0;
+    onDisk_.assign( numFronts, false );
+    offsets_.assign( numFronts, 0 );
+    heights_.assign( numFronts, 0 );
+    widths_.assign( numFronts, 0 );
+    stats_.assign( numFronts, FrontIOStats() );
+    copies_.clear();
+    copies_.resize( numFronts );
+    ready_.assign( numFronts, false );
+    queued_.assign( numFronts, false );
+    allocated_.assign( numFronts, false );
+    buffers_.assign( numFronts, nullptr );
+    error_ = nullptr;
+}
+
+template<typename T>
+void FrontStore<T>::Finish( int s, Matrix<T>& frontL )
+{
+    DEBUG_ONLY(CallStackEntry cse("FrontStore::Finish"))
+    const Int height = frontL.Height();
+    const Int width = frontL.Width();
+    const double bytes = double(height)*width*sizeof(T);
+
+    // The fronts of separate subtrees may be finished concurrently
+    std::lock_guard<std::mutex> lock( mutex_ );
+    heights_[s] = height;
+    widths_[s] = width;
+    const int numFronts = onDisk_.size();
+    if( s == numFronts-1 || residentBytes_+bytes <= ctrl_.memoryBudget )
+    {
+        residentBytes_ += bytes;
+        return;
+    }
+
+    Timer timer;
+    timer.Start();
+    offsets_[s] = fileSize_;
+    file_.seekp( fileSize_ );
+    for( Int j=0; j<width; ++j )
+        file_.write
+        ( (const char*)frontL.LockedBuffer(0,j), height*sizeof(T) );
+    if( !file_ )
+        RuntimeError("Could not write front ",s," to ",filename_);
+    fileSize_ += height*width*sizeof(T);
+    onDisk_[s] = true;
+    frontL.Empty();
+
+    FrontIOStats& stats = stats_[s];
+    stats.bytes = bytes;
+    ++stats.numWrites;
+    stats.writeTime += timer.Stop();
+}
+
+// Read front s into a (height x width, column-major) buffer. This is called
+// by the prefetcher, and so it must not call into the rest of the library.
+template<typename T>
+void FrontStore<T>::Read( std::fstream& file, int s, T* buffer )
+{
+    file.seekg( offsets_[s] );
+    file.read( (char*)buffer, heights_[s]*widths_[s]*sizeof(T) );
+    if( !file )
+        RuntimeError("Could not read front ",s," from ",filename_);
+}
+
+// Allocate the copies of the next queued fronts, up to the prefetch depth
+// (the mutex must be held)
+template<typename T>
+void FrontStore<T>::AllocateAhead()
+{
+    while( numAhead_ < ctrl_.prefetchDepth && nextAlloc_ < order_.size() )
+    {
+        const int s = order_[nextAlloc_++];
+        if( !queued_[s] )
+            continue;
+        const Int height = heights_[s];
+        copies_[s].Resize( height, widths_[s], Max(height,1) );
+        buffers_[s] = copies_[s].Buffer();
+        allocated_[s] = true;
+        residentBytes_ += Bytes( s );
+        ++numAhead_;
+    }
+}
+
+template<typename T>
+void FrontStore<T>::StartPrefetch( const std::vector<int>& order )
+{
+    DEBUG_ONLY(CallStackEntry cse("FrontStore::StartPrefetch"))
+    StopPrefetch();
+    if( ctrl_.prefetchDepth <= 0 )
+        return;
+
+    // The prefetcher reads through its own stream, which would not see any
+    // fronts still buffered within ours
+    file_.flush();
+    if( !file_ )
+        RuntimeError("Could not flush ",filename_);
+
+    for( const int s : order )
+        queued_[s] = onDisk_[s];
+    order_ = order;
+    nextAlloc_ = 0;
+    AllocateAhead();
+    prefetcher_ = std::thread( &FrontStore<T>::PrefetchLoop, this, order );
+}
+
+template<typename T>
+void FrontStore<T>::StopPrefetch()
+{
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        stopping_ = true;
+    }
+    changed_.notify_all();
+    if( prefetcher_.joinable() )
+        prefetcher_.join();
+
+    stopping_ = false;
+    numAhead_ = 0;
+    order_.clear();
+    nextAlloc_ = 0;
+    const int numFronts = onDisk_.size();
+    for( int s=0; s<numFronts; ++s )
+    {
+        if( queued_[s] )
+        {
+            if( allocated_[s] )
+                residentBytes_ -= Bytes( s );
+            copies_[s].Empty();
+            ready_[s] = false;
+            queued_[s] = false;
+            allocated_[s] = false;
+            buffers_[s] = nullptr;
+        }
+    }
+}
+
+template<typename T>
+void FrontStore<T>::PrefetchLoop( std::vector<int> order )
+{
+    try
+    {
+        std::fstream file( filename_.c_str(), std::ios::in | std::ios::binary );
+        if( !file.is_open() )
+            RuntimeError("Could not open ",filename_);
+        for( const int s : order )
+        {
+            T* buffer;
+            {
+                std::unique_lock<std::mutex> lock( mutex_ );
+                if( !queued_[s] )
+                    continue;
+                changed_.wait
+                ( lock, [&]() { return stopping_ || allocated_[s]; } );
+                if( stopping_ )
+                    return;
+                buffer = buffers_[s];
+            }
+
+            Timer timer;
+            timer.Start();
+            Read( file, s, buffer );
+            const double readTime = timer.Stop();
+
+            {
+                std::lock_guard<std::mutex> lock( mutex_ );
+                ready_[s] = true;
+                FrontIOStats& stats = stats_[s];
+                ++stats.numReads;
+                ++stats.numPrefetches;
+                stats.readTime += readTime;
+            }
+            changed_.notify_all();
+        }
+    }
+    catch( ... )
+    {
+        {
+            std::lock_guard<std::mutex> lock( mutex_ );
+            error_ = std::current_exception();
+        }
+        changed_.notify_all();
+    }
+}
+
+template<typename T>
+const Matrix<T>& FrontStore<T>::Acquire( int s, const Matrix<T>& frontL )
+{
+    DEBUG_ONLY(CallStackEntry cse("FrontStore::Acquire"))
+    if( !onDisk_[s] )
+        return frontL;
+
+    std::unique_lock<std::mutex> lock( mutex_ );
+    FrontIOStats& stats = stats_[s];
+    Timer timer;
+    timer.Start();
+    if( queued_[s] )
+    {
+        changed_.wait( lock, [&]() { return ready_[s] || error_; } );
+        if( error_ )
+            std::rethrow_exception( error_ );
+        stats.waitTime += timer.Stop();
+    }
+    else if( !ready_[s] )
+    {
+        // Fronts which were not prefetched are read while holding the lock,
+        // since the subtrees may be traversed concurrently
+        const Int height = heights_[s];
+        copies_[s].Resize( height, widths_[s], Max(height,1) );
+        Read( file_, s, copies_[s].Buffer() );
+        ready_[s] = true;
+        residentBytes_ += Bytes( s );
+        ++stats.numReads;
+        stats.readTime += timer.Stop();
+    }
+    return copies_[s];
+}
+
+template<typename T>
+void FrontStore<T>::Release( int s )
+{
+    DEBUG_ONLY(CallStackEntry cse("FrontStore::Release"))
+    if( !onDisk_[s] )
+        return;
+    {
+        std::lock_guard<std::mutex> lock( mutex_ );
+        if( ready_[s] || allocated_[s] )
+            residentBytes_ -= Bytes( s );
+        copies_[s].Empty();
+        ready_[s] = false;
+        if( queued_[s] )
+        {
+            queued_[s] = false;
+            allocated_[s] = false;
+            buffers_[s] = nullptr;
+            --numAhead_;
+            AllocateAhead();
+        }
+    }
+    changed_.notify_all();
+}
+
+#define PROTO(T) template class FrontStore<T>;
+#include "El/macros/Instantiate.h"
+
+} // namespace El
@@ -0,0 +1,101 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SPARSEDIRECT_NUMERIC_FRONTSTORE_HPP
+#define EL_SPARSEDIRECT_NUMERIC_FRONTSTORE_HPP
+
+#include <condition_variable>
+#include <exception>
+#include <mutex>
+#include <thread>
+
+namespace El {
+
+// The out-of-core storage of the factored local fronts of a DistSymmFrontTree
+// (see OutOfCoreCtrl). Each process appends the fronts which it writes out to
+// its own file, which is removed along with the store.
+template<typename T>
+class FrontStore
+{
+public:
+    FrontStore( const OutOfCoreCtrl& ctrl, mpi::Comm comm );
+    ~FrontStore();
+
+    // Forget the fronts written out by any previous factorization
+    void Reset( int numFronts );
+
+    // Called once local front s is factored: write it out and free it if
+    // keeping it would exceed the memory budget. The local root is always
+    // kept since the bottom distributed front is a view of it.
+    void Finish( int s, Matrix<T>& frontL );
+
+    bool OnDisk( int s ) const 
+    { return s < int(onDisk_.size()) && onDisk_[s]; }
+    Int Height( int s ) const { return heights_[s]; }
+    Int Width( int s ) const { return widths_[s]; }
+
+    // Read the fronts which were written out, in the order that they will be
+    // acquired, in a background thread which stays at most 'prefetchDepth'
+    // fronts ahead of the releases
+    void StartPrefetch( const std::vector<int>& order );
+    void StopPrefetch();
+
+    // Return front s, reading it back in if it was written out (unless it was
+    // already prefetched), where 'frontL' is the front as held by the tree
+    const Matrix<T>& Acquire( int s, const Matrix<T>& frontL );
+    // Free the copy of front s which was read back in (if any)
+    void Release( int s );
+
+    const std::vector<FrontIOStats>& Stats() const { return stats_; }
+
+private:
+    OutOfCoreCtrl ctrl_;
+    std::string filename_;
+    std::fstream file_;
+    std::size_t fileSize_;
+    // The bytes of the fronts which were kept in memory, plus those of the
+    // copies which are currently read back in (or allocated for prefetching)
+    double residentBytes_;
+
+    std::vector<bool> onDisk_;
+    std::vector<std::size_t> offsets_;
+    std::vector<Int> heights_, widths_;
+    std::vector<FrontIOStats> stats_;
+
+    // The fronts which were read back in, and whether each is ready
+    std::vector<Matrix<T>> copies_;
+    std::vector<bool> ready_, queued_;
+
+    // The copies of the prefetched fronts are allocated by the threads which
+    // start the prefetch and release fronts (rather than by the prefetcher,
+    // which only reads into the raw buffers), at most 'prefetchDepth' ahead
+    std::vector<int> order_;
+    std::size_t nextAlloc_;
+    std::vector<bool> allocated_;
+    std::vector<T*> buffers_;
+
+    std::mutex mutex_;
+    std::condition_variable changed_;
+    std::thread prefetcher_;
+    int numAhead_;
+    bool stopping_;
+    std::exception_ptr error_;
+
+    double Bytes( int s ) const
+    { return double(heights_[s])*widths_[s]*sizeof(T); }
+    void Read( std::fstream& file, int s, T* buffer );
+    void AllocateAhead();
+    void PrefetchLoop( std::vector<int> order );
+};
+
+} // namespace El
+
+#endif // ifndef EL_SPARSEDIRECT_NUMERIC_FRONTSTORE_HPP
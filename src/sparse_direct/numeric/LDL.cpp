@@ -13,6 +13,8 @@
 #include "./LDL/Front.hpp"
 #include "./LDL/FrontBlock.hpp"
 
+#include "./LocalTree.hpp"
+#include "./FrontStore.hpp"
 #include "./LDL/Local.hpp"
 #include "./LDL/Dist.hpp"
 
@@ -37,6 +39,7 @@ void
 LDL( DistSymmInfo& info, DistSymmFrontTree<F>& L, SymmFrontType newFrontType )
 {
     DEBUG_ONLY(CallStackEntry cse("LDL"))
+    ScopedTimer timer("LDL");
     if( !Unfactored(L.frontType) )
         LogicError("Matrix is already factored");
 
@@ -19,6 +19,7 @@ inline void
 DistLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
 {
     DEBUG_ONLY(CallStackEntry cse("DistLDL"))
+    ScopedTimer timer("DistLDL");
     const SymmFrontType type = L.frontType;
     const bool blocked = BlockFactorization(type);
     const bool pivoted = PivotedFactorization(type);
@@ -171,22 +172,34 @@ DistLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
             const F* recvVals = &recvBuffer[recvDispls[proc]];
             const std::vector<Int>& recvInds = commMeta.childRecvInds[proc];
             const Int numRecvIndPairs = recvInds.size()/2;
-            for( Int k=0; k<numRecvIndPairs; ++k )
+            // The values from each process are packed a column at a time, so
+            // the target column only needs to be found once per column
+            for( Int k=0; k<numRecvIndPairs; )
             {
-                const Int iFrontLoc = recvInds[2*k+0];
                 const Int jFrontLoc = recvInds[2*k+1];
-                const F value = recvVals[k];
-                DEBUG_ONLY(
-                    const Int iFront = grid.Row() + iFrontLoc*gridHeight;
-                    const Int jFront = grid.Col() + jFrontLoc*gridWidth;
-                    if( iFront < jFront )
-                        LogicError("Tried to update upper triangle");
-                )
+                F* target;
+                Int targetOff;
                 if( jFrontLoc < leftLocWidth )
-                    front.front2dL.UpdateLocal( iFrontLoc, jFrontLoc, value );
+                {
+                    target = front.front2dL.Buffer(0,jFrontLoc);
+                    targetOff = 0;
+                }
                 else
-                    front.work2d.UpdateLocal
-                    ( iFrontLoc-topLocHeight, jFrontLoc-leftLocWidth, value );
+                {
+                    target = front.work2d.Buffer(0,jFrontLoc-leftLocWidth);
+                    targetOff = topLocHeight;
+                }
+                for( ; k<numRecvIndPairs && recvInds[2*k+1]==jFrontLoc; ++k )
+                {
+                    const Int iFrontLoc = recvInds[2*k+0];
+                    DEBUG_ONLY(
+                        const Int iFront = grid.Row() + iFrontLoc*gridHeight;
+                        const Int jFront = grid.Col() + jFrontLoc*gridWidth;
+                        if( iFront < jFront )
+                            LogicError("Tried to update upper triangle");
+                    )
+                    target[iFrontLoc-targetOff] += recvVals[k];
+                }
             }
         }
         SwapClear( recvBuffer );
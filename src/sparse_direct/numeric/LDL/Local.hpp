@@ -14,19 +14,177 @@
 
 namespace El {
 
+// Add the lower triangle of a child's update matrix onto the front. The
+// relative indices usually form long runs of consecutive indices, and each
+// such run of a column is added with a single contiguous loop. Since the
+// indices are increasing, a column of the update maps either entirely into
+// frontL or entirely into frontBR.
+template<typename F>
+inline void
+ExtendAdd
+( const Matrix<F>& update, const std::vector<int>& relInds, int nodeSize,
+  Matrix<F>& frontL, Matrix<F>& frontBR )
+{
+    DEBUG_ONLY(CallStackEntry cse("ExtendAdd"))
+    const int updateSize = update.Height();
+    std::vector<int> runEnds( updateSize );
+    for( int i=updateSize-1; i>=0; --i )
+        runEnds[i] = 
+          ( i+1<updateSize && relInds[i+1]==relInds[i]+1 ? runEnds[i+1] : i+1 );
+
+    for( int jChild=0; jChild<updateSize; ++jChild )
+    {
+        const int jFront = relInds[jChild];
+        const F* source = update.LockedBuffer(0,jChild);
+        F* target;
+        int targetOff;
+        if( jFront < nodeSize )
+        {
+            target = frontL.Buffer(0,jFront);
+            targetOff = 0;
+        }
+        else
+        {
+            target = frontBR.Buffer(0,jFront-nodeSize);
+            targetOff = nodeSize;
+        }
+        for( int iChild=jChild; iChild<updateSize; iChild=runEnds[iChild] )
+        {
+            const int runSize = runEnds[iChild]-iChild;
+            const F* runSource = &source[iChild];
+            F* runTarget = &target[relInds[iChild]-targetOff];
+            for( int k=0; k<runSize; ++k )
+                runTarget[k] += runSource[k];
+        }
+    }
+}
+
+// Since the local fronts are factored in postorder, the update matrices of the
+// children of a front are the most recently formed ones that have not yet been
+// consumed, and so (within each thread) they can be kept on a stack rather than
+// being allocated and freed one at a time
+template<typename F>
+class UpdateStack
+{
+public:
+    // Grow the (empty) stack to hold at least 'capacity' entries
+    void Reserve( Int capacity )
+    {
+        DEBUG_ONLY(
+            if( size_ != 0 )
+                LogicError("Only an empty update stack may be reserved");
+        )
+        memory_.Require( capacity );
+        size_ = 0;
+    }
+
+    Int Size() const { return size_; }
+
+    // Attach U to an n x n buffer on the top of the stack
+    void Push( Int n, Matrix<F>& U )
+    {
+        DEBUG_ONLY(
+            if( size_+n*n > Int(memory_.Size()) )
+                LogicError("Update stack overflow");
+        )
+        U.Attach( n, n, memory_.Buffer()+size_, Max(n,1) );
+        size_ += n*n;
+    }
+
+    // Release everything above 'base'
+    void Pop( Int base ) { size_ = base; }
+
+    // Release everything above 'base' except for U, which is on the top of
+    // the stack and is moved down to start at 'base'
+    void Collapse( Int base, Matrix<F>& U )
+    {
+        const Int n = U.Height();
+        F* buffer = memory_.Buffer()+base;
+        if( buffer != U.LockedBuffer() )
+        {
+            // The target starts before the source, so a forward copy is safe
+            std::copy( U.LockedBuffer(), U.LockedBuffer()+n*n, buffer );
+            U.Attach( n, n, buffer, Max(n,1) );
+        }
+        size_ = base + n*n;
+    }
+
+private:
+    Memory<F> memory_;
+    Int size_=0;
+};
+
 template<typename F> 
 inline void 
 LocalLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
 {
     DEBUG_ONLY(CallStackEntry cse("LocalLDL"))
+    ScopedTimer timer("LocalLDL");
     const bool blockLDL = ( L.frontType == BLOCK_LDL_2D ||
                             L.frontType == BLOCK_LDL_INTRAPIV_2D );
     const bool intraPiv = ( L.frontType == LDL_INTRAPIV_2D || 
                             L.frontType == BLOCK_LDL_INTRAPIV_2D );
-
     const int numLocalNodes = info.localNodes.size();
-    for( int s=0; s<numLocalNodes; ++s )
+
+    LocalSubtrees subtrees;
+    PartitionLocalTree( info, subtrees );
+    if( L.outOfCore )
+        L.outOfCore->Reset( numLocalNodes );
+
+    // The updates of the roots of the subtrees are consumed by the top of the
+    // tree after every subtree has been factored, and that of the local root
+    // by the distributed factorization, so they are allocated separately
+    std::vector<bool> stacked( numLocalNodes, true );
+    for( const int root : subtrees.roots )
+        stacked[root] = false;
+    if( numLocalNodes > 0 )
+        stacked.back() = false;
+
+    // Each thread factors whole subtrees (and the main thread then factors the
+    // top of the tree), so the stack of each thread only needs to hold the
+    // updates of a single subtree at a time. Since the subtrees are assigned
+    // to threads dynamically, each stack is grown (if necessary) to the peak
+    // of a subtree as the subtree is started, at which point it is empty.
+    auto stackSize = [&]( int s ) -> Int
+    {
+        const Int updateSize = info.localNodes[s].lowerStruct.size();
+        return ( stacked[s] ? updateSize*updateSize : 0 );
+    };
+    auto stackPeak = [&]( const std::vector<int>& nodes ) -> Int
     {
+        Int size=0, peak=0;
+        for( const int s : nodes )
+        {
+            // This update is formed on top of those of its children
+            peak = Max( peak, size+stackSize(s) );
+            for( const int child : info.localNodes[s].children )
+                size -= stackSize(child);
+            size += stackSize(s);
+        }
+        return peak;
+    };
+    std::vector<Int> reserveAt( numLocalNodes, -1 );
+    const int numSubtrees = subtrees.roots.size();
+    for( int t=0; t<numSubtrees; ++t )
+    {
+        std::vector<int> nodes;
+        for( int s=subtrees.firsts[t]; s<=subtrees.roots[t]; ++s )
+            nodes.push_back( s );
+        reserveAt[subtrees.firsts[t]] = stackPeak( nodes );
+    }
+    if( subtrees.top.size() > 0 )
+        reserveAt[subtrees.top[0]] = stackPeak( subtrees.top );
+    std::vector<UpdateStack<F>> stacks( numSubtrees>0 ? NumThreads() : 1 );
+
+    auto factor = [&]( int s )
+    {
+#ifdef EL_HAVE_OPENMP
+        UpdateStack<F>& stack = stacks[omp_get_thread_num()];
+#else
+        UpdateStack<F>& stack = stacks[0];
+#endif
+        if( reserveAt[s] >= 0 )
+            stack.Reserve( reserveAt[s] );
         SymmNodeInfo& node = info.localNodes[s];
         const int updateSize = node.lowerStruct.size();
         SymmFront<F>& front = L.localFronts[s];
@@ -39,8 +197,19 @@ LocalLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
                 LogicError("Front was not the proper size");
         )
 
+        // The stacked updates of the children are directly below this one
+        Int base = stack.Size();
+        for( const int child : node.children )
+            base -= stackSize(child);
+        if( stacked[s] )
+        {
+            stack.Push( updateSize, frontBR );
+            Zero( frontBR );
+        }
+        else
+            Zeros( frontBR, updateSize, updateSize );
+
         // Add updates from children (if they exist)
-        Zeros( frontBR, updateSize, updateSize );
         const int numChildren = node.children.size();
         if( numChildren == 2 )
         {
@@ -48,51 +217,19 @@ LocalLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
             const int rightInd = node.children[1];
             Matrix<F>& leftUpdate = L.localFronts[leftInd].work;
             Matrix<F>& rightUpdate = L.localFronts[rightInd].work;
+            ExtendAdd( leftUpdate, node.leftRelInds, node.size, frontL, frontBR );
+            ExtendAdd
+            ( rightUpdate, node.rightRelInds, node.size, frontL, frontBR );
 
-            // Add the left child's update matrix
-            const int leftUpdateSize = leftUpdate.Height();
-            for( int jChild=0; jChild<leftUpdateSize; ++jChild )
-            {
-                const int jFront = node.leftRelInds[jChild];
-                for( int iChild=jChild; iChild<leftUpdateSize; ++iChild )
-                {
-                    const int iFront = node.leftRelInds[iChild];
-                    const F value = leftUpdate.Get(iChild,jChild);
-                    DEBUG_ONLY(
-                        if( iFront < jFront )
-                            LogicError("Tried to update upper triangle");
-                    )
-                    if( jFront < node.size )
-                        frontL.Update( iFront, jFront, value );
-                    else if( iFront >= node.size )
-                        frontBR.Update
-                        ( iFront-node.size, jFront-node.size, value );
-                }
-            }
-            leftUpdate.Empty();
-
-            // Add the right child's update matrix
-            const int rightUpdateSize = rightUpdate.Height();
-            for( int jChild=0; jChild<rightUpdateSize; ++jChild )
-            {
-                const int jFront = node.rightRelInds[jChild];
-                for( int iChild=jChild; iChild<rightUpdateSize; ++iChild )
-                {
-                    const int iFront = node.rightRelInds[iChild];
-                    const F value = rightUpdate.Get(iChild,jChild);
-                    DEBUG_ONLY(
-                        if( iFront < jFront )
-                            LogicError("Tried to update upper triangle");
-                    )
-                    if( jFront < node.size )
-                        frontL.Update( iFront, jFront, value );
-                    else if( iFront >= node.size )
-                        frontBR.Update
-                        ( iFront-node.size, jFront-node.size, value );
-                }
-            }
-            rightUpdate.Empty();
+            // Free the children's updates, where those on the stack are
+            // returned to (empty) owners so that they may later be resized
+            leftUpdate.Control( 0, 0, nullptr, 1 );
+            rightUpdate.Control( 0, 0, nullptr, 1 );
         }
+        if( stacked[s] )
+            stack.Collapse( base, frontBR );
+        else
+            stack.Pop( base );
 
         // Call the custom partial LDL
         if( blockLDL )
@@ -110,7 +247,10 @@ LocalLDL( DistSymmInfo& info, DistSymmFrontTree<F>& L )
             frontL.GetDiagonal( front.diag );
             SetDiagonal( frontL, F(1) );
         }
-    }
+        if( L.outOfCore )
+            L.outOfCore->Finish( s, frontL );
+    };
+    TraverseUp( subtrees, factor );
 }
 
 } // namespace El
@@ -0,0 +1,214 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SPARSEDIRECT_NUMERIC_LOCALTREE_HPP
+#define EL_SPARSEDIRECT_NUMERIC_LOCALTREE_HPP
+
+#include <exception>
+
+// The local elimination tree is split into disjoint subtrees, which do not
+// depend upon each other and are traversed as separate OpenMP tasks, and the
+// nodes above them, which are traversed one at a time (outside of any parallel
+// region) so that their larger fronts can make use of a threaded BLAS. Since
+// the local tree is postordered, each subtree is the contiguous range of nodes
+// which ends at its root.
+
+namespace El {
+
+struct LocalSubtrees
+{
+    // The first node and root of each subtree, in order of decreasing work
+    std::vector<int> firsts, roots;
+
+    // The nodes above the subtrees, in postorder (ending with the local root)
+    std::vector<int> top;
+
+    // Whether each node is the last child of its parent to be visited by a
+    // top-down traversal within the same thread, and may therefore free the
+    // parent's workspace
+    std::vector<bool> freesParent;
+};
+
+// A rough estimate of the cost of processing a front, which is dominated by
+// its partial factorization
+inline double
+LocalNodeWork( const SymmNodeInfo& node )
+{
+    const double n = node.size;
+    const double u = node.lowerStruct.size();
+    return n*n*n/3 + n*n*u + n*u*u;
+}
+
+// If 'parallel' is false, every node is placed in the top of the tree so that
+// the traversals visit the nodes in (reverse) postorder
+inline void
+PartitionLocalTree
+( const DistSymmInfo& info, LocalSubtrees& subtrees, bool parallel=true )
+{
+    DEBUG_ONLY(CallStackEntry cse("PartitionLocalTree"))
+    const int numLocalNodes = info.localNodes.size();
+    const int numThreads = NumThreads();
+    subtrees.firsts.clear();
+    subtrees.roots.clear();
+    subtrees.top.clear();
+    subtrees.freesParent.assign( numLocalNodes, false );
+    if( numLocalNodes == 0 )
+        return;
+
+    std::vector<int> firsts( numLocalNodes );
+    std::vector<double> work( numLocalNodes );
+    for( int s=0; s<numLocalNodes; ++s )
+    {
+        const SymmNodeInfo& node = info.localNodes[s];
+        firsts[s] = s;
+        work[s] = LocalNodeWork( node );
+        for( const int child : node.children )
+        {
+            firsts[s] = Min( firsts[s], firsts[child] );
+            work[s] += work[child];
+        }
+    }
+
+    // Repeatedly move the root of the most expensive subtree into the top of
+    // the tree until there are enough subtrees to keep each thread busy and no
+    // single subtree is more than a thread's share of the work
+    std::vector<bool> inTop( numLocalNodes, false ), isRoot( numLocalNodes );
+    std::vector<int> layer;
+    if( !parallel || numThreads == 1 || numLocalNodes == 1 )
+        inTop.assign( numLocalNodes, true );
+    else
+        layer.push_back( numLocalNodes-1 );
+    while( !layer.empty() )
+    {
+        double layerWork = 0;
+        int heaviest = 0;
+        for( int t=0; t<int(layer.size()); ++t )
+        {
+            layerWork += work[layer[t]];
+            if( work[layer[t]] > work[layer[heaviest]] )
+                heaviest = t;
+        }
+        const SymmNodeInfo& node = info.localNodes[layer[heaviest]];
+        if( node.children.empty() )
+            break;
+        if( int(layer.size()) >= 2*numThreads &&
+            work[layer[heaviest]] <= layerWork/numThreads )
+            break;
+        inTop[layer[heaviest]] = true;
+        layer.erase( layer.begin()+heaviest );
+        layer.insert( layer.end(), node.children.begin(), node.children.end() );
+    }
+    std::sort
+    ( layer.begin(), layer.end(),
+      [&]( int a, int b ) { return work[a] > work[b]; } );
+    for( const int root : layer )
+    {
+        subtrees.firsts.push_back( firsts[root] );
+        subtrees.roots.push_back( root );
+        isRoot[root] = true;
+    }
+    for( int s=0; s<numLocalNodes; ++s )
+        if( inTop[s] )
+            subtrees.top.push_back( s );
+
+    // Within a subtree (or the top), the left child is numbered lower than the
+    // right child, and so it is visited last
+    for( int s=0; s<numLocalNodes-1; ++s )
+    {
+        const SymmNodeInfo& node = info.localNodes[s];
+        if( !node.onLeft || isRoot[s] )
+            continue;
+        const int sibling = info.localNodes[node.parent].children[1];
+        subtrees.freesParent[s] = ( !inTop[s] || inTop[sibling] );
+    }
+}
+
+// Visit each node after its children
+template<typename Function>
+inline void
+TraverseUp( const LocalSubtrees& subtrees, Function visit )
+{
+    DEBUG_ONLY(CallStackEntry cse("TraverseUp"))
+    const int numSubtrees = subtrees.roots.size();
+#ifdef EL_HAVE_OPENMP
+    std::exception_ptr error;
+    #pragma omp parallel
+    #pragma omp single
+    for( int t=0; t<numSubtrees; ++t )
+    {
+        #pragma omp task
+        try
+        {
+            for( int s=subtrees.firsts[t]; s<=subtrees.roots[t]; ++s )
+                visit( s );
+        }
+        catch( ... )
+        {
+            #pragma omp critical
+            if( !error )
+                error = std::current_exception();
+        }
+    }
+    if( error )
+        std::rethrow_exception( error );
+#else
+    for( int t=0; t<numSubtrees; ++t )
+        for( int s=subtrees.firsts[t]; s<=subtrees.roots[t]; ++s )
+            visit( s );
+#endif
+    for( const int s : subtrees.top )
+        visit( s );
+}
+
+// Visit each node other than the local root after its parent, where 'visit'
+// is also passed whether the node may free its parent's workspace
+template<typename Function>
+inline void
+TraverseDown( const LocalSubtrees& subtrees, Function visit )
+{
+    DEBUG_ONLY(CallStackEntry cse("TraverseDown"))
+    const int numSubtrees = subtrees.roots.size();
+    for( int k=int(subtrees.top.size())-2; k>=0; --k )
+    {
+        const int s = subtrees.top[k];
+        visit( s, bool(subtrees.freesParent[s]) );
+    }
+#ifdef EL_HAVE_OPENMP
+    std::exception_ptr error;
+    #pragma omp parallel
+    #pragma omp single
+    for( int t=0; t<numSubtrees; ++t )
+    {
+        #pragma omp task
+        try
+        {
+            for( int s=subtrees.roots[t]; s>=subtrees.firsts[t]; --s )
+                visit( s, bool(subtrees.freesParent[s]) );
+        }
+        catch( ... )
+        {
+            #pragma omp critical
+            if( !error )
+                error = std::current_exception();
+        }
+    }
+    if( error )
+        std::rethrow_exception( error );
+#else
+    for( int t=0; t<numSubtrees; ++t )
+        for( int s=subtrees.roots[t]; s>=subtrees.firsts[t]; --s )
+            visit( s, bool(subtrees.freesParent[s]) );
+#endif
+}
+
+} // namespace El
+
+#endif // ifndef EL_SPARSEDIRECT_NUMERIC_LOCALTREE_HPP
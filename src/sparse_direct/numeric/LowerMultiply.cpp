@@ -12,6 +12,8 @@
 
 #include "./LowerMultiply/Front.hpp"
 
+#include "./LocalTree.hpp"
+#include "./FrontStore.hpp"
 #include "./LowerMultiply/Local.hpp"
 #include "./LowerMultiply/Dist.hpp"
 
@@ -20,12 +20,13 @@ inline void LocalLowerMultiplyNormal
   const DistSymmFrontTree<T>& L, DistNodalMultiVec<T>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("LocalLowerMultiplyNormal"))
-    const int numLocalNodes = info.localNodes.size();
     const int width = X.Width();
-    for( int s=0; s<numLocalNodes; ++s )
+    auto multiply = [&]( int s )
     {
         const SymmNodeInfo& node = info.localNodes[s];
-        const Matrix<T>& frontL = L.localFronts[s].frontL;
+        const Matrix<T>& frontL = 
+          ( L.outOfCore ? L.outOfCore->Acquire( s, L.localFronts[s].frontL )
+                        : L.localFronts[s].frontL );
         Matrix<T>& W = L.localFronts[s].work;
 
         // Set up a workspace
@@ -79,7 +80,13 @@ inline void LocalLowerMultiplyNormal
 
         // Store this node's portion of the result
         X.localNodes[s] = WT;
-    }
+        if( L.outOfCore )
+            L.outOfCore->Release( s );
+    };
+
+    LocalSubtrees subtrees;
+    PartitionLocalTree( info, subtrees );
+    TraverseUp( subtrees, multiply );
 }
 
 template<typename T> 
@@ -93,10 +100,12 @@ inline void LocalLowerMultiplyTranspose
     const int width = X.Width();
     const Orientation orientation = ( conjugate ? ADJOINT : TRANSPOSE );
 
-    for( int s=numLocalNodes-2; s>=0; --s )
+    auto multiply = [&]( int s, bool freeParent )
     {
         const SymmNodeInfo& node = info.localNodes[s];
-        const Matrix<T>& frontL = L.localFronts[s].frontL;
+        const Matrix<T>& frontL = 
+          ( L.outOfCore ? L.outOfCore->Acquire( s, L.localFronts[s].frontL )
+                        : L.localFronts[s].frontL );
         Matrix<T>& W = L.localFronts[s].work;
 
         // Set up a workspace
@@ -119,9 +128,8 @@ inline void LocalLowerMultiplyTranspose
                 WB.Set( iCurrent, j, parentWork.Get(iParent,j) );
         }
 
-        // The left child is numbered lower than the right child, so we can 
-        // safely free the parent's work if this node is the left child
-        if( node.onLeft )
+        // Free the parent's work if no other node still needs it
+        if( freeParent )
         {
             parentWork.Empty();
             if( parent == numLocalNodes-1 )
@@ -134,15 +142,24 @@ inline void LocalLowerMultiplyTranspose
         // Multiply the (conjugate-)transpose of this block column of L against
         // this node's portion of the right-hand side.
         FrontLowerMultiply( orientation, diagOff, frontL, XNode );
+        if( L.outOfCore )
+            L.outOfCore->Release( s );
 
         // Store this node's portion of the result
         Matrix<T> XNodeT, XNodeB;
         PartitionDown( XNode, XNodeT, XNodeB, node.size );
         X.localNodes[s] = XNodeT;
         XNode.Empty();
-    }
+    };
+
+    LocalSubtrees subtrees;
+    PartitionLocalTree( info, subtrees );
+    TraverseDown( subtrees, multiply );
+
+    // The work of a parent shared between threads is only freed here
     L.distFronts[0].work1d.Empty();
-    L.localFronts.front().work.Empty();
+    for( int s=0; s<numLocalNodes; ++s )
+        L.localFronts[s].work.Empty();
 }
 
 } // namespace El
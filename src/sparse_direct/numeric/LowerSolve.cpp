@@ -13,26 +13,40 @@
 #include "./LowerSolve/Front.hpp"
 #include "./LowerSolve/FrontBlock.hpp"
 
+#include "./LocalTree.hpp"
+#include "./FrontStore.hpp"
 #include "./LowerSolve/Local.hpp"
 #include "./LowerSolve/Dist.hpp"
+#include "./LowerSolve/Pipelined.hpp"
 
 namespace El {
 
 template<typename F>
 void LowerSolve
 ( Orientation orientation, const DistSymmInfo& info, 
-  const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X )
+  const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X,
+  const SolveCtrl& ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("LowerSolve"))
+    ScopedTimer timer("LowerSolve");
+    const int blockWidth = ctrl.pipelineWidth;
+    const bool pipeline = ( blockWidth > 0 && blockWidth < X.Width() );
     if( orientation == NORMAL )
     {
         LocalLowerForwardSolve( info, L, X );
-        DistLowerForwardSolve( info, L, X );
+        if( pipeline )
+            PipelinedDistLowerForwardSolve( info, L, X, blockWidth );
+        else
+            DistLowerForwardSolve( info, L, X );
     }
     else
     {
         const bool conjugate = ( orientation==ADJOINT );
-        DistLowerBackwardSolve( info, L, X, conjugate );
+        if( pipeline )
+            PipelinedDistLowerBackwardSolve
+            ( info, L, X, conjugate, blockWidth );
+        else
+            DistLowerBackwardSolve( info, L, X, conjugate );
         LocalLowerBackwardSolve( info, L, X, conjugate );
     }
 }
@@ -43,6 +57,7 @@ void LowerSolve
   const DistSymmFrontTree<F>& L, DistNodalMatrix<F>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("LowerSolve"))
+    ScopedTimer timer("LowerSolve");
     if( orientation == NORMAL )
     {
         LocalLowerForwardSolve( info, L, X );
@@ -59,7 +74,8 @@ void LowerSolve
 #define PROTO(F) \
   template void LowerSolve \
   ( Orientation orientation, const DistSymmInfo& info, \
-    const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X ); \
+    const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X, \
+    const SolveCtrl& ctrl ); \
   template void LowerSolve \
   ( Orientation orientation, const DistSymmInfo& info, \
     const DistSymmFrontTree<F>& L, DistNodalMatrix<F>& X );
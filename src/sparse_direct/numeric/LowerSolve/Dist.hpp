@@ -20,6 +20,7 @@ inline void DistLowerForwardSolve
   const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("DistLowerForwardSolve"))
+    ScopedTimer timer("DistLowerForwardSolve");
     const int numDistNodes = info.distNodes.size();
     const int width = X.Width();
     const SymmFrontType frontType = L.frontType;
@@ -176,6 +177,7 @@ inline void DistLowerForwardSolve
   const DistSymmFrontTree<F>& L, DistNodalMatrix<F>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("DistLowerForwardSolve"))
+    ScopedTimer timer("DistLowerForwardSolve");
     const int numDistNodes = info.distNodes.size();
     const int width = X.Width();
     const SymmFrontType frontType = L.frontType;
@@ -332,6 +334,7 @@ inline void DistLowerBackwardSolve
   const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X, bool conjugate )
 {
     DEBUG_ONLY(CallStackEntry cse("DistLowerBackwardSolve"))
+    ScopedTimer timer("DistLowerBackwardSolve");
     const int numDistNodes = info.distNodes.size();
     const int width = X.Width();
     const SymmFrontType frontType = L.frontType;
@@ -537,6 +540,7 @@ inline void DistLowerBackwardSolve
   const DistSymmFrontTree<F>& L, DistNodalMatrix<F>& X, bool conjugate )
 {
     DEBUG_ONLY(CallStackEntry cse("DistLowerBackwardSolve"))
+    ScopedTimer timer("DistLowerBackwardSolve");
     const int numDistNodes = info.distNodes.size();
     const int width = X.Width();
     const SymmFrontType frontType = L.frontType;
@@ -20,7 +20,7 @@ inline void LocalLowerForwardSolve
   const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("LocalLowerForwardSolve"))
-    const int numLocalNodes = info.localNodes.size();
+    ScopedTimer timer("LocalLowerForwardSolve");
     const int width = X.Width();
 
     const SymmFrontType frontType = L.frontType;
@@ -29,11 +29,13 @@ inline void LocalLowerForwardSolve
     const bool blocked = BlockFactorization( frontType );
     const bool pivoted = PivotedFactorization( frontType );
 
-    for( int s=0; s<numLocalNodes; ++s )
+    auto solve = [&]( int s )
     {
         const SymmNodeInfo& node = info.localNodes[s];
         const SymmFront<F>& front = L.localFronts[s];
-        const Matrix<F>& frontL = front.frontL;
+        const Matrix<F>& frontL = 
+          ( L.outOfCore ? L.outOfCore->Acquire( s, front.frontL ) 
+                        : front.frontL );
         Matrix<F>& W = front.work;
 
         // Set up a workspace
@@ -91,7 +93,24 @@ inline void LocalLowerForwardSolve
 
         // Store this node's portion of the result
         X.localNodes[s] = WT;
+        if( L.outOfCore )
+            L.outOfCore->Release( s );
+    };
+
+    // The fronts which were written out of core are read back in, in the
+    // order of a serial traversal, by a background thread
+    LocalSubtrees subtrees;
+    PartitionLocalTree( info, subtrees, !L.outOfCore );
+    if( L.outOfCore )
+    {
+        std::vector<int> order( info.localNodes.size() );
+        for( int s=0; s<int(order.size()); ++s )
+            order[s] = s;
+        L.outOfCore->StartPrefetch( order );
     }
+    TraverseUp( subtrees, solve );
+    if( L.outOfCore )
+        L.outOfCore->StopPrefetch();
 }
 
 // This is an exact copy of the DistNodalMultiVec version...
@@ -101,7 +120,7 @@ inline void LocalLowerForwardSolve
   const DistSymmFrontTree<F>& L, DistNodalMatrix<F>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("LocalLowerForwardSolve"))
-    const int numLocalNodes = info.localNodes.size();
+    ScopedTimer timer("LocalLowerForwardSolve");
     const int width = X.Width();
 
     const SymmFrontType frontType = L.frontType;
@@ -110,11 +129,13 @@ inline void LocalLowerForwardSolve
     const bool blocked = BlockFactorization( frontType );
     const bool pivoted = PivotedFactorization( frontType );
 
-    for( int s=0; s<numLocalNodes; ++s )
+    auto solve = [&]( int s )
     {
         const SymmNodeInfo& node = info.localNodes[s];
         const SymmFront<F>& front = L.localFronts[s];
-        const Matrix<F>& frontL = front.frontL;
+        const Matrix<F>& frontL = 
+          ( L.outOfCore ? L.outOfCore->Acquire( s, front.frontL ) 
+                        : front.frontL );
         Matrix<F>& W = front.work;
 
         // Set up a workspace
@@ -172,7 +193,24 @@ inline void LocalLowerForwardSolve
 
         // Store this node's portion of the result
         X.localNodes[s] = WT;
+        if( L.outOfCore )
+            L.outOfCore->Release( s );
+    };
+
+    // The fronts which were written out of core are read back in, in the
+    // order of a serial traversal, by a background thread
+    LocalSubtrees subtrees;
+    PartitionLocalTree( info, subtrees, !L.outOfCore );
+    if( L.outOfCore )
+    {
+        std::vector<int> order( info.localNodes.size() );
+        for( int s=0; s<int(order.size()); ++s )
+            order[s] = s;
+        L.outOfCore->StartPrefetch( order );
     }
+    TraverseUp( subtrees, solve );
+    if( L.outOfCore )
+        L.outOfCore->StopPrefetch();
 }
 
 template<typename F> 
@@ -182,6 +220,7 @@ inline void LocalLowerBackwardSolve
   bool conjugate )
 {
     DEBUG_ONLY(CallStackEntry cse("LocalLowerBackwardSolve"))
+    ScopedTimer timer("LocalLowerBackwardSolve");
     const int numLocalNodes = info.localNodes.size();
     const int width = X.Width();
 
@@ -191,11 +230,13 @@ inline void LocalLowerBackwardSolve
     const bool blocked = BlockFactorization( frontType );
     const bool pivoted = PivotedFactorization( frontType );
 
-    for( int s=numLocalNodes-2; s>=0; --s )
+    auto solve = [&]( int s, bool freeParent )
     {
         const SymmNodeInfo& node = info.localNodes[s];
         const SymmFront<F>& front = L.localFronts[s];
-        const Matrix<F>& frontL = front.frontL;
+        const Matrix<F>& frontL = 
+          ( L.outOfCore ? L.outOfCore->Acquire( s, front.frontL ) 
+                        : front.frontL );
         Matrix<F>& W = front.work;
 
         // Set up a workspace
@@ -225,9 +266,8 @@ inline void LocalLowerBackwardSolve
                 WB.Set( iCurrent, j, parentWork.Get(iParent,j) );
         }
 
-        // The left child is numbered lower than the right child, so 
-        // we can safely free the parent's work if we are the left child
-        if( node.onLeft )
+        // Free the parent's work if no other node still needs it
+        if( freeParent )
         {
             parentWork.Empty();
             if( parent == numLocalNodes-1 )
@@ -244,7 +284,24 @@ inline void LocalLowerBackwardSolve
 
         // Store this node's portion of the result
         X.localNodes[s] = WT;
+        if( L.outOfCore )
+            L.outOfCore->Release( s );
+    };
+
+    // The fronts which were written out of core are read back in, in the
+    // order of a serial traversal, by a background thread
+    LocalSubtrees subtrees;
+    PartitionLocalTree( info, subtrees, !L.outOfCore );
+    if( L.outOfCore )
+    {
+        std::vector<int> order;
+        for( int s=numLocalNodes-2; s>=0; --s )
+            order.push_back( s );
+        L.outOfCore->StartPrefetch( order );
     }
+    TraverseDown( subtrees, solve );
+    if( L.outOfCore )
+        L.outOfCore->StopPrefetch();
 
     // Ensure that all of the temporary buffers are freed (this is overkill)
     L.distFronts[0].work1d.Empty();
@@ -259,6 +316,7 @@ inline void LocalLowerBackwardSolve
   bool conjugate )
 {
     DEBUG_ONLY(CallStackEntry cse("LocalLowerBackwardSolve"))
+    ScopedTimer timer("LocalLowerBackwardSolve");
     const int numLocalNodes = info.localNodes.size();
     const int width = X.Width();
 
@@ -268,11 +326,13 @@ inline void LocalLowerBackwardSolve
     const bool blocked = BlockFactorization( frontType );
     const bool pivoted = PivotedFactorization( frontType );
 
-    for( int s=numLocalNodes-2; s>=0; --s )
+    auto solve = [&]( int s, bool freeParent )
     {
         const SymmNodeInfo& node = info.localNodes[s];
         const SymmFront<F>& front = L.localFronts[s];
-        const Matrix<F>& frontL = front.frontL;
+        const Matrix<F>& frontL = 
+          ( L.outOfCore ? L.outOfCore->Acquire( s, front.frontL ) 
+                        : front.frontL );
         Matrix<F>& W = front.work;
 
         // Set up a workspace
@@ -302,9 +362,8 @@ inline void LocalLowerBackwardSolve
                 WB.Set( iCurrent, j, parentWork.Get(iParent,j) );
         }
 
-        // The left child is numbered lower than the right child, so 
-        // we can safely free the parent's work if we are the left child
-        if( node.onLeft )
+        // Free the parent's work if no other node still needs it
+        if( freeParent )
         {
             parentWork.Empty();
             if( parent == numLocalNodes-1 )
@@ -321,7 +380,24 @@ inline void LocalLowerBackwardSolve
 
         // Store this node's portion of the result
         X.localNodes[s] = WT;
+        if( L.outOfCore )
+            L.outOfCore->Release( s );
+    };
+
+    // The fronts which were written out of core are read back in, in the
+    // order of a serial traversal, by a background thread
+    LocalSubtrees subtrees;
+    PartitionLocalTree( info, subtrees, !L.outOfCore );
+    if( L.outOfCore )
+    {
+        std::vector<int> order;
+        for( int s=numLocalNodes-2; s>=0; --s )
+            order.push_back( s );
+        L.outOfCore->StartPrefetch( order );
     }
+    TraverseDown( subtrees, solve );
+    if( L.outOfCore )
+        L.outOfCore->StopPrefetch();
 
     // Ensure that all of the temporary buffers are freed (this is overkill)
     L.distFronts[0].work2d.Empty();
@@ -0,0 +1,471 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#pragma once
+#ifndef EL_SPARSEDIRECT_NUMERIC_LOWERSOLVE_PIPELINED_HPP
+#define EL_SPARSEDIRECT_NUMERIC_LOWERSOLVE_PIPELINED_HPP
+
+// Variants of the distributed 1D solves which push the right-hand sides
+// through each level of the distributed tree in blocks of columns: the updates
+// of the next block are exchanged (with nonblocking point-to-point messages)
+// while the current block is unpacked and solved against the front, so that
+// the latency of each level is largely hidden behind its computation.
+
+namespace El {
+
+namespace pipelined {
+
+// Distinct from the (default) tag used by the redistributions within the
+// front solves, which may run while an exchange is outstanding
+const int exchangeTag = 23;
+
+template<typename F>
+struct Exchange
+{
+    std::vector<F> sendBuffer, recvBuffer;
+    std::vector<int> sendDispls, recvDispls;
+    std::vector<mpi::Request> requests;
+
+    // Compute the displacements and allocate the buffers
+    void Setup
+    ( const std::vector<int>& sendCounts, const std::vector<int>& recvCounts )
+    {
+        const int commSize = sendCounts.size();
+        sendDispls.resize( commSize );
+        recvDispls.resize( commSize );
+        int sendBufferSize=0, recvBufferSize=0;
+        for( int proc=0; proc<commSize; ++proc )
+        {
+            sendDispls[proc] = sendBufferSize;
+            recvDispls[proc] = recvBufferSize;
+            sendBufferSize += sendCounts[proc];
+            recvBufferSize += recvCounts[proc];
+        }
+        sendBuffer.resize( sendBufferSize );
+        recvBuffer.resize( recvBufferSize );
+    }
+
+    // Post the messages once the send buffer has been packed
+    void Start
+    ( const std::vector<int>& sendCounts, const std::vector<int>& recvCounts,
+      mpi::Comm comm )
+    {
+        const int commSize = sendCounts.size();
+        requests.clear();
+        for( int proc=0; proc<commSize; ++proc )
+        {
+            if( recvCounts[proc] == 0 )
+                continue;
+            requests.push_back( mpi::REQUEST_NULL );
+            mpi::TaggedIRecv
+            ( &recvBuffer[recvDispls[proc]], recvCounts[proc], proc,
+              exchangeTag, comm, requests.back() );
+        }
+        for( int proc=0; proc<commSize; ++proc )
+        {
+            if( sendCounts[proc] == 0 )
+                continue;
+            requests.push_back( mpi::REQUEST_NULL );
+            mpi::TaggedISend
+            ( &sendBuffer[sendDispls[proc]], sendCounts[proc], proc,
+              exchangeTag, comm, requests.back() );
+        }
+    }
+
+    void Finish()
+    {
+        if( !requests.empty() )
+            mpi::WaitAll( requests.size(), &requests[0] );
+        SwapClear( requests );
+        SwapClear( sendBuffer );
+        SwapClear( sendDispls );
+    }
+
+    void Empty()
+    {
+        SwapClear( recvBuffer );
+        SwapClear( recvDispls );
+    }
+};
+
+template<typename F>
+inline void FrontSolve
+( SymmFrontType frontType, const DistSymmFront<F>& front,
+  DistMatrix<F,VC,STAR>& W )
+{
+    if( frontType == LDL_1D )
+        FrontLowerForwardSolve( front.front1dL, W );
+    else if( frontType == LDL_SELINV_1D )
+        FrontFastLowerForwardSolve( front.front1dL, W );
+    else if( frontType == LDL_SELINV_2D )
+        FrontFastLowerForwardSolve( front.front2dL, W );
+    else if( frontType == LDL_INTRAPIV_1D )
+        FrontIntraPivLowerForwardSolve( front.front1dL, front.piv, W );
+    else if( frontType == LDL_INTRAPIV_SELINV_1D )
+        FrontFastIntraPivLowerForwardSolve( front.front1dL, front.piv, W );
+    else if( frontType == LDL_INTRAPIV_SELINV_2D )
+        FrontFastIntraPivLowerForwardSolve( front.front2dL, front.piv, W );
+    else if( BlockFactorization(frontType) )
+        FrontBlockLowerForwardSolve( front.front2dL, W );
+    else
+        LogicError("Unsupported front type");
+}
+
+template<typename F>
+inline void FrontBackwardSolve
+( SymmFrontType frontType, const DistSymmFront<F>& front,
+  DistMatrix<F,VC,STAR>& W, bool conjugate )
+{
+    if( frontType == LDL_1D )
+        FrontLowerBackwardSolve( front.front1dL, W, conjugate );
+    else if( frontType == LDL_SELINV_1D )
+        FrontFastLowerBackwardSolve( front.front1dL, W, conjugate );
+    else if( frontType == LDL_SELINV_2D )
+        FrontFastLowerBackwardSolve( front.front2dL, W, conjugate );
+    else if( frontType == LDL_INTRAPIV_1D )
+        FrontIntraPivLowerBackwardSolve
+        ( front.front1dL, front.piv, W, conjugate );
+    else if( frontType == LDL_INTRAPIV_SELINV_1D )
+        FrontFastIntraPivLowerBackwardSolve
+        ( front.front1dL, front.piv, W, conjugate );
+    else if( frontType == LDL_INTRAPIV_SELINV_2D )
+        FrontFastIntraPivLowerBackwardSolve
+        ( front.front2dL, front.piv, W, conjugate );
+    else if( BlockFactorization(frontType) )
+        FrontBlockLowerBackwardSolve( front.front2dL, W, conjugate );
+    else
+        LogicError("Unsupported front type");
+}
+
+} // namespace pipelined
+
+template<typename F>
+inline void PipelinedDistLowerForwardSolve
+( const DistSymmInfo& info,
+  const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X, int blockWidth )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("PipelinedDistLowerForwardSolve");
+        if( blockWidth <= 0 )
+            LogicError("Pipeline blocks must be at least one column wide");
+    )
+    ScopedTimer timer("PipelinedDistLowerForwardSolve");
+    const int numDistNodes = info.distNodes.size();
+    const int width = X.Width();
+    const SymmFrontType frontType = L.frontType;
+    const bool frontsAre1d = FrontsAre1d( frontType );
+    if( Unfactored(frontType) )
+        LogicError("Nonsensical front type for solve");
+    if( frontType == LDL_2D || frontType == LDL_INTRAPIV_2D )
+        LogicError("2D non-inverted solves supported by this routine");
+    if( frontType == BLOCK_LDL_1D || frontType == BLOCK_LDL_INTRAPIV_1D )
+        LogicError("1D block solves not yet supported by this routine");
+    const int numBlocks = ( width+blockWidth-1 ) / blockWidth;
+
+    // Copy the information from the local portion into the distributed leaf
+    const SymmFront<F>& localRootFront = L.localFronts.back();
+    const DistSymmFront<F>& distLeafFront = L.distFronts[0];
+    const Grid& leafGrid = ( frontsAre1d ? distLeafFront.front1dL.Grid()
+                                         : distLeafFront.front2dL.Grid() );
+    distLeafFront.work1d.LockedAttach
+    ( localRootFront.work.Height(), localRootFront.work.Width(), leafGrid, 0, 0,
+      localRootFront.work );
+
+    for( int s=1; s<numDistNodes; ++s )
+    {
+        const DistSymmNodeInfo& node = info.distNodes[s];
+        const DistSymmFront<F>& front = L.distFronts[s];
+        const Grid& grid = ( frontsAre1d ? front.front1dL.Grid()
+                                         : front.front2dL.Grid() );
+        mpi::Comm comm = grid.VCComm();
+        const int commSize = mpi::Size( comm );
+
+        const DistSymmNodeInfo& childNode = info.distNodes[s-1];
+        const DistSymmFront<F>& childFront = L.distFronts[s-1];
+        const Grid& childGrid = ( frontsAre1d ? childFront.front1dL.Grid()
+                                              : childFront.front2dL.Grid() );
+        const int childCommSize = mpi::Size( childGrid.VCComm() );
+
+        // Set up a workspace for all of the right-hand sides
+        const int frontHeight = ( frontsAre1d ? front.front1dL.Height()
+                                              : front.front2dL.Height() );
+        DistMatrix<F,VC,STAR>& W = front.work1d;
+        W.SetGrid( grid );
+        W.Resize( frontHeight, width );
+        DistMatrix<F,VC,STAR> WT(grid), WB(grid);
+        PartitionDown( W, WT, WB, node.size );
+        WT = X.distNodes[s-1];
+        Zero( WB );
+
+        const MultiVecCommMeta& commMeta = node.multiVecMeta;
+        DistMatrix<F,VC,STAR>& childW = childFront.work1d;
+        const int updateSize = childW.Height()-childNode.size;
+        const std::vector<int>& myChildRelInds =
+            ( childNode.onLeft ? node.leftRelInds : node.rightRelInds );
+
+        std::vector<pipelined::Exchange<F>> exchanges( numBlocks );
+        std::vector<int> sendCounts(commSize), recvCounts(commSize);
+        auto start = [&]( int b )
+        {
+            const int jOff = b*blockWidth;
+            const int nb = Min( blockWidth, width-jOff );
+            for( int proc=0; proc<commSize; ++proc )
+            {
+                sendCounts[proc] = commMeta.numChildSendInds[proc]*nb;
+                recvCounts[proc] = commMeta.childRecvInds[proc].size()*nb;
+            }
+            DEBUG_ONLY(VerifySendsAndRecvs( sendCounts, recvCounts, comm ))
+            pipelined::Exchange<F>& exchange = exchanges[b];
+            exchange.Setup( sendCounts, recvCounts );
+
+            // Pack this block of our child's update
+            DistMatrix<F,VC,STAR> childUpdate( childGrid );
+            LockedView
+            ( childUpdate, childW, childNode.size, jOff, updateSize, nb );
+            const int colShift = childUpdate.ColShift();
+            const int localHeight = childUpdate.LocalHeight();
+            std::vector<int> packOffs = exchange.sendDispls;
+            for( int iChildLoc=0; iChildLoc<localHeight; ++iChildLoc )
+            {
+                const int iChild = colShift + iChildLoc*childCommSize;
+                const int destRank = myChildRelInds[iChild] % commSize;
+                for( int jChild=0; jChild<nb; ++jChild )
+                    exchange.sendBuffer[packOffs[destRank]++] =
+                        childUpdate.GetLocal(iChildLoc,jChild);
+            }
+            exchange.Start( sendCounts, recvCounts, comm );
+        };
+        auto finish = [&]( int b )
+        {
+            const int jOff = b*blockWidth;
+            const int nb = Min( blockWidth, width-jOff );
+            pipelined::Exchange<F>& exchange = exchanges[b];
+            exchange.Finish();
+
+            // Unpack the child updates (with an Axpy)
+            DistMatrix<F,VC,STAR> WBlock(grid);
+            View( WBlock, W, 0, jOff, frontHeight, nb );
+            const int WLDim = WBlock.LDim();
+            for( int proc=0; proc<commSize; ++proc )
+            {
+                const F* recvVals = &exchange.recvBuffer[exchange.recvDispls[proc]];
+                const std::vector<int>& recvInds = commMeta.childRecvInds[proc];
+                for( unsigned k=0; k<recvInds.size(); ++k )
+                {
+                    const F* recvRow = &recvVals[k*nb];
+                    F* WRow = WBlock.Buffer( recvInds[k], 0 );
+                    for( int j=0; j<nb; ++j )
+                        WRow[j*WLDim] += recvRow[j];
+                }
+            }
+            exchange.Empty();
+
+            pipelined::FrontSolve( frontType, front, WBlock );
+        };
+
+        // Exchange the next block while solving against the current one
+        if( numBlocks > 0 )
+            start( 0 );
+        for( int b=0; b<numBlocks; ++b )
+        {
+            if( b+1 < numBlocks )
+                start( b+1 );
+            finish( b );
+        }
+        childW.Empty();
+        if( s == 1 )
+            L.localFronts.back().work.Empty();
+
+        // Store this node's portion of the result
+        X.distNodes[s-1] = WT;
+    }
+    L.localFronts.back().work.Empty();
+    L.distFronts.back().work1d.Empty();
+}
+
+template<typename F>
+inline void PipelinedDistLowerBackwardSolve
+( const DistSymmInfo& info,
+  const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X, bool conjugate,
+  int blockWidth )
+{
+    DEBUG_ONLY(
+        CallStackEntry cse("PipelinedDistLowerBackwardSolve");
+        if( blockWidth <= 0 )
+            LogicError("Pipeline blocks must be at least one column wide");
+    )
+    ScopedTimer timer("PipelinedDistLowerBackwardSolve");
+    const int numDistNodes = info.distNodes.size();
+    const int width = X.Width();
+    const SymmFrontType frontType = L.frontType;
+    if( Unfactored(frontType) )
+        LogicError("Nonsensical front type for solve");
+    if( frontType == LDL_2D || frontType == LDL_INTRAPIV_2D )
+        LogicError("2D non-inverted solves supported by this routine");
+    if( frontType == BLOCK_LDL_1D || frontType == BLOCK_LDL_INTRAPIV_1D )
+        LogicError("1D block solves not yet supported by this routine");
+    const bool frontsAre1d = FrontsAre1d( frontType );
+    const bool blocked = BlockFactorization( frontType );
+    const bool pivoted = PivotedFactorization( frontType );
+    const int numBlocks = ( width+blockWidth-1 ) / blockWidth;
+
+    // Nothing needs to be exchanged in order to solve against the root
+    const SymmFront<F>& localRootFront = L.localFronts.back();
+    if( numDistNodes == 1 )
+    {
+        View( localRootFront.work, X.localNodes.back() );
+        if( blocked )
+            FrontBlockLowerBackwardSolve
+            ( localRootFront.frontL, localRootFront.work, conjugate );
+        else if( pivoted )
+            FrontIntraPivLowerBackwardSolve
+            ( localRootFront.frontL, localRootFront.piv, localRootFront.work,
+              conjugate );
+        else
+            FrontLowerBackwardSolve
+            ( localRootFront.frontL, localRootFront.work, conjugate );
+    }
+    else
+    {
+        const DistSymmFront<F>& rootFront = L.distFronts.back();
+        View( rootFront.work1d, X.distNodes.back() );
+        pipelined::FrontBackwardSolve
+        ( frontType, rootFront, rootFront.work1d, conjugate );
+    }
+
+    for( int s=numDistNodes-2; s>=0; --s )
+    {
+        const DistSymmNodeInfo& parentNode = info.distNodes[s+1];
+        const DistSymmNodeInfo& node = info.distNodes[s];
+        const DistSymmFront<F>& parentFront = L.distFronts[s+1];
+        const DistSymmFront<F>& front = L.distFronts[s];
+        const Grid& grid = ( frontsAre1d ? front.front1dL.Grid()
+                                         : front.front2dL.Grid() );
+        const Grid& parentGrid = ( frontsAre1d ? parentFront.front1dL.Grid()
+                                               : parentFront.front2dL.Grid() );
+        const int commSize = mpi::Size( grid.VCComm() );
+        mpi::Comm parentComm = parentGrid.VCComm();
+        const int parentCommSize = mpi::Size( parentComm );
+        const int frontHeight = ( frontsAre1d ? front.front1dL.Height()
+                                              : front.front2dL.Height() );
+
+        // Set up a workspace for all of the right-hand sides
+        DistMatrix<F,VC,STAR>& W = front.work1d;
+        W.SetGrid( grid );
+        W.Resize( frontHeight, width );
+        DistMatrix<F,VC,STAR> WT(grid), WB(grid);
+        PartitionDown( W, WT, WB, node.size );
+        Matrix<F>& XT =
+          ( s>0 ? X.distNodes[s-1].Matrix() : X.localNodes.back() );
+        WT.Matrix() = XT;
+
+        const MultiVecCommMeta& commMeta = parentNode.multiVecMeta;
+        DistMatrix<F,VC,STAR>& parentWork = parentFront.work1d;
+        const std::vector<int>& myRelInds =
+            ( node.onLeft ? parentNode.leftRelInds : parentNode.rightRelInds );
+
+        std::vector<pipelined::Exchange<F>> exchanges( numBlocks );
+        std::vector<int> sendCounts(parentCommSize),
+                         recvCounts(parentCommSize);
+        auto start = [&]( int b )
+        {
+            const int jOff = b*blockWidth;
+            const int nb = Min( blockWidth, width-jOff );
+            for( int proc=0; proc<parentCommSize; ++proc )
+            {
+                sendCounts[proc] = commMeta.childRecvInds[proc].size()*nb;
+                recvCounts[proc] = commMeta.numChildSendInds[proc]*nb;
+            }
+            DEBUG_ONLY(
+                VerifySendsAndRecvs( sendCounts, recvCounts, parentComm )
+            )
+            pipelined::Exchange<F>& exchange = exchanges[b];
+            exchange.Setup( sendCounts, recvCounts );
+
+            // Pack this block of the parent's solution using the recv
+            // approach from the forward solve
+            const int workLDim = parentWork.LDim();
+            for( int proc=0; proc<parentCommSize; ++proc )
+            {
+                F* sendVals =
+                  &exchange.sendBuffer[exchange.sendDispls[proc]];
+                const std::vector<int>& recvInds = commMeta.childRecvInds[proc];
+                for( unsigned k=0; k<recvInds.size(); ++k )
+                {
+                    F* sendRow = &sendVals[k*nb];
+                    const F* workRow =
+                      parentWork.LockedBuffer( recvInds[k], jOff );
+                    for( int j=0; j<nb; ++j )
+                        sendRow[j] = workRow[j*workLDim];
+                }
+            }
+            exchange.Start( sendCounts, recvCounts, parentComm );
+        };
+        auto finish = [&]( int b )
+        {
+            const int jOff = b*blockWidth;
+            const int nb = Min( blockWidth, width-jOff );
+            pipelined::Exchange<F>& exchange = exchanges[b];
+            exchange.Finish();
+
+            // Unpack using the send approach from the forward solve
+            DistMatrix<F,VC,STAR> WBlock(grid), WBBlock(grid);
+            View( WBlock, W, 0, jOff, frontHeight, nb );
+            View( WBBlock, WB, 0, jOff, WB.Height(), nb );
+            const int colShift = WBBlock.ColShift();
+            const int localHeight = WBBlock.LocalHeight();
+            std::vector<int>& recvDispls = exchange.recvDispls;
+            for( int iUpdateLoc=0; iUpdateLoc<localHeight; ++iUpdateLoc )
+            {
+                const int iUpdate = colShift + iUpdateLoc*commSize;
+                const int startRank = myRelInds[iUpdate] % parentCommSize;
+                const F* recvBuf = &exchange.recvBuffer[recvDispls[startRank]];
+                for( int j=0; j<nb; ++j )
+                    WBBlock.SetLocal(iUpdateLoc,j,recvBuf[j]);
+                recvDispls[startRank] += nb;
+            }
+            exchange.Empty();
+
+            if( s > 0 )
+                pipelined::FrontBackwardSolve
+                ( frontType, front, WBlock, conjugate );
+            else if( blocked )
+                FrontBlockLowerBackwardSolve
+                ( localRootFront.frontL, WBlock.Matrix(), conjugate );
+            else if( pivoted )
+                FrontIntraPivLowerBackwardSolve
+                ( localRootFront.frontL, localRootFront.piv,
+                  WBlock.Matrix(), conjugate );
+            else
+                FrontLowerBackwardSolve
+                ( localRootFront.frontL, WBlock.Matrix(), conjugate );
+        };
+
+        // Exchange the next block while solving against the current one
+        if( numBlocks > 0 )
+            start( 0 );
+        for( int b=0; b<numBlocks; ++b )
+        {
+            if( b+1 < numBlocks )
+                start( b+1 );
+            finish( b );
+        }
+        parentWork.Empty();
+        if( s == 0 )
+            View( localRootFront.work, W.Matrix() );
+
+        // Store this node's portion of the result
+        XT = WT.Matrix();
+    }
+}
+
+} // namespace El
+
+#endif // ifndef EL_SPARSEDIRECT_NUMERIC_LOWERSOLVE_PIPELINED_HPP
@@ -16,27 +16,29 @@ namespace El {
 template<typename F>
 void Solve
 ( const DistSymmInfo& info, 
-  const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X )
+  const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X,
+  const SolveCtrl& ctrl )
 {
     DEBUG_ONLY(CallStackEntry cse("Solve"))
+    ScopedTimer timer("Solve");
     if( !FrontsAre1d(L.frontType) )
         LogicError("Invalid front type for 1D solve");
     const Orientation orientation = ( L.isHermitian ? ADJOINT : TRANSPOSE );
     if( BlockFactorization(L.frontType) )
     {
         // Solve against block diagonal factor, L D
-        LowerSolve( NORMAL, info, L, X );
+        LowerSolve( NORMAL, info, L, X, ctrl );
         // Solve against the (conjugate-)transpose of the block unit diagonal L
-        LowerSolve( orientation, info, L, X );
+        LowerSolve( orientation, info, L, X, ctrl );
     }
     else
     {
         // Solve against unit diagonal L
-        LowerSolve( NORMAL, info, L, X );
+        LowerSolve( NORMAL, info, L, X, ctrl );
         // Solve against diagonal
         DiagonalSolve( info, L, X );
         // Solve against the (conjugate-)transpose of the unit diagonal L
-        LowerSolve( orientation, info, L, X );
+        LowerSolve( orientation, info, L, X, ctrl );
     }
 }
 
@@ -46,6 +48,7 @@ void Solve
   const DistSymmFrontTree<F>& L, DistNodalMatrix<F>& X )
 {
     DEBUG_ONLY(CallStackEntry cse("Solve"))
+    ScopedTimer timer("Solve");
     if( FrontsAre1d(L.frontType) )
         LogicError("Invalid front type for 2D solve");
     const Orientation orientation = ( L.isHermitian ? ADJOINT : TRANSPOSE );
@@ -67,6 +70,38 @@ void Solve
     }
 }
 
+template<typename F>
+void Solve
+( const DistSymmInfo& info, DistSymmFrontTree<F>& L,
+  const DistMap& inverseMap, DistMultiVec<F>& X, const SolveCtrl& ctrl )
+{
+    DEBUG_ONLY(CallStackEntry cse("Solve"))
+    ScopedTimer timer("Solve");
+    // The 1D distributed solves do not yet support block factorizations, and
+    // the 2D solves only pay off once there are enough right-hand sides to
+    // amortize their redistributions
+    const bool use2d =
+        BlockFactorization(L.frontType) || X.Width() >= ctrl.min2dWidth;
+    if( use2d )
+    {
+        if( FrontsAre1d(L.frontType) )
+            ChangeFrontType( L, ConvertTo2d(L.frontType) );
+        DistNodalMatrix<F> XNodal;
+        XNodal.Pull( inverseMap, info, X );
+        Solve( info, L, XNodal );
+        XNodal.Push( inverseMap, info, X );
+    }
+    else
+    {
+        if( !FrontsAre1d(L.frontType) )
+            ChangeFrontType( L, ConvertTo1d(L.frontType) );
+        DistNodalMultiVec<F> XNodal;
+        XNodal.Pull( inverseMap, info, X );
+        Solve( info, L, XNodal, ctrl );
+        XNodal.Push( inverseMap, info, X );
+    }
+}
+
 template<typename F>
 void SymmetricSolve
 ( const DistSparseMatrix<F>& A, DistMultiVec<F>& X, 
@@ -74,6 +109,7 @@ void SymmetricSolve
   bool sequential, int numDistSeps, int numSeqSeps, int cutoff )
 {
     DEBUG_ONLY(CallStackEntry cse("SymmetricSolve"))
+    ScopedTimer timer("SymmetricSolve");
     DistSymmInfo info;
     DistSeparatorTree sepTree;
     DistMap map, inverseMap;
@@ -82,13 +118,14 @@ void SymmetricSolve
       sequential, numDistSeps, numSeqSeps, cutoff );
     map.FormInverse( inverseMap );
 
+    // Factor directly into the front type which the solve will use
+    const SolveCtrl ctrl;
+    const SymmFrontType frontType =
+        ( X.Width() >= ctrl.min2dWidth ? LDL_INTRAPIV_2D : LDL_INTRAPIV_1D );
     DistSymmFrontTree<F> frontTree( A, map, sepTree, info, conjugate );
-    LDL( info, frontTree, LDL_INTRAPIV_1D );
+    LDL( info, frontTree, frontType );
 
-    DistNodalMultiVec<F> XNodal;
-    XNodal.Pull( inverseMap, info, X );
-    Solve( info, frontTree, XNodal );
-    XNodal.Push( inverseMap, info, X );
+    Solve( info, frontTree, inverseMap, X, ctrl );
 }
 
 template<typename F>
@@ -97,16 +134,21 @@ void HermitianSolve
   bool sequential, int numDistSeps, int numSeqSeps, int cutoff )
 {
     DEBUG_ONLY(CallStackEntry cse("HermitianSolve"))
+    ScopedTimer timer("HermitianSolve");
     SymmetricSolve( A, X, true, sequential, numDistSeps, numSeqSeps, cutoff );
 }
 
 #define PROTO(F) \
   template void Solve \
   ( const DistSymmInfo& info, \
-    const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X ); \
+    const DistSymmFrontTree<F>& L, DistNodalMultiVec<F>& X, \
+    const SolveCtrl& ctrl ); \
   template void Solve \
   ( const DistSymmInfo& info, \
     const DistSymmFrontTree<F>& L, DistNodalMatrix<F>& X ); \
+  template void Solve \
+  ( const DistSymmInfo& info, DistSymmFrontTree<F>& L, \
+    const DistMap& inverseMap, DistMultiVec<F>& X, const SolveCtrl& ctrl ); \
   template void SymmetricSolve \
   ( const DistSparseMatrix<F>& A, DistMultiVec<F>& X, \
     bool conjugate, bool sequential, int numDistSteps, int numSeqSteps, \
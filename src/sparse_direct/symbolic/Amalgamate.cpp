@@ -0,0 +1,181 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+
+namespace {
+
+// The number of entries in the lower triangle of the columns of a front
+inline double FrontEntries( double size, double updateSize )
+{ return size*(size+1)/2 + size*updateSize; }
+
+// The same model as DistSymmFrontTree::FactorizationWork
+inline double FrontFlops( double size, double updateSize )
+{ return size*size*size/3 + updateSize*size*size + updateSize*updateSize*size; }
+
+} // anonymous namespace
+
+void Amalgamate
+( DistSeparatorTree& sepTree, DistSymmElimTree& eTree,
+  const AmalgamationCtrl& ctrl, AmalgamationInfo& info )
+{
+    DEBUG_ONLY(CallStackEntry cse("Amalgamate"))
+    const int numNodes = eTree.localNodes.size();
+    info.numNodesBefore = info.numNodesAfter = numNodes;
+    info.entriesBefore = info.entriesAfter = 0;
+    info.flopsBefore = info.flopsAfter = 0;
+    if( numNodes == 0 )
+        return;
+
+    // The structure of each front is not changed by merging the nodes below
+    // it, so the sizes of the update matrices only need to be computed once
+    DistSymmInfo symmInfo;
+    LocalSymmetricAnalysis( eTree, symmInfo );
+    std::vector<double> updateSizes( numNodes );
+    for( int s=0; s<numNodes; ++s )
+    {
+        updateSizes[s] = symmInfo.localNodes[s].lowerStruct.size();
+        const double size = eTree.localNodes[s]->size;
+        info.entriesBefore += size*(size+updateSizes[s]);
+        info.flopsBefore += FrontFlops( size, updateSizes[s] );
+    }
+
+    // Decide which nodes to merge in postorder, tracking the (merged) size of
+    // each node and the number of explicit zeros in its front
+    std::vector<int> sizes( numNodes );
+    std::vector<double> zeros( numNodes, 0 );
+    std::vector<bool> merged( numNodes, false ), removed( numNodes, false );
+    for( int s=0; s<numNodes; ++s )
+    {
+        sizes[s] = eTree.localNodes[s]->size;
+        const std::vector<int>& children = eTree.localNodes[s]->children;
+        if( children.size() != 2 || s == numNodes-1 )
+            continue;
+        const int left = children[0];
+        const int right = children[1];
+        const bool leftIsLeaf =
+          ( eTree.localNodes[left]->children.empty() || merged[left] );
+        const bool rightIsLeaf =
+          ( eTree.localNodes[right]->children.empty() || merged[right] );
+        if( !leftIsLeaf || !rightIsLeaf )
+            continue;
+
+        const int mergedSize = sizes[left] + sizes[right] + sizes[s];
+        const double mergedEntries = FrontEntries( mergedSize, updateSizes[s] );
+        const double nonzeros =
+          FrontEntries( sizes[left], updateSizes[left] ) - zeros[left] +
+          FrontEntries( sizes[right], updateSizes[right] ) - zeros[right] +
+          FrontEntries( sizes[s], updateSizes[s] );
+        const double mergedZeros = mergedEntries - nonzeros;
+        if( mergedSize <= ctrl.relaxSize ||
+            mergedZeros <= ctrl.maxZeroFraction*mergedEntries )
+        {
+            sizes[s] = mergedSize;
+            zeros[s] = mergedZeros;
+            merged[s] = true;
+            removed[left] = removed[right] = true;
+        }
+    }
+
+    // Absorb the children of each merged node, whose indices directly precede
+    // those of the node (and are contiguous with them)
+    for( int s=0; s<numNodes; ++s )
+    {
+        if( !merged[s] )
+            continue;
+        SymmNode& node = *eTree.localNodes[s];
+        SepOrLeaf& sep = *sepTree.localSepsAndLeaves[s];
+        const SymmNode& left = *eTree.localNodes[node.children[0]];
+        const SymmNode& right = *eTree.localNodes[node.children[1]];
+        const SepOrLeaf& leftSep =
+          *sepTree.localSepsAndLeaves[node.children[0]];
+        const SepOrLeaf& rightSep =
+          *sepTree.localSepsAndLeaves[node.children[1]];
+        DEBUG_ONLY(
+            if( left.off+left.size != right.off ||
+                right.off+right.size != node.off )
+                LogicError("Children were not contiguous with their parent");
+        )
+
+        const int off = left.off;
+        const int size = sizes[s];
+        auto lowerStruct =
+          Union( Union(left.lowerStruct,right.lowerStruct), node.lowerStruct );
+        node.lowerStruct.clear();
+        for( const int i : lowerStruct )
+            if( i < off || i >= off+size )
+                node.lowerStruct.push_back( i );
+        node.off = off;
+        node.size = size;
+        SwapClear( node.children );
+
+        std::vector<int> inds( leftSep.inds );
+        inds.insert( inds.end(), rightSep.inds.begin(), rightSep.inds.end() );
+        inds.insert( inds.end(), sep.inds.begin(), sep.inds.end() );
+        sep.off = off;
+        sep.inds = inds;
+    }
+
+    // Remove the absorbed nodes, which preserves the postordering
+    std::vector<int> newInds( numNodes, -1 );
+    int numKept = 0;
+    for( int s=0; s<numNodes; ++s )
+        if( !removed[s] )
+            newInds[s] = numKept++;
+    std::vector<SymmNode*> localNodes;
+    std::vector<SepOrLeaf*> localSepsAndLeaves;
+    for( int s=0; s<numNodes; ++s )
+    {
+        SymmNode* node = eTree.localNodes[s];
+        SepOrLeaf* sep = sepTree.localSepsAndLeaves[s];
+        if( removed[s] )
+        {
+            delete node;
+            delete sep;
+            continue;
+        }
+        if( node->parent >= 0 )
+            node->parent = sep->parent = newInds[node->parent];
+        for( int& child : node->children )
+            child = newInds[child];
+        localNodes.push_back( node );
+        localSepsAndLeaves.push_back( sep );
+
+        info.entriesAfter += double(sizes[s])*(sizes[s]+updateSizes[s]);
+        info.flopsAfter += FrontFlops( sizes[s], updateSizes[s] );
+    }
+    eTree.localNodes = localNodes;
+    sepTree.localSepsAndLeaves = localSepsAndLeaves;
+    info.numNodesAfter = numKept;
+}
+
+void PrintAmalgamationInfo
+( const AmalgamationInfo& info, mpi::Comm comm, std::ostream& os )
+{
+    DEBUG_ONLY(CallStackEntry cse("PrintAmalgamationInfo"))
+    double local[6] =
+      { double(info.numNodesBefore), double(info.numNodesAfter),
+        info.entriesBefore, info.entriesAfter,
+        info.flopsBefore, info.flopsAfter };
+    double global[6];
+    mpi::AllReduce( local, global, 6, mpi::SUM, comm );
+    if( mpi::Rank(comm) == 0 )
+    {
+        os << "Amalgamation of the local fronts:\n"
+           << "  fronts: " << global[0] << " -> " << global[1] << "\n"
+           << "  entries: " << global[2] << " -> " << global[3] << "\n"
+           << "  real flops: " << global[4] << " -> " << global[5]
+           << std::endl;
+    }
+}
+
+} // namespace El
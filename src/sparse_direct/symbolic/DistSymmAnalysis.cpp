@@ -0,0 +1,317 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson, Lexing Ying,
+   The University of Texas at Austin, Stanford University, and the
+   Georgia Insitute of Technology.
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+
+namespace El {
+
+namespace {
+
+// Bumped whenever the layout of the file changes
+const int analysisVersion = 1;
+const char analysisMagic[8] = { 'E','l','S','y','m','m','A','n' };
+
+std::string AnalysisFilename( const std::string& basename, int rank )
+{
+    std::ostringstream os;
+    os << basename << "-" << rank << ".bin";
+    return os.str();
+}
+
+template<typename T>
+void WriteScalar( std::ofstream& file, T value )
+{ file.write( (const char*)&value, sizeof(T) ); }
+
+template<typename T>
+void WriteVector( std::ofstream& file, const std::vector<T>& vec )
+{
+    WriteScalar( file, int(vec.size()) );
+    if( !vec.empty() )
+        file.write( (const char*)&vec[0], vec.size()*sizeof(T) );
+}
+
+template<typename T>
+void WriteVectors
+( std::ofstream& file, const std::vector<std::vector<T>>& vecs )
+{
+    WriteScalar( file, int(vecs.size()) );
+    for( const auto& vec : vecs )
+        WriteVector( file, vec );
+}
+
+template<typename T>
+T ReadScalar( std::ifstream& file )
+{
+    T value;
+    file.read( (char*)&value, sizeof(T) );
+    if( !file )
+        RuntimeError("Unexpected end of analysis file");
+    return value;
+}
+
+template<typename T>
+void ReadVector( std::ifstream& file, std::vector<T>& vec )
+{
+    const int size = ReadScalar<int>( file );
+    if( size < 0 )
+        RuntimeError("Invalid vector length in analysis file");
+    vec.resize( size );
+    if( size > 0 )
+        file.read( (char*)&vec[0], size*sizeof(T) );
+    if( !file )
+        RuntimeError("Unexpected end of analysis file");
+}
+
+template<typename T>
+void ReadVectors( std::ifstream& file, std::vector<std::vector<T>>& vecs )
+{
+    vecs.resize( ReadScalar<int>( file ) );
+    for( auto& vec : vecs )
+        ReadVector( file, vec );
+}
+
+void WriteMap( std::ofstream& file, const DistMap& map )
+{
+    WriteScalar( file, map.NumSources() );
+    WriteVector( file, map.Map() );
+}
+
+void ReadMap( std::ifstream& file, DistMap& map, mpi::Comm comm )
+{
+    const int numSources = ReadScalar<int>( file );
+    map.SetComm( comm );
+    map.Resize( numSources );
+    ReadVector( file, map.Map() );
+    if( int(map.Map().size()) != map.NumLocalSources() )
+        RuntimeError("Analysis map was distributed differently");
+}
+
+} // anonymous namespace
+
+void DistSymmAnalysis::Empty()
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSymmAnalysis::Empty"))
+    map.Empty();
+    inverseMap.Empty();
+
+    for( SepOrLeaf* sepOrLeaf : sepTree.localSepsAndLeaves )
+        delete sepOrLeaf;
+    SwapClear( sepTree.localSepsAndLeaves );
+    for( DistSeparator& sep : sepTree.distSeps )
+        mpi::Free( sep.comm );
+    SwapClear( sepTree.distSeps );
+
+    SwapClear( info.localNodes );
+    for( DistSymmNodeInfo& node : info.distNodes )
+    {
+        delete node.grid;
+        mpi::Free( node.comm );
+    }
+    SwapClear( info.distNodes );
+}
+
+void DistSymmAnalysis::Write( const std::string& basename ) const
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSymmAnalysis::Write"))
+    mpi::Comm comm = map.Comm();
+    const std::string filename = AnalysisFilename( basename, mpi::Rank(comm) );
+    std::ofstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    file.write( analysisMagic, sizeof(analysisMagic) );
+    WriteScalar( file, analysisVersion );
+    WriteScalar( file, mpi::Size(comm) );
+    WriteScalar( file, mpi::Rank(comm) );
+
+    WriteMap( file, map );
+    WriteMap( file, inverseMap );
+
+    // The separator tree
+    WriteScalar( file, int(sepTree.localSepsAndLeaves.size()) );
+    for( const SepOrLeaf* sepOrLeaf : sepTree.localSepsAndLeaves )
+    {
+        WriteScalar( file, sepOrLeaf->parent );
+        WriteScalar( file, sepOrLeaf->off );
+        WriteVector( file, sepOrLeaf->inds );
+    }
+    WriteScalar( file, int(sepTree.distSeps.size()) );
+    for( const DistSeparator& sep : sepTree.distSeps )
+    {
+        WriteScalar( file, sep.off );
+        WriteVector( file, sep.inds );
+    }
+
+    // The local symbolic factorization
+    WriteScalar( file, int(info.localNodes.size()) );
+    for( const SymmNodeInfo& node : info.localNodes )
+    {
+        WriteScalar( file, node.size );
+        WriteScalar( file, node.off );
+        WriteScalar( file, node.parent );
+        WriteVector( file, node.children );
+        WriteVector( file, node.origLowerStruct );
+        WriteScalar( file, int(node.onLeft) );
+        WriteScalar( file, node.myOff );
+        WriteVector( file, node.lowerStruct );
+        WriteVector( file, node.origLowerRelInds );
+        WriteVector( file, node.leftRelInds );
+        WriteVector( file, node.rightRelInds );
+    }
+
+    // The distributed symbolic factorization, where each communicator is
+    // described by our rank within it (and which child team we were in)
+    WriteScalar( file, int(info.distNodes.size()) );
+    for( const DistSymmNodeInfo& node : info.distNodes )
+    {
+        WriteScalar( file, node.size );
+        WriteScalar( file, node.off );
+        WriteVector( file, node.origLowerStruct );
+        WriteScalar( file, int(node.onLeft) );
+        WriteScalar( file, mpi::Rank(node.comm) );
+        WriteScalar( file, node.myOff );
+        WriteScalar( file, node.leftSize );
+        WriteScalar( file, node.rightSize );
+        WriteVector( file, node.lowerStruct );
+        WriteVector( file, node.origLowerRelInds );
+        WriteVector( file, node.leftRelInds );
+        WriteVector( file, node.rightRelInds );
+
+        WriteVector( file, node.factorMeta.numChildSendInds );
+        WriteVectors( file, node.factorMeta.childRecvInds );
+        WriteScalar( file, node.multiVecMeta.localOff );
+        WriteScalar( file, node.multiVecMeta.localSize );
+        WriteVector( file, node.multiVecMeta.numChildSendInds );
+        WriteVectors( file, node.multiVecMeta.childRecvInds );
+    }
+
+    if( !file )
+        RuntimeError("Could not write analysis to ",filename);
+}
+
+void DistSymmAnalysis::Load( const std::string& basename, mpi::Comm comm )
+{
+    DEBUG_ONLY(CallStackEntry cse("DistSymmAnalysis::Load"))
+    const int commSize = mpi::Size( comm );
+    const int commRank = mpi::Rank( comm );
+    const std::string filename = AnalysisFilename( basename, commRank );
+    std::ifstream file( filename.c_str(), std::ios::binary );
+    if( !file.is_open() )
+        RuntimeError("Could not open ",filename);
+
+    char magic[sizeof(analysisMagic)];
+    file.read( magic, sizeof(magic) );
+    if( !file || !std::equal( magic, magic+sizeof(magic), analysisMagic ) )
+        RuntimeError(filename," is not a symbolic analysis");
+    const int version = ReadScalar<int>( file );
+    if( version != analysisVersion )
+        RuntimeError
+        ("Analysis version was ",version," rather than ",analysisVersion);
+    const int writtenSize = ReadScalar<int>( file );
+    const int writtenRank = ReadScalar<int>( file );
+    if( writtenSize != commSize || writtenRank != commRank )
+        RuntimeError
+        ("Analysis was written by process ",writtenRank," of ",writtenSize,
+         " but is being loaded by process ",commRank," of ",commSize);
+
+    Empty();
+    ReadMap( file, map, comm );
+    ReadMap( file, inverseMap, comm );
+
+    // The separator tree
+    const int numLocalSeps = ReadScalar<int>( file );
+    sepTree.localSepsAndLeaves.resize( numLocalSeps, nullptr );
+    for( int s=0; s<numLocalSeps; ++s )
+    {
+        sepTree.localSepsAndLeaves[s] = new SepOrLeaf;
+        SepOrLeaf& sepOrLeaf = *sepTree.localSepsAndLeaves[s];
+        sepOrLeaf.parent = ReadScalar<int>( file );
+        sepOrLeaf.off = ReadScalar<int>( file );
+        ReadVector( file, sepOrLeaf.inds );
+    }
+    // (the communicators are attached below)
+    std::vector<DistSeparator> distSeps( ReadScalar<int>( file ) );
+    for( DistSeparator& sep : distSeps )
+    {
+        sep.off = ReadScalar<int>( file );
+        ReadVector( file, sep.inds );
+    }
+
+    // The local symbolic factorization
+    info.localNodes.resize( ReadScalar<int>( file ) );
+    for( SymmNodeInfo& node : info.localNodes )
+    {
+        node.size = ReadScalar<int>( file );
+        node.off = ReadScalar<int>( file );
+        node.parent = ReadScalar<int>( file );
+        ReadVector( file, node.children );
+        ReadVector( file, node.origLowerStruct );
+        node.onLeft = ReadScalar<int>( file );
+        node.myOff = ReadScalar<int>( file );
+        ReadVector( file, node.lowerStruct );
+        ReadVector( file, node.origLowerRelInds );
+        ReadVector( file, node.leftRelInds );
+        ReadVector( file, node.rightRelInds );
+    }
+
+    // The distributed symbolic factorization (which is only moved into the
+    // analysis once its communicators have been rebuilt)
+    const int numDist = ReadScalar<int>( file );
+    if( numDist < 1 || int(distSeps.size()) != numDist-1 )
+        RuntimeError("Inconsistent number of distributed nodes");
+    std::vector<int> teamRanks( numDist );
+    std::vector<DistSymmNodeInfo> distNodes( numDist );
+    for( int s=0; s<numDist; ++s )
+    {
+        DistSymmNodeInfo& node = distNodes[s];
+        node.size = ReadScalar<int>( file );
+        node.off = ReadScalar<int>( file );
+        ReadVector( file, node.origLowerStruct );
+        node.onLeft = ReadScalar<int>( file );
+        teamRanks[s] = ReadScalar<int>( file );
+        node.myOff = ReadScalar<int>( file );
+        node.leftSize = ReadScalar<int>( file );
+        node.rightSize = ReadScalar<int>( file );
+        ReadVector( file, node.lowerStruct );
+        ReadVector( file, node.origLowerRelInds );
+        ReadVector( file, node.leftRelInds );
+        ReadVector( file, node.rightRelInds );
+
+        ReadVector( file, node.factorMeta.numChildSendInds );
+        ReadVectors( file, node.factorMeta.childRecvInds );
+        node.multiVecMeta.localOff = ReadScalar<int>( file );
+        node.multiVecMeta.localSize = ReadScalar<int>( file );
+        ReadVector( file, node.multiVecMeta.numChildSendInds );
+        ReadVectors( file, node.multiVecMeta.childRecvInds );
+    }
+
+    // Rebuild the communicators in the same manner as nested dissection: the
+    // team of each node is split into the teams of its children
+    mpi::Dup( comm, distNodes[numDist-1].comm );
+    for( int s=numDist-2; s>=0; --s )
+        mpi::Split
+        ( distNodes[s+1].comm, int(distNodes[s].onLeft), teamRanks[s],
+          distNodes[s].comm );
+    for( int s=0; s<numDist; ++s )
+    {
+        DistSymmNodeInfo& node = distNodes[s];
+        node.grid = new Grid( node.comm );
+        DEBUG_ONLY(
+            if( mpi::Rank(node.comm) != teamRanks[s] )
+                LogicError("Rebuilt the team of node ",s," incorrectly");
+        )
+    }
+    for( int s=0; s<numDist-1; ++s )
+        mpi::Dup( distNodes[s+1].comm, distSeps[s].comm );
+    info.distNodes.swap( distNodes );
+    sepTree.distSeps.swap( distSeps );
+}
+
+} // namespace El
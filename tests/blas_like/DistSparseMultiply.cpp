@@ -0,0 +1,163 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Queue row i of a nonsymmetric 3D 7-point stencil over an n1 x n2 x n3 grid
+template<typename T,typename Queuer>
+void StencilRow( Int i, Int n1, Int n2, Int n3, Queuer queue )
+{
+    const Int x = i % n1;
+    const Int y = (i/n1) % n2;
+    const Int z = i/(n1*n2);
+
+    queue( i, T(6) );
+    if( x != 0 )
+        queue( i-1, T(-1) );
+    if( x != n1-1 )
+        queue( i+1, T(-2) );
+    if( y != 0 )
+        queue( i-n1, T(-1) );
+    if( y != n2-1 )
+        queue( i+n1, T(-2) );
+    if( z != 0 )
+        queue( i-n1*n2, T(-1) );
+    if( z != n3-1 )
+        queue( i+n1*n2, T(-2) );
+}
+
+// A deterministic entry so that every process can form the same vectors
+template<typename T>
+T TestEntry( Int i, Int t )
+{ return T( Base<T>((3*i+7*t) % 11) / 11 ); }
+
+template<typename T>
+void TestDistSparseMultiply
+( Orientation orientation, Int n1, Int n2, Int n3, Int numRhs, Int numReps,
+  mpi::Comm comm )
+{
+    typedef Base<T> Real;
+    const int commRank = mpi::Rank( comm );
+    const Int N = n1*n2*n3;
+    const T alpha = T(2), beta = T(-1);
+
+    DistSparseMatrix<T> A( N, N, comm );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 7*localHeight );
+    for( Int iLocal=0; iLocal<localHeight; ++iLocal )
+        StencilRow<T>
+        ( firstLocalRow+iLocal, n1, n2, n3,
+          [&]( Int j, T value ) { A.QueueLocalUpdate( iLocal, j, value ); } );
+    A.MakeConsistent();
+
+    DistMultiVec<T> X( N, numRhs, comm ), Y( N, numRhs, comm );
+    for( Int iLocal=0; iLocal<X.LocalHeight(); ++iLocal )
+        for( Int t=0; t<numRhs; ++t )
+            X.SetLocal( iLocal, t, TestEntry<T>(X.FirstLocalRow()+iLocal,t) );
+
+    // Every process redundantly forms the sequential product as a reference
+    SparseMatrix<T> ASeq( N, N );
+    ASeq.Reserve( 7*N );
+    for( Int i=0; i<N; ++i )
+        StencilRow<T>
+        ( i, n1, n2, n3,
+          [&]( Int j, T value ) { ASeq.QueueUpdate( i, j, value ); } );
+    ASeq.MakeConsistent();
+    Matrix<T> XSeq( N, numRhs ), YSeq( N, numRhs );
+    for( Int i=0; i<N; ++i )
+        for( Int t=0; t<numRhs; ++t )
+        {
+            XSeq.Set( i, t, TestEntry<T>(i,t) );
+            YSeq.Set( i, t, TestEntry<T>(i,t+1) );
+        }
+    Multiply( orientation, alpha, ASeq, XSeq, beta, YSeq );
+
+    // The first product includes the construction of the communication
+    // metadata, which is reused by all of the subsequent products
+    for( Int iLocal=0; iLocal<Y.LocalHeight(); ++iLocal )
+        for( Int t=0; t<numRhs; ++t )
+            Y.SetLocal( iLocal, t, TestEntry<T>(Y.FirstLocalRow()+iLocal,t+1) );
+    mpi::Barrier( comm );
+    double startTime = mpi::Time();
+    Multiply( orientation, alpha, A, X, beta, Y );
+    mpi::Barrier( comm );
+    const double setupTime = mpi::Time() - startTime;
+
+    Real localError=0, localNorm=0;
+    for( Int iLocal=0; iLocal<Y.LocalHeight(); ++iLocal )
+    {
+        const Int i = Y.FirstLocalRow() + iLocal;
+        for( Int t=0; t<numRhs; ++t )
+        {
+            localError += Abs(Y.GetLocal(iLocal,t)-YSeq.Get(i,t));
+            localNorm += Abs(YSeq.Get(i,t));
+        }
+    }
+    const Real error = mpi::AllReduce( localError, comm );
+    const Real norm = mpi::AllReduce( localNorm, comm );
+
+    mpi::Barrier( comm );
+    startTime = mpi::Time();
+    for( Int rep=0; rep<numReps; ++rep )
+        Multiply( orientation, alpha, A, X, beta, Y );
+    mpi::Barrier( comm );
+    const double runTime = (mpi::Time()-startTime)/numReps;
+
+    const double realFlops = 2.*double(7*N)*double(numRhs);
+    const double flops = ( IsComplex<T>::val ? 4*realFlops : realFlops );
+    if( commRank == 0 )
+        cout << "  first Multiply: " << setupTime << " seconds\n"
+             << "    index discovery: " << A.multMeta.discoveryTime 
+             << " seconds\n"
+             << "    index exchange:  " << A.multMeta.exchangeTime 
+             << " seconds\n"
+             << "    nonzero mapping: " << A.multMeta.mapTime << " seconds\n"
+             << "  Multiply:       " << runTime << " seconds, "
+             << flops/(1.e9*runTime) << " GFlop/s\n"
+             << "  || YSeq - Y ||_1 / || YSeq ||_1 = " << error/norm
+             << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",30);
+        const Int n2 = Input("--n2","second grid dimension",30);
+        const Int n3 = Input("--n3","third grid dimension",30);
+        const Int numRhs = Input("--numRhs","number of right-hand sides",1);
+        const Int numReps = Input("--numReps","number of repetitions",10);
+        const char trans = Input("--trans","orientation of A: N/T/C",'N');
+        ProcessInput();
+        PrintInputReport();
+
+        const Orientation orientation = CharToOrientation( trans );
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestDistSparseMultiply<double>
+        ( orientation, n1, n2, n3, numRhs, numReps, comm );
+
+        if( commRank == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestDistSparseMultiply<Complex<double>>
+        ( orientation, n1, n2, n3, numRhs, numReps, comm );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,72 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Time the inlined (callable-templated) EntrywiseMap and IndexDependentMap
+// against their std::function counterparts and check that they agree
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int m = Input("--height","height of matrix",2000);
+        const Int n = Input("--width","width of matrix",2000);
+        const double tau = Input("--tau","soft-threshold parameter",0.5);
+        const Int numReps = Input("--numReps","number of repetitions",10);
+        ProcessInput();
+        PrintInputReport();
+
+        DistMatrix<double> A;
+        Uniform( A, m, n, 0., 2. );
+        DistMatrix<double> B( A ), C( A );
+
+        auto softThresh = [=]( double alpha )
+          { return SoftThreshold( alpha, tau ); };
+        auto taper = [=]( Int i, Int j, double alpha )
+          { return alpha/(1+Abs(i-j)); };
+
+        mpi::Barrier( comm );
+        double startTime = mpi::Time();
+        for( Int rep=0; rep<numReps; ++rep )
+        {
+            EntrywiseMap( B, std::function<double(double)>(softThresh) );
+            IndexDependentMap
+            ( B, std::function<double(Int,Int,double)>(taper) );
+        }
+        mpi::Barrier( comm );
+        const double funcTime = (mpi::Time()-startTime)/numReps;
+
+        mpi::Barrier( comm );
+        startTime = mpi::Time();
+        for( Int rep=0; rep<numReps; ++rep )
+        {
+            EntrywiseMap( C, softThresh );
+            IndexDependentMap( C, taper );
+        }
+        mpi::Barrier( comm );
+        const double inlineTime = (mpi::Time()-startTime)/numReps;
+
+        Axpy( -1., B, C );
+        const double diffNorm = MaxNorm( C );
+        if( commRank == 0 )
+            std::cout << "std::function: " << funcTime << " seconds\n"
+                      << "inlined:       " << inlineTime << " seconds\n"
+                      << "|| B - C ||_max = " << diffNorm << std::endl;
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,161 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// The original entry-by-entry implementation, which serves as both a
+// correctness check and a performance baseline
+template<typename T>
+void ReferenceMultiply
+( Orientation orientation,
+  T alpha, const SparseMatrix<T>& A, const Matrix<T>& X,
+  T beta,                                  Matrix<T>& Y )
+{
+    const Int m = A.Height();
+    const Int b = X.Width();
+    Scale( beta, Y );
+    for( Int i=0; i<m; ++i )
+    {
+        const Int off = A.EntryOffset( i );
+        const Int rowSize = A.NumConnections( i );
+        for( Int k=0; k<rowSize; ++k )
+        {
+            const Int j = A.Col(k+off);
+            const T AVal = A.Value(k+off);
+            for( Int t=0; t<b; ++t )
+            {
+                if( orientation == NORMAL )
+                    Y.Update( i, t, alpha*AVal*X.Get(j,t) );
+                else if( orientation == TRANSPOSE )
+                    Y.Update( j, t, alpha*AVal*X.Get(i,t) );
+                else
+                    Y.Update( j, t, alpha*Conj(AVal)*X.Get(i,t) );
+            }
+        }
+    }
+}
+
+// Fill a 3D 7-point stencil over an n1 x n2 x n3 grid in natural ordering,
+// with a nonsymmetric perturbation so that the transposed products differ
+template<typename T>
+void Stencil( Int n1, Int n2, Int n3, SparseMatrix<T>& A )
+{
+    const Int N = n1*n2*n3;
+    A.Resize( N, N );
+    A.Reserve( 7*N );
+    for( Int i=0; i<N; ++i )
+    {
+        const Int x = i % n1;
+        const Int y = (i/n1) % n2;
+        const Int z = i/(n1*n2);
+
+        A.QueueUpdate( i, i, T(6) );
+        if( x != 0 )
+            A.QueueUpdate( i, i-1, T(-1) );
+        if( x != n1-1 )
+            A.QueueUpdate( i, i+1, T(-2) );
+        if( y != 0 )
+            A.QueueUpdate( i, i-n1, T(-1) );
+        if( y != n2-1 )
+            A.QueueUpdate( i, i+n1, T(-2) );
+        if( z != 0 )
+            A.QueueUpdate( i, i-n1*n2, T(-1) );
+        if( z != n3-1 )
+            A.QueueUpdate( i, i+n1*n2, T(-2) );
+    }
+    A.MakeConsistent();
+}
+
+template<typename T>
+void TestSparseMultiply
+( Orientation orientation, Int n1, Int n2, Int n3, Int numRhs, Int numReps )
+{
+    typedef Base<T> Real;
+    SparseMatrix<T> A;
+    Stencil( n1, n2, n3, A );
+    const Int N = A.Height();
+    const Int numEntries = A.NumEntries();
+    const T alpha = T(2), beta = T(-1);
+
+    Matrix<T> X, Y, YRef;
+    Uniform( X, N, numRhs );
+    Uniform( Y, N, numRhs );
+    YRef = Y;
+
+    // Flops and the compulsory memory traffic of a single product: the
+    // values and column indices of A, the row offsets, one read of X, and
+    // a read and a write of Y
+    const double realFlops = 2.*double(numEntries)*double(numRhs);
+    const double flops = ( IsComplex<T>::val ? 4*realFlops : realFlops );
+    const double bytes =
+      double(numEntries)*(sizeof(T)+sizeof(Int)) + double(N+1)*sizeof(Int) +
+      3.*double(N)*double(numRhs)*sizeof(T);
+
+    double startTime = mpi::Time();
+    for( Int rep=0; rep<numReps; ++rep )
+        ReferenceMultiply( orientation, alpha, A, X, beta, YRef );
+    const double refTime = (mpi::Time()-startTime)/numReps;
+
+    startTime = mpi::Time();
+    for( Int rep=0; rep<numReps; ++rep )
+        Multiply( orientation, alpha, A, X, beta, Y );
+    const double runTime = (mpi::Time()-startTime)/numReps;
+
+    const Real YRefNorm = FrobeniusNorm( YRef );
+    Axpy( T(-1), Y, YRef );
+    const Real errorNorm = FrobeniusNorm( YRef );
+
+    cout << "  reference: " << refTime << " seconds, "
+         << flops/(1.e9*refTime) << " GFlop/s, "
+         << bytes/(1.e9*refTime) << " GB/s\n"
+         << "  Multiply:  " << runTime << " seconds, "
+         << flops/(1.e9*runTime) << " GFlop/s, "
+         << bytes/(1.e9*runTime) << " GB/s\n"
+         << "  speedup:   " << refTime/runTime << "\n"
+         << "  || YRef - Y ||_F / || YRef ||_F = " << errorNorm/YRefNorm
+         << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n1 = Input("--n1","first grid dimension",50);
+        const Int n2 = Input("--n2","second grid dimension",50);
+        const Int n3 = Input("--n3","third grid dimension",50);
+        const Int numRhs = Input("--numRhs","number of right-hand sides",1);
+        const Int numReps = Input("--numReps","number of repetitions",10);
+        const char trans = Input("--trans","orientation of A: N/T/C",'N');
+        ProcessInput();
+        PrintInputReport();
+
+        const Orientation orientation = CharToOrientation( trans );
+        ComplainIfDebug();
+        if( commRank == 0 )
+        {
+            cout << "Testing with doubles:" << endl;
+            TestSparseMultiply<double>
+            ( orientation, n1, n2, n3, numRhs, numReps );
+
+            cout << "Testing with double-precision complex:" << endl;
+            TestSparseMultiply<Complex<double>>
+            ( orientation, n1, n2, n3, numRhs, numReps );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
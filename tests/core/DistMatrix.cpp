@@ -251,8 +251,13 @@ main( int argc, char* argv[] )
         const Int m = Input("--height","height of matrix",100);
         const Int n = Input("--width","width of matrix",100);
         const bool print = Input("--print","print wrong matrices?",false);
+        const bool profile = Input("--profile","profile communication?",false);
+        const bool profileRanks =
+          Input("--profileRanks","profile of each process?",false);
         ProcessInput();
         PrintInputReport();
+        if( profile )
+            EnableCommProfiling( true, profileRanks );
 
         if( r == 0 )
             r = Grid::FindFactor( commSize );
@@ -33,6 +33,14 @@ void TestMatrix( Int m, Int n, Int ldim )
                 LogicError
                 ("Matrix class was not properly filled with const buffer");
 
+    Matrix<T> C( m, n, PaddedLDim<T>(m) );
+    if( C.LDim() < Max(m,1) )
+        LogicError("Padded leading dimension was too small");
+#ifdef EL_HAVE_POSIX_MEMALIGN
+    if( reinterpret_cast<std::uintptr_t>(C.Buffer()) % EL_MEMORY_ALIGNMENT != 0 )
+        LogicError("Matrix buffer was not aligned");
+#endif
+
     const Int commRank = mpi::Rank( mpi::COMM_WORLD );
     if( commRank == 0 )
         std::cout << "passed" << std::endl;
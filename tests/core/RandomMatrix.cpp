@@ -0,0 +1,187 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Check that distributed random matrices are independent of their
+// distribution by regenerating the same seed over several distributions and
+// comparing against a sequential evaluation of the counter-based generator.
+// The generator itself is first checked against the Random123 known-answer
+// vectors for Philox4x32-10.
+
+bool TestKnownAnswers( const Grid& g )
+{
+    struct KnownAnswer
+    {
+        const char* name;
+        PhiloxCounter counter;
+        PhiloxKey key;
+        PhiloxCounter result;
+    };
+    const KnownAnswer answers[] =
+    {
+      { "zero",
+        {{0x00000000,0x00000000,0x00000000,0x00000000}},
+        {{0x00000000,0x00000000}},
+        {{0x6627e8d5,0xe169c58d,0xbc57ac4c,0x9b00dbd8}} },
+      { "all-ones",
+        {{0xffffffff,0xffffffff,0xffffffff,0xffffffff}},
+        {{0xffffffff,0xffffffff}},
+        {{0x408f276d,0x41c83b0e,0xa20bc7c6,0x6d5451fd}} },
+      { "pi digits",
+        {{0x243f6a88,0x85a308d3,0x13198a2e,0x03707344}},
+        {{0xa4093822,0x299f31d0}},
+        {{0xd16cfe09,0x94fdcceb,0x5001e420,0x24126ea1}} }
+    };
+    bool passed = true;
+    for( const auto& answer : answers )
+    {
+        const bool match =
+            ( Philox4x32( answer.counter, answer.key ) == answer.result );
+        if( g.Rank() == 0 )
+            std::cout << "  Philox4x32-10 " << answer.name << " vector: "
+                      << ( match ? "passed" : "FAILED" ) << std::endl;
+        passed = passed && match;
+    }
+    return passed;
+}
+
+template<typename T>
+Base<T> MaxDeviation
+( const AbstractDistMatrix<T>& A, const Matrix<T>& ARef )
+{
+    DistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    Matrix<T> E( A_STAR_STAR.Matrix() );
+    Axpy( T(-1), ARef, E );
+    return MaxNorm( E );
+}
+
+template<typename T>
+Base<T> MaxDeviation
+( const AbstractBlockDistMatrix<T>& A, const Matrix<T>& ARef )
+{
+    BlockDistMatrix<T,STAR,STAR> A_STAR_STAR( A );
+    Matrix<T> E( A_STAR_STAR.Matrix() );
+    Axpy( T(-1), ARef, E );
+    return MaxNorm( E );
+}
+
+template<typename T,Dist U,Dist V>
+void TestDist
+( bool gaussian, std::uint64_t seed, const Matrix<T>& ARef, const Grid& g )
+{
+    const Int m = ARef.Height();
+    const Int n = ARef.Width();
+    SetRandomSeed( seed );
+    DistMatrix<T,U,V> A(g);
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    if( gaussian )
+        Gaussian( A, m, n );
+    else
+        Uniform( A, m, n );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    const Base<T> dev = MaxDeviation( A, ARef );
+    if( g.Rank() == 0 )
+        std::cout << "  [" << DistToString(U) << "," << DistToString(V)
+                  << "]: " << runTime << " seconds, max deviation = "
+                  << dev << std::endl;
+    if( dev != Base<T>(0) )
+        LogicError
+        ("[",DistToString(U),",",DistToString(V),
+         "] deviated from the generator");
+}
+
+template<typename T>
+void TestBlockDist
+( bool gaussian, std::uint64_t seed, const Matrix<T>& ARef, const Grid& g,
+  Int mb, Int nb )
+{
+    const Int m = ARef.Height();
+    const Int n = ARef.Width();
+    SetRandomSeed( seed );
+    BlockDistMatrix<T> A( m, n, g, mb, nb );
+    if( gaussian )
+        MakeGaussian( A );
+    else
+        MakeUniform( A );
+    const Base<T> dev = MaxDeviation( A, ARef );
+    if( g.Rank() == 0 )
+        std::cout << "  BlockDistMatrix: max deviation = " << dev << std::endl;
+    if( dev != Base<T>(0) )
+        LogicError("BlockDistMatrix deviated from the generator");
+}
+
+template<typename T>
+void TestRandom
+( bool gaussian, std::string typeName, Int m, Int n, Int mb, Int nb,
+  const Grid& g )
+{
+    if( g.Rank() == 0 )
+        std::cout << ( gaussian ? "Gaussian" : "Uniform" ) << " with "
+                  << typeName << ":" << std::endl;
+
+    // Evaluate the generator sequentially on every process
+    const std::uint64_t seed = 1234;
+    const PhiloxKey key = CounterKey( seed, 0 );
+    Matrix<T> ARef( m, n );
+    for( Int j=0; j<n; ++j )
+        for( Int i=0; i<m; ++i )
+            ARef.Set
+            ( i, j, gaussian ? CounterSampleNormal<T>(key,i,j)
+                             : CounterSampleBall<T>(key,i,j) );
+
+    TestDist<T,MC,  MR  >( gaussian, seed, ARef, g );
+    TestDist<T,MR,  MC  >( gaussian, seed, ARef, g );
+    TestDist<T,VC,  STAR>( gaussian, seed, ARef, g );
+    TestDist<T,STAR,VR  >( gaussian, seed, ARef, g );
+    TestDist<T,MC,  STAR>( gaussian, seed, ARef, g );
+    TestDist<T,STAR,STAR>( gaussian, seed, ARef, g );
+    TestDist<T,CIRC,CIRC>( gaussian, seed, ARef, g );
+    TestBlockDist( gaussian, seed, ARef, g, mb, nb );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",100);
+        const Int n = Input("--width","width of matrix",100);
+        const Int mb = Input("--blockHeight","height of distribution blocks",7);
+        const Int nb = Input("--blockWidth","width of distribution blocks",5);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+
+        if( !TestKnownAnswers( g ) )
+            LogicError("Philox4x32-10 does not match the known answers");
+        TestRandom<double>( false, "double", m, n, mb, nb, g );
+        TestRandom<double>( true, "double", m, n, mb, nb, g );
+        TestRandom<Complex<double>>
+        ( false, "Complex<double>", m, n, mb, nb, g );
+        TestRandom<Complex<double>>
+        ( true, "Complex<double>", m, n, mb, nb, g );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,148 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Assemble a tridiagonal matrix in which every entry is formed from two
+// queued updates and the (0,1) entry is removed, then refill the values of
+// the locked pattern with 'scale' times the original ones
+template<typename T>
+void TestSparseMatrix( Int n, T scale )
+{
+    SparseMatrix<T> A( n, n );
+    A.Reserve( 6*n );
+    for( Int i=n-1; i>=0; --i )
+    {
+        for( Int j=Max(i-1,0); j<=Min(i+1,n-1); ++j )
+        {
+            A.QueueUpdate( i, j, T(i+j) );
+            A.QueueUpdate( i, j, T(1) );
+        }
+    }
+    A.QueueZero( 0, 1 );
+    A.MakeConsistent();
+    if( A.NumEntries() != 3*n-3 )
+        LogicError("Assembled the wrong number of entries");
+    for( Int i=0; i<n; ++i )
+        for( Int j=Max(i-1,0); j<=Min(i+1,n-1); ++j )
+            if( i != 0 || j != 1 )
+                if( A.Value(A.Index(i,j)) != T(i+j+1) )
+                    LogicError("Entry (",i,",",j,") was incorrect");
+
+    // Form a transposed product, which may cache the transposed structure
+    Matrix<T> X, Y;
+    Ones( X, n, 1 );
+    Zeros( Y, n, 1 );
+    Multiply( TRANSPOSE, T(1), A, X, T(0), Y );
+    const bool cachedTranspose = A.transposeMeta.ready;
+
+    A.LockPattern();
+    A.ZeroValues();
+    for( Int i=0; i<n; ++i )
+        for( Int j=Max(i-1,0); j<=Min(i+1,n-1); ++j )
+            if( i != 0 || j != 1 )
+                A.QueueUpdate( i, j, scale*T(i+j+1) );
+    A.MakeConsistent();
+    if( cachedTranspose && !A.transposeMeta.ready )
+        LogicError("Refilling the values invalidated the transpose");
+
+    Matrix<T> Z;
+    Zeros( Z, n, 1 );
+    Multiply( TRANSPOSE, T(1), A, X, T(0), Z );
+    Axpy( -scale, Y, Z );
+    if( FrobeniusNorm(Z) != Base<T>(0) )
+        LogicError("Product with the refilled matrix was incorrect");
+
+    bool caught = false;
+    try { A.QueueUpdate( 0, 1, T(1) ); }
+    catch( std::exception& e ) { caught = true; }
+    if( !caught )
+        LogicError("Updated an entry outside of the locked pattern");
+}
+
+template<typename T>
+void TestDistSparseMatrix( Int n, T scale, mpi::Comm comm )
+{
+    DistSparseMatrix<T> A( n, n, comm );
+    const Int firstLocalRow = A.FirstLocalRow();
+    const Int localHeight = A.LocalHeight();
+    A.Reserve( 6*localHeight );
+    for( Int iLocal=localHeight-1; iLocal>=0; --iLocal )
+    {
+        const Int i = firstLocalRow + iLocal;
+        for( Int j=Max(i-1,0); j<=Min(i+1,n-1); ++j )
+        {
+            A.QueueLocalUpdate( iLocal, j, T(i+j) );
+            A.QueueLocalUpdate( iLocal, j, T(1) );
+        }
+    }
+    A.MakeConsistent();
+
+    DistMultiVec<T> X( n, 1, comm ), Y( n, 1, comm ), Z( n, 1, comm );
+    for( Int iLocal=0; iLocal<X.LocalHeight(); ++iLocal )
+        X.SetLocal( iLocal, 0, T(1) );
+    Multiply( NORMAL, T(1), A, X, T(0), Y );
+
+    A.LockPattern();
+    A.ZeroValues();
+    for( Int iLocal=0; iLocal<localHeight; ++iLocal )
+    {
+        const Int i = firstLocalRow + iLocal;
+        for( Int j=Max(i-1,0); j<=Min(i+1,n-1); ++j )
+            A.QueueUpdate( i, j, scale*T(i+j+1) );
+    }
+    A.MakeConsistent();
+    if( !A.multMeta.ready )
+        LogicError("Refilling the values invalidated the multiply metadata");
+
+    Multiply( NORMAL, T(1), A, X, T(0), Z );
+    for( Int iLocal=0; iLocal<Y.LocalHeight(); ++iLocal )
+        if( Z.GetLocal(iLocal,0) != scale*Y.GetLocal(iLocal,0) )
+            LogicError("Product with the refilled matrix was incorrect");
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--size","height of matrix",100);
+        ProcessInput();
+        PrintInputReport();
+
+        if( commRank == 0 )
+        {
+            std::cout << "Testing with doubles...";
+            std::cout.flush();
+        }
+        TestSparseMatrix<double>( n, 2. );
+        TestDistSparseMatrix<double>( n, 2., comm );
+        if( commRank == 0 )
+            std::cout << "passed" << std::endl;
+
+        if( commRank == 0 )
+        {
+            std::cout << "Testing with double-precision complex...";
+            std::cout.flush();
+        }
+        TestSparseMatrix<Complex<double>>( n, Complex<double>(0,2) );
+        TestDistSparseMatrix<Complex<double>>
+        ( n, Complex<double>(0,2), comm );
+        if( commRank == 0 )
+            std::cout << "passed" << std::endl;
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
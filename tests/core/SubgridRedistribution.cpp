@@ -0,0 +1,215 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+// Time the redistribution of a block-distributed matrix from the full process
+// grid onto k disjoint subgrids (each of which owns a contiguous block of
+// columns), between neighboring subgrids, and the merge of the k blocks back
+// into the full grid, checking that every entry lands in the correct place
+// along the way
+
+// View columns [j0,j0+width) of A (with the same block sizes, and with the
+// alignment and cut adjusted so that each entry keeps its owner)
+void ColumnView
+( BlockDistMatrix<double>& A, Int j0, Int width,
+  BlockDistMatrix<double>& AView )
+{
+    const Int nb = A.BlockWidth();
+    const Int rowStride = A.RowStride();
+    const Int rowCut = (j0+A.RowCut()) % nb;
+    const Int rowAlign = (A.RowAlign()+(j0+A.RowCut())/nb) % rowStride;
+    Int jLocOff = 0;
+    while( jLocOff < A.LocalWidth() && A.GlobalCol(jLocOff) < j0 )
+        ++jLocOff;
+    double* buffer =
+      ( A.Participating() ? A.Buffer()+jLocOff*A.LDim() : nullptr );
+    AView.Attach
+    ( A.Height(), width, A.Grid(), A.BlockHeight(), nb,
+      A.ColAlign(), rowAlign, A.ColCut(), rowCut, buffer, A.LDim(),
+      A.Root() );
+}
+
+void Fill( AbstractBlockDistMatrix<double>& A )
+{
+    const Int m = A.Height();
+    for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+    {
+        const Int j = A.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+        {
+            const Int i = A.GlobalRow(iLoc);
+            A.SetLocal( iLoc, jLoc, double(i+j*m) );
+        }
+    }
+}
+
+// Entry (i,j) of a block starting at column j0 should be scale*(i+(j0+j)*m)
+double MaxError
+( const AbstractBlockDistMatrix<double>& A, double scale, Int j0=0 )
+{
+    const Int m = A.Height();
+    double maxError = 0;
+    if( A.Participating() )
+    {
+        for( Int jLoc=0; jLoc<A.LocalWidth(); ++jLoc )
+        {
+            const Int j = j0 + A.GlobalCol(jLoc);
+            for( Int iLoc=0; iLoc<A.LocalHeight(); ++iLoc )
+            {
+                const Int i = A.GlobalRow(iLoc);
+                const double error = Abs(A.GetLocal(iLoc,jLoc)-scale*(i+j*m));
+                maxError = Max( maxError, error );
+            }
+        }
+    }
+    return mpi::AllReduce( maxError, mpi::MAX, A.Grid().ViewingComm() );
+}
+
+void Report
+( const std::string& msg, double runTime, double error, mpi::Comm comm )
+{
+    if( mpi::Rank(comm) == 0 )
+        std::cout << msg << ": " << runTime << " seconds "
+                  << "(max error = " << error << ")" << std::endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int k = Input("--numSubgrids","number of subgrids",2);
+        const Int m = Input("--height","height of matrix",1000);
+        const Int n = Input("--width","width of matrix",1000);
+        const Int mb = Input("--blockHeight","height of distribution blocks",32);
+        const Int nb = Input("--blockWidth","width of distribution blocks",32);
+        ProcessInput();
+        PrintInputReport();
+
+        if( k < 1 || k > commSize )
+            LogicError("Invalid number of subgrids");
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid grid( comm, order );
+
+        // Split the processes into k contiguous, disjoint subgrids
+        mpi::Group group;
+        mpi::CommGroup( comm, group );
+        std::vector<std::unique_ptr<Grid>> subgrids(k);
+        for( Int l=0; l<k; ++l )
+        {
+            const Int firstRank = (l*commSize)/k;
+            const Int numRanks = ((l+1)*commSize)/k - firstRank;
+            std::vector<int> ranks(numRanks);
+            for( Int q=0; q<numRanks; ++q )
+                ranks[q] = firstRank + q;
+            mpi::Group subgroup;
+            mpi::Incl( group, numRanks, ranks.data(), subgroup );
+            const Int height = Grid::FindFactor( numRanks );
+            subgrids[l].reset( new Grid( comm, subgroup, height, order ) );
+            mpi::Free( subgroup );
+        }
+        mpi::Free( group );
+
+        BlockDistMatrix<double> A( m, n, grid, mb, nb );
+        Fill( A );
+
+        // Subgrid l owns columns [colOffs[l],colOffs[l+1])
+        std::vector<Int> colOffs(k+1);
+        for( Int l=0; l<=k; ++l )
+            colOffs[l] = (l*n)/k;
+        std::vector<std::unique_ptr<BlockDistMatrix<double>>> AViews(k);
+        for( Int l=0; l<k; ++l )
+        {
+            AViews[l].reset( new BlockDistMatrix<double>(grid) );
+            ColumnView
+            ( A, colOffs[l], colOffs[l+1]-colOffs[l], *AViews[l] );
+        }
+
+        // One grid to k subgrids
+        std::vector<std::unique_ptr<BlockDistMatrix<double>>> ASubs(k);
+        for( Int l=0; l<k; ++l )
+            ASubs[l].reset( new BlockDistMatrix<double>(*subgrids[l]) );
+        mpi::Barrier( comm );
+        double startTime = mpi::Time();
+        for( Int l=0; l<k; ++l )
+            *ASubs[l] = *AViews[l];
+        mpi::Barrier( comm );
+        double runTime = mpi::Time() - startTime;
+        double error = 0;
+        for( Int l=0; l<k; ++l )
+            error = Max( error, MaxError( *ASubs[l], 1., colOffs[l] ) );
+        Report( "1 grid -> k subgrids", runTime, error, comm );
+
+        // Modify each copy locally so that the return trip is nontrivial
+        for( Int l=0; l<k; ++l )
+            if( ASubs[l]->Participating() )
+                Scale( 2., ASubs[l]->Matrix() );
+
+        // Subgrid l to subgrid (l+1) mod k, which never overlap when k > 1,
+        // into a different distribution
+        std::vector<std::unique_ptr<BlockDistMatrix<double,VC,STAR>>>
+          BSubs(k);
+        for( Int l=0; l<k; ++l )
+            BSubs[l].reset
+            ( new BlockDistMatrix<double,VC,STAR>(*subgrids[(l+1)%k]) );
+        mpi::Barrier( comm );
+        startTime = mpi::Time();
+        for( Int l=0; l<k; ++l )
+            Copy( *ASubs[l], *BSubs[l] );
+        mpi::Barrier( comm );
+        runTime = mpi::Time() - startTime;
+        error = 0;
+        for( Int l=0; l<k; ++l )
+            error = Max( error, MaxError( *BSubs[l], 2., colOffs[l] ) );
+        Report( "subgrid l -> subgrid l+1", runTime, error, comm );
+
+        // Merge the k blocks back into the (zeroed) full grid
+        if( A.Participating() )
+            Zero( A.Matrix() );
+        mpi::Barrier( comm );
+        startTime = mpi::Time();
+        for( Int l=0; l<k; ++l )
+            *AViews[l] = *ASubs[l];
+        mpi::Barrier( comm );
+        runTime = mpi::Time() - startTime;
+        error = MaxError( A, 2. );
+        Report( "k subgrids -> 1 grid", runTime, error, comm );
+
+        // The same round trip for elemental distributions
+        DistMatrix<double> AElem(grid), AElemSub(*subgrids[k-1]);
+        Zeros( AElem, m, n );
+        for( Int jLoc=0; jLoc<AElem.LocalWidth(); ++jLoc )
+            for( Int iLoc=0; iLoc<AElem.LocalHeight(); ++iLoc )
+                AElem.SetLocal
+                ( iLoc, jLoc,
+                  double(AElem.GlobalRow(iLoc)+AElem.GlobalCol(jLoc)*m) );
+        mpi::Barrier( comm );
+        startTime = mpi::Time();
+        AElemSub = AElem;
+        if( AElemSub.Participating() )
+            Scale( 2., AElemSub.Matrix() );
+        AElem = AElemSub;
+        mpi::Barrier( comm );
+        runTime = mpi::Time() - startTime;
+        BlockDistMatrix<double> AElemView(grid);
+        LockedView( AElemView, AElem );
+        error = MaxError( AElemView, 2. );
+        Report( "elemental round trip", runTime, error, comm );
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,155 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace El;
+
+typedef double Real;
+typedef Complex<Real> C;
+
+// Compare a uniformly-sampled spectral window of a random upper-triangular
+// matrix against its adaptively-refined counterpart. Every shift which the
+// adaptive run evaluated must agree with the uniform estimate to within the
+// tolerance, and every unit cell of the adaptive map which is crossed by one
+// of the (default, power-of-ten) contours must have been refined down to unit
+// stride, i.e., have all four of its corners evaluated.
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+
+    try
+    {
+        const Int n = Input("--size","height of matrix",100);
+        const Real realWidth = Input("--realWidth","x width of window",4.);
+        const Real imagWidth = Input("--imagWidth","y width of window",4.);
+        const Int realSize = Input("--realSize","number of x samples",65);
+        const Int imagSize = Input("--imagSize","number of y samples",65);
+        const Int coarseLevels =
+            Input("--coarseLevels","levels of adaptive refinement",3);
+        const bool warmStart = Input("--warmStart","warm start?",true);
+        const bool arnoldi = Input("--arnoldi","use Arnoldi?",true);
+        const Int basisSize = Input("--basisSize","num Arnoldi vectors",10);
+        const Int maxIts = Input("--maxIts","maximum pseudospec iter's",200);
+        const Real psTol = Input("--psTol","tolerance for pseudospectra",1e-6);
+        const bool progress = Input("--progress","print progress?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        DistMatrix<C> A;
+        Uniform( A, n, n );
+        MakeTrapezoidal( UPPER, A );
+        const C center(0,0);
+
+        PseudospecCtrl<Real> psCtrl;
+        psCtrl.maxIts = maxIts;
+        psCtrl.tol = psTol;
+        psCtrl.arnoldi = arnoldi;
+        psCtrl.basisSize = basisSize;
+        psCtrl.progress = progress;
+
+        DistMatrix<Real> uniformMap, adaptiveMap;
+        mpi::Barrier( comm );
+        double startTime = mpi::Time();
+        auto uniformCounts = TriangularSpectralWindow
+        ( A, uniformMap, center, realWidth, imagWidth, realSize, imagSize,
+          psCtrl );
+        mpi::Barrier( comm );
+        const double uniformTime = mpi::Time() - startTime;
+
+        psCtrl.adaptive = true;
+        psCtrl.coarseLevels = coarseLevels;
+        psCtrl.warmStart = warmStart;
+        mpi::Barrier( comm );
+        startTime = mpi::Time();
+        auto adaptiveCounts = TriangularSpectralWindow
+        ( A, adaptiveMap, center, realWidth, imagWidth, realSize, imagSize,
+          psCtrl );
+        mpi::Barrier( comm );
+        const double adaptiveTime = mpi::Time() - startTime;
+
+        // Interpolated shifts are reported with zero iterations
+        DistMatrix<Int,STAR,STAR> counts( adaptiveCounts );
+        DistMatrix<Real,STAR,STAR> uniform( uniformMap ),
+                                   adaptive( adaptiveMap );
+        Int numEvaluated = 0;
+        Real maxEvalDev = 0;
+        for( Int j=0; j<counts.Width(); ++j )
+        {
+            for( Int i=0; i<counts.Height(); ++i )
+            {
+                if( counts.GetLocal(i,j) != 0 )
+                {
+                    ++numEvaluated;
+                    const Real uniformEst = uniform.GetLocal(i,j);
+                    const Real dev =
+                      Abs(adaptive.GetLocal(i,j)-uniformEst)/uniformEst;
+                    maxEvalDev = Max( maxEvalDev, dev );
+                }
+            }
+        }
+        if( maxEvalDev > psTol )
+            LogicError
+            ("An evaluated shift deviated from the uniform estimate by ",
+             maxEvalDev," > ",psTol);
+
+        Int numCrossing = 0;
+        for( Int j=0; j<counts.Width()-1; ++j )
+        {
+            for( Int i=0; i<counts.Height()-1; ++i )
+            {
+                Real minEst = adaptive.GetLocal(i,j), maxEst = minEst;
+                bool refined = true;
+                for( Int jOff=0; jOff<2; ++jOff )
+                {
+                    for( Int iOff=0; iOff<2; ++iOff )
+                    {
+                        const Real est = adaptive.GetLocal(i+iOff,j+jOff);
+                        minEst = Min( minEst, est );
+                        maxEst = Max( maxEst, est );
+                        refined = refined &&
+                                  counts.GetLocal(i+iOff,j+jOff) != 0;
+                    }
+                }
+                if( std::floor(std::log10(minEst)) ==
+                    std::floor(std::log10(maxEst)) )
+                    continue;
+                ++numCrossing;
+                if( !refined )
+                    LogicError
+                    ("The contour crossing the cell at (",i,",",j,
+                     ") was not refined to unit stride");
+            }
+        }
+
+        // Measure the deviation in the number of digits of the resolvent norm
+        auto logMap = []( Real alpha ) { return std::log10(alpha); };
+        EntrywiseMap( uniformMap, logMap );
+        EntrywiseMap( adaptiveMap, logMap );
+        Axpy( Real(-1), uniformMap, adaptiveMap );
+        const Real logDev = MaxNorm( adaptiveMap );
+        if( commRank == 0 )
+            std::cout << "uniform:  " << realSize*imagSize << " shifts in "
+                      << uniformTime << " seconds\n"
+                      << "adaptive: " << numEvaluated << " shifts in "
+                      << adaptiveTime << " seconds\n"
+                      << "max deviation of evaluated estimates = "
+                      << maxEvalDev << "\n"
+                      << "all " << numCrossing << " contour-crossing cells "
+                      << "were refined to unit stride\n"
+                      << "max deviation of log10 estimates = " << logDev
+                      << std::endl;
+    }
+    catch( std::exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -136,8 +136,13 @@ main( int argc, char* argv[] )
             ("--correctness","test correctness?",true);
         const bool print = Input("--print","print matrices?",false);
         const bool printDiag = Input("--printDiag","print diag of fact?",false);
+        const bool timers = Input("--timers","print the timer tree?",false);
+        const std::string trace =
+          Input("--trace","Chrome trace filename (if any)",std::string(""));
         ProcessInput();
         PrintInputReport();
+        if( timers || !trace.empty() )
+            EnableTimers( true, !trace.empty() );
 
         if( r == 0 )
             r = Grid::FindFactor( commSize );
@@ -160,6 +165,9 @@ main( int argc, char* argv[] )
             cout << "Testing with double-precision complex:" << endl;
         TestCholesky<Complex<double>,VC>
         ( testCorrectness, pivot, print, printDiag, uplo, m, g );
+
+        if( !trace.empty() )
+            WriteChromeTrace( trace, comm );
     }
     catch( exception& e ) { ReportException(e); }
 
@@ -0,0 +1,115 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Compare the blocked distributed Cholesky factorization with its lookahead
+// variant on the same matrix (e.g., over 64 to 1024 processes), reporting the
+// best time of each over several trials and the difference of the factors
+
+template<typename F>
+double TimeCholesky
+( UpperOrLower uplo, const DistMatrix<F>& AOrig, DistMatrix<F>& A,
+  const CholeskyCtrl& ctrl, Int numTrials )
+{
+    const Grid& g = AOrig.Grid();
+    double bestTime = 0;
+    for( Int trial=0; trial<numTrials; ++trial )
+    {
+        A = AOrig;
+        mpi::Barrier( g.Comm() );
+        const double startTime = mpi::Time();
+        Cholesky( uplo, A, ctrl );
+        mpi::Barrier( g.Comm() );
+        const double runTime = mpi::Time() - startTime;
+        if( trial == 0 || runTime < bestTime )
+            bestTime = runTime;
+    }
+    return bestTime;
+}
+
+template<typename F>
+void TestLookahead( UpperOrLower uplo, Int m, Int numTrials, const Grid& g )
+{
+    typedef Base<F> Real;
+    DistMatrix<F> AOrig(g), A(g), ALook(g);
+    HermitianUniformSpectrum( AOrig, m, 1e-9, 10 );
+
+    CholeskyCtrl ctrl;
+    const double blockedTime = TimeCholesky( uplo, AOrig, A, ctrl, numTrials );
+    ctrl.lookahead = true;
+    const double lookTime = TimeCholesky( uplo, AOrig, ALook, ctrl, numTrials );
+
+    MakeTrapezoidal( uplo, A );
+    MakeTrapezoidal( uplo, ALook );
+    const Real frobA = FrobeniusNorm( A );
+    Axpy( F(-1), A, ALook );
+    const Real frobDiff = FrobeniusNorm( ALook );
+
+    const double realGFlops = 1./3.*Pow(double(m),3.)/1.e9;
+    const double gFlops = ( IsComplex<F>::val ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+    {
+        cout << "  Blocked:   " << blockedTime << " seconds. GFlops = "
+             << gFlops/blockedTime << "\n"
+             << "  Lookahead: " << lookTime << " seconds. GFlops = "
+             << gFlops/lookTime << "\n"
+             << "  Speedup = " << blockedTime/lookTime << "\n"
+             << "  || L_lookahead - L ||_F / || L ||_F = " << frobDiff/frobA
+             << endl;
+    }
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","process grid height",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const char uploChar = Input("--uplo","upper or lower storage: L/U",'L');
+        const Int m = Input("--m","height of matrix",1000);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int nbLocal = Input("--nbLocal","local blocksize",32);
+        const Int numTrials = Input("--numTrials","number of trials",3);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        const UpperOrLower uplo = CharToUpperOrLower( uploChar );
+        SetBlocksize( nb );
+        SetLocalTrrkBlocksize<double>( nbLocal );
+        SetLocalTrrkBlocksize<Complex<double>>( nbLocal );
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Will compare Cholesky" << uploChar << " variants on a "
+                 << g.Height() << " x " << g.Width() << " grid" << endl;
+
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestLookahead<double>( uplo, m, numTrials, g );
+
+        if( commRank == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestLookahead<Complex<double>>( uplo, m, numTrials, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,190 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Compare MRRR (PMRRR) with divide and conquer on the symmetric tridiagonal
+// eigenproblem for both a uniform spectrum (the tridiagonalization of
+// a matrix with eigenvalues drawn uniformly from [-10,10]) and a clustered
+// one (Wilkinson matrices glued together by small subdiagonal entries)
+
+template<typename Real>
+void UniformTridiag
+( DistMatrix<Real,STAR,STAR>& d, DistMatrix<Real,STAR,STAR>& e, Int n,
+  const Grid& g )
+{
+    DistMatrix<Real> A(g);
+    HermitianUniformSpectrum( A, n, Real(-10), Real(10) );
+    herm_tridiag::ExplicitCondensed( LOWER, A );
+    d = A.GetRealPartOfDiagonal();
+    e.Resize( n-1, 1, n );
+    e = A.GetRealPartOfDiagonal(-1);
+}
+
+template<typename Real>
+void GluedWilkinson
+( DistMatrix<Real,STAR,STAR>& d, DistMatrix<Real,STAR,STAR>& e, Int n, Int k,
+  Real gamma, const Grid& g )
+{
+    const Int blockSize = 2*k+1;
+    d.SetGrid( g );
+    e.SetGrid( g );
+    d.Resize( n, 1 );
+    e.Resize( n-1, 1, n );
+    for( Int i=0; i<n; ++i )
+        d.SetLocal( i, 0, Real(Abs(k-(i%blockSize))) );
+    for( Int i=0; i<n-1; ++i )
+        e.SetLocal( i, 0, ( (i+1)%blockSize==0 ? gamma : Real(1) ) );
+}
+
+template<typename Real>
+void TestCorrectness
+( const DistMatrix<Real,STAR,STAR>& d, const DistMatrix<Real,STAR,STAR>& e,
+  const DistMatrix<Real,VR,STAR>& w, const DistMatrix<Real>& Z )
+{
+    const Grid& g = Z.Grid();
+    const Int n = Z.Height();
+    const Int k = Z.Width();
+
+    DistMatrix<Real> T(g);
+    Zeros( T, n, n );
+    for( Int jLoc=0; jLoc<T.LocalWidth(); ++jLoc )
+    {
+        const Int j = T.GlobalCol(jLoc);
+        for( Int iLoc=0; iLoc<T.LocalHeight(); ++iLoc )
+        {
+            const Int i = T.GlobalRow(iLoc);
+            if( i == j )
+                T.SetLocal( iLoc, jLoc, d.GetLocal(i,0) );
+            else if( i == j+1 )
+                T.SetLocal( iLoc, jLoc, e.GetLocal(j,0) );
+            else if( j == i+1 )
+                T.SetLocal( iLoc, jLoc, e.GetLocal(i,0) );
+        }
+    }
+    const Real frobNormOfT = FrobeniusNorm( T );
+
+    DistMatrix<Real> X(g);
+    Identity( X, k, k );
+    Gemm( TRANSPOSE, NORMAL, Real(-1), Z, Z, Real(1), X );
+    const Real orthogError = FrobeniusNorm( X );
+
+    Zeros( X, n, k );
+    Gemm( NORMAL, NORMAL, Real(1), T, Z, Real(0), X );
+    DistMatrix<Real> ZW( Z );
+    DiagonalScale( RIGHT, NORMAL, w, ZW );
+    Axpy( Real(-1), ZW, X );
+    const Real residError = FrobeniusNorm( X );
+    if( g.Rank() == 0 )
+        cout << "    ||Z^T Z - I||_F / n     = " << orthogError/n << "\n"
+             << "    ||T Z - Z W||_F / ||T||_F = "
+             << residError/frobNormOfT << endl;
+}
+
+template<typename Real>
+void TestTridiagEig
+( bool testCorrectness, bool print,
+  const DistMatrix<Real,STAR,STAR>& d, const DistMatrix<Real,STAR,STAR>& e,
+  const HermitianTridiagEigCtrl& ctrl )
+{
+    const Grid& g = d.Grid();
+    DistMatrix<Real,VR,STAR> w(g);
+    DistMatrix<Real> Z(g);
+
+    if( g.Rank() == 0 )
+    {
+        cout << "  Starting "
+             << ( ctrl.alg==HERMITIAN_TRIDIAG_EIG_DC ? "divide and conquer"
+                                                     : "MRRR" )
+             << "...";
+        cout.flush();
+    }
+    mpi::Barrier( g.Comm() );
+    const double startTime = mpi::Time();
+    HermitianTridiagEig
+    ( d, e, w, Z, ASCENDING, HermitianEigSubset<Real>(), ctrl );
+    mpi::Barrier( g.Comm() );
+    const double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "DONE. " << endl
+             << "  Time = " << runTime << " seconds." << endl;
+    if( print )
+    {
+        Print( w, "eigenvalues:" );
+        Print( Z, "eigenvectors:" );
+    }
+    if( testCorrectness )
+        TestCorrectness( d, e, w, Z );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--height","height of matrix",1000);
+        const Int k = Input
+            ("--wilkinson","glued Wilkinson matrices are of size 2k+1",10);
+        const double gamma = Input
+            ("--gamma","glue between Wilkinson matrices",1e-8);
+        const Int cutoff = Input("--cutoff","divide and conquer cutoff",64);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const bool testUniform = Input
+            ("--testUniform","test a uniform spectrum?",true);
+        const bool testClustered = Input
+            ("--testClustered","test a clustered spectrum?",true);
+        const bool testCorrectness = Input
+            ("--correctness","test correctness?",true);
+        const bool print = Input("--print","print matrices?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+
+        HermitianTridiagEigCtrl mrrrCtrl, dcCtrl;
+        mrrrCtrl.alg = HERMITIAN_TRIDIAG_EIG_MRRR;
+        dcCtrl.alg = HERMITIAN_TRIDIAG_EIG_DC;
+        dcCtrl.dcCutoff = cutoff;
+
+        DistMatrix<double,STAR,STAR> d(g), e(g);
+        if( testUniform )
+        {
+            if( commRank == 0 )
+                cout << "Uniform spectrum:" << endl;
+            UniformTridiag( d, e, n, g );
+            TestTridiagEig( testCorrectness, print, d, e, mrrrCtrl );
+            TestTridiagEig( testCorrectness, print, d, e, dcCtrl );
+        }
+        if( testClustered )
+        {
+            if( commRank == 0 )
+                cout << "Glued Wilkinson spectrum:" << endl;
+            GluedWilkinson( d, e, n, k, gamma, g );
+            TestTridiagEig( testCorrectness, print, d, e, mrrrCtrl );
+            TestTridiagEig( testCorrectness, print, d, e, dcCtrl );
+        }
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -31,7 +31,7 @@ void TestCorrectness
     auto Y( X );
     if( pivoting == 0 )
         lu::SolveAfter( NORMAL, A, Y );
-    else if( pivoting == 1 )
+    else if( pivoting == 1 || pivoting == 3 )
         lu::SolveAfter( NORMAL, A, pPerm, Y );
     else
         lu::SolveAfter( NORMAL, A, pPerm, qPerm, Y );
@@ -102,6 +102,12 @@ void TestLU
         LU( A, pPerm );
     else if( pivoting == 2 )
         LU( A, pPerm, qPerm );
+    else
+    {
+        LUCtrl ctrl;
+        ctrl.tournament = true;
+        LU( A, pPerm, ctrl );
+    }
 
     mpi::Barrier( g.Comm() );
     const double runTime = mpi::Time() - startTime;
@@ -149,7 +155,8 @@ main( int argc, char* argv[] )
         const bool colMajor = Input("--colMajor","column-major ordering?",true);
         const Int m = Input("--height","height of matrix",100);
         const Int nb = Input("--nb","algorithmic blocksize",96);
-        const Int pivot = Input("--pivot","0: none, 1: partial, 2: full",1);
+        const Int pivot =
+          Input("--pivot","0: none, 1: partial, 2: full, 3: tournament",1);
         const bool forceGrowth = Input
             ("--forceGrowth","force element growth?",false);
         const bool testCorrectness = Input
@@ -157,7 +164,7 @@ main( int argc, char* argv[] )
         const bool print = Input("--print","print matrices?",false);
         ProcessInput();
         PrintInputReport();
-        if( pivot < 0 || pivot > 2 )
+        if( pivot < 0 || pivot > 3 )
             LogicError("Invalid pivot value");
 
         if( r == 0 )
@@ -175,6 +182,8 @@ main( int argc, char* argv[] )
                 cout << "partial pivoting" << std::endl;
             else if( pivot == 2 )
                 cout << "full pivoting" << std::endl;
+            else if( pivot == 3 )
+                cout << "tournament pivoting" << std::endl;
         }
 
         if( commRank == 0 )
@@ -0,0 +1,141 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Test the native distributed Hessenberg QR algorithm (multishift sweeps with
+// aggressive early deflation) on real and complex matrices, both with and
+// without the accumulation of the Schur vectors. Lowering the sequential
+// cutoff forces more of the reduction through the distributed sweeps.
+
+template<typename F>
+void TestCorrectness
+( const DistMatrix<F>& A, const DistMatrix<F>& T, const DistMatrix<F>& Q )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int n = A.Height();
+    const Real frobA = FrobeniusNorm( A );
+
+    // Form || A - Q T Q^H ||_F / || A ||_F
+    DistMatrix<F> X(g), E( A );
+    Gemm( NORMAL, NORMAL, F(1), Q, T, X );
+    Gemm( NORMAL, ADJOINT, F(-1), X, Q, F(1), E );
+    const Real frobE = FrobeniusNorm( E );
+
+    // Form || Q^H Q - I ||_F
+    Identity( E, n, n );
+    Herk( LOWER, ADJOINT, Real(-1), Q, Real(1), E );
+    const Real frobOrth = HermitianFrobeniusNorm( LOWER, E );
+    if( g.Rank() == 0 )
+        cout << "    || A - Q T Q^H ||_F / || A ||_F = " << frobE/frobA << "\n"
+             << "    || Q^H Q - I ||_F = " << frobOrth << endl;
+}
+
+template<typename F>
+void TestTrace
+( const DistMatrix<F>& A, const DistMatrix<Complex<Base<F>>,VR,STAR>& w )
+{
+    typedef Base<F> Real;
+    Complex<Real> traceA=0, sumW=0;
+    DistMatrix<F,STAR,STAR> d( A.GetDiagonal() );
+    DistMatrix<Complex<Real>,STAR,STAR> w_STAR_STAR( w );
+    for( Int i=0; i<A.Height(); ++i )
+    {
+        traceA += d.GetLocal(i,0);
+        sumW += w_STAR_STAR.GetLocal(i,0);
+    }
+    const Real frobA = FrobeniusNorm( A );
+    if( A.Grid().Rank() == 0 )
+        cout << "    | tr(A) - sum(w) | / || A ||_F = "
+             << Abs(traceA-sumW)/frobA << endl;
+}
+
+template<typename F>
+void TestSchur
+( const string& typeName, Int n, const SchurCtrl<Base<F>>& ctrl,
+  const Grid& g )
+{
+    typedef Base<F> Real;
+    if( g.Rank() == 0 )
+        cout << "Testing with " << typeName << ":" << endl;
+    DistMatrix<F> A(g);
+    Uniform( A, n, n );
+
+    // Without the Schur vectors
+    DistMatrix<F> T( A );
+    DistMatrix<Complex<Real>,VR,STAR> w(g);
+    mpi::Barrier( g.Comm() );
+    double startTime = mpi::Time();
+    Schur( T, w, false, ctrl );
+    mpi::Barrier( g.Comm() );
+    double runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "  Schur without Q: " << runTime << " seconds" << endl;
+    TestTrace( A, w );
+
+    // With the Schur vectors
+    T = A;
+    DistMatrix<F> Q(g);
+    mpi::Barrier( g.Comm() );
+    startTime = mpi::Time();
+    Schur( T, w, Q, true, ctrl );
+    mpi::Barrier( g.Comm() );
+    runTime = mpi::Time() - startTime;
+    if( g.Rank() == 0 )
+        cout << "  Schur with Q: " << runTime << " seconds" << endl;
+    // Real Schur forms are only quasi-triangular
+    MakeTrapezoidal( UPPER, T, ( IsComplex<F>::val ? 0 : -1 ) );
+    TestTrace( A, w );
+    TestCorrectness( A, T, Q );
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int n = Input("--size","height of matrix",300);
+        const Int numShifts =
+            Input("--numShifts","number of shifts per sweep (0=default)",0);
+        const Int deflationWindow =
+            Input("--deflationWindow","AED window size (0=default)",0);
+        const Int sequentialCutoff =
+            Input("--sequentialCutoff","max size of sequential QR",64);
+        const Int nbAlg = Input("--nbAlg","algorithmic blocksize",96);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        SetBlocksize( nbAlg );
+
+        SchurCtrl<double> ctrl;
+        ctrl.qrCtrl.scalapack = false;
+        ctrl.qrCtrl.numShifts = numShifts;
+        ctrl.qrCtrl.deflationWindow = deflationWindow;
+        ctrl.qrCtrl.sequentialCutoff = sequentialCutoff;
+
+        TestSchur<double>( "double", n, ctrl, g );
+        TestSchur<Complex<double>>( "Complex<double>", n, ctrl, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -0,0 +1,137 @@
+/*
+   Copyright (c) 2009-2014, Jack Poulson
+   All rights reserved.
+
+   This file is part of Elemental and is under the BSD 2-Clause License,
+   which can be found in the LICENSE file in the root directory, or at
+   http://opensource.org/licenses/BSD-2-Clause
+*/
+#include "El.hpp"
+using namespace std;
+using namespace El;
+
+// Compare partial pivoting with tournament pivoting (CALU) on the same matrix.
+// Running a fixed size over increasing numbers of processes gives a strong
+// scaling study; the growth factor and the scaled residual of a solve with
+// each factorization check the stability of the tournament.
+
+template<typename F>
+void Factor
+( const DistMatrix<F>& AOrig, DistMatrix<F>& A, DistMatrix<Int,VC,STAR>& p,
+  const LUCtrl& ctrl, Int numTrials, double& bestTime )
+{
+    const Grid& g = AOrig.Grid();
+    for( Int trial=0; trial<numTrials; ++trial )
+    {
+        A = AOrig;
+        mpi::Barrier( g.Comm() );
+        const double startTime = mpi::Time();
+        LU( A, p, ctrl );
+        mpi::Barrier( g.Comm() );
+        const double runTime = mpi::Time() - startTime;
+        if( trial == 0 || runTime < bestTime )
+            bestTime = runTime;
+    }
+}
+
+template<typename F>
+void Report
+( const string& label, const DistMatrix<F>& AOrig, const DistMatrix<F>& A,
+  const DistMatrix<Int,VC,STAR>& p, double runTime )
+{
+    typedef Base<F> Real;
+    const Grid& g = A.Grid();
+    const Int m = A.Height();
+
+    // The growth factor, max |U| / max |A|
+    auto U( A );
+    MakeTrapezoidal( UPPER, U );
+    const Real growth = MaxNorm( U ) / MaxNorm( AOrig );
+
+    // The scaled residual, || A X - B ||_oo / (eps m ||A||_oo ||X||_oo)
+    DistMatrix<F> B(g);
+    Uniform( B, m, 10 );
+    auto X( B );
+    lu::SolveAfter( NORMAL, A, p, X );
+    const Real infNormA = InfinityNorm( AOrig );
+    const Real infNormX = InfinityNorm( X );
+    Gemm( NORMAL, NORMAL, F(-1), AOrig, X, F(1), B );
+    const Real infNormE = InfinityNorm( B );
+    const Real residual =
+      infNormE / (lapack::MachineEpsilon<Real>()*m*infNormA*infNormX);
+
+    const double realGFlops = 2./3.*Pow(double(m),3.)/1.e9;
+    const double gFlops = ( IsComplex<F>::val ? 4*realGFlops : realGFlops );
+    if( g.Rank() == 0 )
+        cout << "  " << label << ": " << runTime << " seconds, "
+             << gFlops/runTime << " GFlops, growth = " << growth
+             << ", scaled residual = " << residual << endl;
+}
+
+template<typename F>
+void TestTournament
+( Int m, Int numTrials, bool forceGrowth, const Grid& g )
+{
+    DistMatrix<F> AOrig(g), A(g);
+    DistMatrix<Int,VC,STAR> p(g);
+    if( forceGrowth )
+        GEPPGrowth( AOrig, m );
+    else
+        Uniform( AOrig, m, m );
+
+    LUCtrl ctrl;
+    double partialTime;
+    Factor( AOrig, A, p, ctrl, numTrials, partialTime );
+    Report( "Partial   ", AOrig, A, p, partialTime );
+
+    ctrl.tournament = true;
+    double tournamentTime;
+    Factor( AOrig, A, p, ctrl, numTrials, tournamentTime );
+    Report( "Tournament", AOrig, A, p, tournamentTime );
+    if( g.Rank() == 0 )
+        cout << "  Speedup = " << partialTime/tournamentTime << endl;
+}
+
+int
+main( int argc, char* argv[] )
+{
+    Initialize( argc, argv );
+    mpi::Comm comm = mpi::COMM_WORLD;
+    const Int commRank = mpi::Rank( comm );
+    const Int commSize = mpi::Size( comm );
+
+    try
+    {
+        Int r = Input("--gridHeight","height of process grid",0);
+        const bool colMajor = Input("--colMajor","column-major ordering?",true);
+        const Int m = Input("--height","height of matrix",1000);
+        const Int nb = Input("--nb","algorithmic blocksize",96);
+        const Int numTrials = Input("--numTrials","number of trials",3);
+        const bool forceGrowth = Input
+            ("--forceGrowth","force element growth?",false);
+        ProcessInput();
+        PrintInputReport();
+
+        if( r == 0 )
+            r = Grid::FindFactor( commSize );
+        const GridOrder order = ( colMajor ? COLUMN_MAJOR : ROW_MAJOR );
+        const Grid g( comm, r, order );
+        SetBlocksize( nb );
+        ComplainIfDebug();
+        if( commRank == 0 )
+            cout << "Will compare partial and tournament pivoting on a "
+                 << g.Height() << " x " << g.Width() << " grid" << endl;
+
+        if( commRank == 0 )
+            cout << "Testing with doubles:" << endl;
+        TestTournament<double>( m, numTrials, forceGrowth, g );
+
+        if( commRank == 0 )
+            cout << "Testing with double-precision complex:" << endl;
+        TestTournament<Complex<double>>( m, numTrials, forceGrowth, g );
+    }
+    catch( exception& e ) { ReportException(e); }
+
+    Finalize();
+    return 0;
+}
@@ -35,6 +35,12 @@ main( int argc, char* argv[] )
             ("--numSeqSeps",
              "number of partitions to try per sequential partition",1);
         const int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const std::string analysisFile = Input
+            ("--analysisFile","write and reload the analysis from here",
+             std::string(""));
+        const bool newMatrix = Input
+            ("--newMatrix","refactor new matrices with the same pattern?",
+             false);
         const bool print = Input("--print","print matrix?",false);
         const bool display = Input("--display","display matrix?",false);
         ProcessInput();
@@ -49,32 +55,37 @@ main( int argc, char* argv[] )
             std::cout << "Filling local portion of matrix...";
             std::cout.flush();
         }
-        const double fillStart = mpi::Time();
-        const int firstLocalRow = A.FirstLocalRow();
-        const int localHeight = A.LocalHeight();
-        A.Reserve( 7*localHeight );
-        for( int iLocal=0; iLocal<localHeight; ++iLocal )
+        // The diagonal is varied to produce new matrices with the same pattern
+        auto fill = [&]( double diagonal )
         {
-            const int i = firstLocalRow + iLocal;
-            const int x = i % n1;
-            const int y = (i/n1) % n2;
-            const int z = i/(n1*n2);
+            const int firstLocalRow = A.FirstLocalRow();
+            const int localHeight = A.LocalHeight();
+            A.Reserve( 7*localHeight );
+            for( int iLocal=0; iLocal<localHeight; ++iLocal )
+            {
+                const int i = firstLocalRow + iLocal;
+                const int x = i % n1;
+                const int y = (i/n1) % n2;
+                const int z = i/(n1*n2);
 
-            A.QueueLocalUpdate( iLocal, i, 6. );
-            if( x != 0 )
-                A.QueueLocalUpdate( iLocal, i-1, -1. );
-            if( x != n1-1 )
-                A.QueueLocalUpdate( iLocal, i+1, -1. );
-            if( y != 0 )
-                A.QueueLocalUpdate( iLocal, i-n1, -1. );
-            if( y != n2-1 )
-                A.QueueLocalUpdate( iLocal, i+n1, -1. );
-            if( z != 0 )
-                A.QueueLocalUpdate( iLocal, i-n1*n2, -1. );
-            if( z != n3-1 )
-                A.QueueLocalUpdate( iLocal, i+n1*n2, -1. );
-        } 
-        A.MakeConsistent();
+                A.QueueLocalUpdate( iLocal, i, diagonal );
+                if( x != 0 )
+                    A.QueueLocalUpdate( iLocal, i-1, -1. );
+                if( x != n1-1 )
+                    A.QueueLocalUpdate( iLocal, i+1, -1. );
+                if( y != 0 )
+                    A.QueueLocalUpdate( iLocal, i-n1, -1. );
+                if( y != n2-1 )
+                    A.QueueLocalUpdate( iLocal, i+n1, -1. );
+                if( z != 0 )
+                    A.QueueLocalUpdate( iLocal, i-n1*n2, -1. );
+                if( z != n3-1 )
+                    A.QueueLocalUpdate( iLocal, i+n1*n2, -1. );
+            } 
+            A.MakeConsistent();
+        };
+        const double fillStart = mpi::Time();
+        fill( 6. );
         mpi::Barrier( comm );
         const double fillStop =  mpi::Time();
         if( commRank == 0 )
@@ -98,19 +109,35 @@ main( int argc, char* argv[] )
         }
         const double nestedStart = mpi::Time();
         const DistGraph& graph = A.DistGraph();
-        DistSymmInfo info;
-        DistSeparatorTree sepTree;
-        DistMap map, inverseMap;
+        DistSymmAnalysis analysis;
         NestedDissection
-        ( graph, map, sepTree, info, 
-          sequential, numDistSeps, numSeqSeps, cutoff );
-        map.FormInverse( inverseMap );
+        ( graph, analysis, sequential, numDistSeps, numSeqSeps, cutoff );
         mpi::Barrier( comm );
         const double nestedStop = mpi::Time();
         if( commRank == 0 )
             std::cout << "done, " << nestedStop-nestedStart << " seconds"
                       << std::endl;
 
+        if( analysisFile != "" )
+        {
+            if( commRank == 0 )
+            {
+                std::cout << "Writing and reloading the analysis...";
+                std::cout.flush();
+            }
+            const double ioStart = mpi::Time();
+            analysis.Write( analysisFile );
+            mpi::Barrier( comm );
+            analysis.Load( analysisFile, comm );
+            mpi::Barrier( comm );
+            const double ioStop = mpi::Time();
+            if( commRank == 0 )
+                std::cout << "done, " << ioStop-ioStart << " seconds"
+                          << std::endl;
+        }
+        DistSymmInfo& info = analysis.info;
+        const DistMap& inverseMap = analysis.inverseMap;
+
         if( commRank == 0 )
         {
             const int numDistNodes = info.distNodes.size();
@@ -132,7 +159,8 @@ main( int argc, char* argv[] )
         }
         mpi::Barrier( comm );
         const double buildStart = mpi::Time();
-        DistSymmFrontTree<double> frontTree( A, map, sepTree, info, false );
+        DistSymmFrontTree<double> frontTree
+        ( A, analysis.map, analysis.sepTree, info, false );
         mpi::Barrier( comm );
         const double buildStop = mpi::Time();
         if( commRank == 0 )
@@ -141,7 +169,19 @@ main( int argc, char* argv[] )
 
         for( int repeat=0; repeat<numRepeats; ++repeat )
         {
-            if( repeat != 0 )
+            if( repeat != 0 && newMatrix )
+            {
+                // Skip straight to the numeric phase for a new matrix
+                if( commRank == 0 )
+                    std::cout << "Rebuilding frontal tree for a new matrix."
+                              << std::endl;
+                A.LockPattern();
+                A.ZeroValues();
+                fill( 6.+repeat );
+                frontTree.Initialize
+                ( A, analysis.map, analysis.sepTree, info, false );
+            }
+            else if( repeat != 0 )
             {
                 // Reset to an unfactored, implicitly symmetric frontal tree
                 if( commRank == 0 )
@@ -38,7 +38,21 @@ main( int argc, char* argv[] )
              "number of separators to try per sequential partition",1);
         const int nbFact = Input("--nbFact","factorization blocksize",96);
         const int nbSolve = Input("--nbSolve","solve blocksize",96);
+        const int pipelineWidth = Input
+            ("--pipelineWidth","columns per block of pipelined 1d solves",4);
+        const int min2dWidth = Input
+            ("--min2dWidth","min. number of right-hand sides for 2d solves",8);
         const int cutoff = Input("--cutoff","cutoff for nested dissection",128);
+        const bool amalgamate = Input
+            ("--amalgamate","merge small or nearly dense fronts?",false);
+        const int relaxSize = Input
+            ("--relaxSize","merge fronts up to this size",16);
+        const double maxZeroFrac = Input
+            ("--maxZeroFrac","max fraction of zeros in merged fronts",0.1);
+        const bool outOfCore = Input
+            ("--outOfCore","write the local fronts out of core?",false);
+        const double oocBudget = Input
+            ("--oocBudget","MB of local fronts kept in memory",100.);
         const bool print = Input("--print","print matrix?",false);
         const bool display = Input("--display","display matrix?",false);
         ProcessInput();
@@ -123,16 +137,22 @@ main( int argc, char* argv[] )
         DistSymmInfo info;
         DistSeparatorTree sepTree;
         DistMap map, inverseMap;
+        AmalgamationCtrl amalgCtrl;
+        amalgCtrl.amalgamate = amalgamate;
+        amalgCtrl.relaxSize = relaxSize;
+        amalgCtrl.maxZeroFraction = maxZeroFrac;
+        amalgCtrl.progress = amalgamate;
         if( natural )
         {
             NaturalNestedDissection
-            ( n1, n2, n3, graph, map, sepTree, info, cutoff );
+            ( n1, n2, n3, graph, map, sepTree, info, cutoff, false, 
+              amalgCtrl );
         }
         else
         {
             NestedDissection
             ( graph, map, sepTree, info, 
-              sequential, numDistSeps, numSeqSeps, cutoff );
+              sequential, numDistSeps, numSeqSeps, cutoff, false, amalgCtrl );
         }
         map.FormInverse( inverseMap );
         mpi::Barrier( comm );
@@ -240,6 +260,12 @@ main( int argc, char* argv[] )
                 frontType = ( selInv ? LDL_SELINV_1D
                                      : LDL_1D );
         }
+        if( outOfCore )
+        {
+            OutOfCoreCtrl oocCtrl;
+            oocCtrl.memoryBudget = oocBudget*1e6;
+            frontTree.EnableOutOfCore( oocCtrl );
+        }
         LDL( info, frontTree, frontType );
         mpi::Barrier( comm );
         const double ldlStop = mpi::Time();
@@ -289,7 +315,9 @@ main( int argc, char* argv[] )
             YNodal.Pull( inverseMap, info, Y );
             mpi::Barrier( comm );
             solveStart = mpi::Time();
-            Solve( info, frontTree, YNodal );
+            SolveCtrl solveCtrl;
+            solveCtrl.pipelineWidth = pipelineWidth;
+            Solve( info, frontTree, YNodal, solveCtrl );
             mpi::Barrier( comm );
             solveStop = mpi::Time();
             YNodal.Push( inverseMap, info, Y );
@@ -299,6 +327,8 @@ main( int argc, char* argv[] )
         if( commRank == 0 )
             std::cout << "done, " << solveTime << " seconds, "
                       << solveGFlops << " GFlop/s" << std::endl;
+        if( outOfCore )
+            frontTree.PrintIOStats( comm );
 
         if( commRank == 0 )
             std::cout << "Checking error in computed solution..." << std::endl;
@@ -320,6 +350,43 @@ main( int argc, char* argv[] )
                           << std::endl;
             }
         }
+
+        // Solve directly against DistMultiVec's on either side of min2dWidth,
+        // which switches the fronts to 1D and then back to 2D
+        SolveCtrl solveCtrl;
+        solveCtrl.pipelineWidth = pipelineWidth;
+        solveCtrl.min2dWidth = min2dWidth;
+        for( int width=Max(min2dWidth-1,1); width<=min2dWidth; ++width )
+        {
+            if( commRank == 0 )
+            {
+                std::cout << "Solving against " << width 
+                          << " right-hand sides with ";
+                std::cout.flush();
+            }
+            DistMultiVec<double> XW( N, width, comm ), YW( N, width, comm );
+            MakeUniform( XW );
+            Zero( YW );
+            Multiply( NORMAL, 1., A, XW, 0., YW );
+            mpi::Barrier( comm );
+            solveStart = mpi::Time();
+            Solve( info, frontTree, inverseMap, YW, solveCtrl );
+            mpi::Barrier( comm );
+            solveStop = mpi::Time();
+            Matrix<double> XWNorms;
+            ColumnNorms( XW, XWNorms );
+            Axpy( -1., XW, YW );
+            ColumnNorms( YW, errorNorms );
+            double maxRelError = 0;
+            for( int j=0; j<width; ++j )
+                maxRelError = 
+                    Max( maxRelError, errorNorms.Get(j,0)/XWNorms.Get(j,0) );
+            if( commRank == 0 )
+                std::cout << ( FrontsAre1d(frontTree.frontType) ? "1d" : "2d" )
+                          << " fronts: " << solveStop-solveStart 
+                          << " seconds, max || error ||_2 / || x ||_2 = " 
+                          << maxRelError << std::endl;
+        }
     }
     catch( std::exception& e ) { ReportException(e); }
 